@@ -0,0 +1,45 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <gleam/core/events.hpp>
+
+#include "core/event_dispatcher.hpp"
+
+#include <memory>
+#include <vector>
+
+// Dispatches a mouse event to a varying number of listeners. The event is
+// allocated per dispatch, matching how the window forwards input today.
+
+static void BM_EventDispatcherDispatch(benchmark::State& state) {
+    auto& dispatcher = gleam::EventDispatcher::Get();
+    auto listeners = std::vector<std::shared_ptr<gleam::EventListener>> {};
+    auto handled = 0;
+
+    for (auto i = 0; i < state.range(0); ++i) {
+        auto listener = std::make_shared<gleam::EventListener>([&handled](gleam::Event* event) {
+            if (event->GetType() == gleam::EventType::Mouse) handled++;
+        });
+        dispatcher.AddEventListener("bench_mouse_event", listener);
+        listeners.emplace_back(listener);
+    }
+
+    for (auto _ : state) {
+        auto event = std::make_unique<gleam::MouseEvent>();
+        event->type = gleam::MouseEvent::Type::Moved;
+        event->position = {1.0f, 2.0f};
+        dispatcher.Dispatch("bench_mouse_event", std::move(event));
+    }
+
+    benchmark::DoNotOptimize(handled);
+    dispatcher.RemoveEventListenersForEvent("bench_mouse_event");
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_EventDispatcherDispatch)->Arg(1)->Arg(8)->Arg(64);
\ No newline at end of file
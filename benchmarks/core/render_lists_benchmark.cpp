@@ -0,0 +1,92 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <gleam/geometries/box_geometry.hpp>
+#include <gleam/materials/flat_material.hpp>
+#include <gleam/nodes/mesh.hpp>
+#include <gleam/nodes/scene.hpp>
+
+#include "core/render_lists.hpp"
+#include "core/worker_pool.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+// The argument is the number of meshes in the scene. One in eight meshes is
+// transparent and geometries/materials are shared in small groups so the
+// deduplication paths in ProcessScene are exercised too.
+
+namespace {
+
+auto build_scene(int mesh_count) {
+    auto scene = gleam::Scene::Create();
+    auto geometry = gleam::BoxGeometry::Create();
+    auto opaque = gleam::FlatMaterial::Create();
+    auto transparent = gleam::FlatMaterial::Create();
+    transparent->transparent = true;
+
+    for (auto i = 0; i < mesh_count; ++i) {
+        if (i % 16 == 0) geometry = gleam::BoxGeometry::Create();
+        auto mesh = gleam::Mesh::Create(geometry, i % 8 == 0 ? transparent : opaque);
+        mesh->transform.Translate({static_cast<float>(i % 100), static_cast<float>(i / 100), 0.0f});
+        scene->Add(mesh);
+    }
+
+    scene->UpdateTransformHierarchy();
+    return scene;
+}
+
+} // unnamed namespace
+
+static void BM_RenderListsProcessScene(benchmark::State& state) {
+    const auto mesh_count = static_cast<int>(state.range(0));
+    auto scene = build_scene(mesh_count);
+    auto render_lists = gleam::RenderLists {};
+
+    for (auto _ : state) {
+        render_lists.ProcessScene(scene.get());
+        benchmark::DoNotOptimize(render_lists.Opaque().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * mesh_count);
+}
+
+static void BM_RenderListsUpdate(benchmark::State& state) {
+    const auto mesh_count = static_cast<int>(state.range(0));
+    auto scene = build_scene(mesh_count);
+    auto render_lists = gleam::RenderLists {};
+    render_lists.ProcessScene(scene.get());
+
+    for (auto _ : state) {
+        render_lists.Update(scene.get(), {});
+        benchmark::DoNotOptimize(render_lists.Opaque().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * mesh_count);
+}
+
+static void BM_RenderListsUpdateParallel(benchmark::State& state) {
+    const auto mesh_count = static_cast<int>(state.range(0));
+    auto scene = build_scene(mesh_count);
+    auto render_lists = gleam::RenderLists {};
+    auto workers = gleam::WorkerPool {std::max(std::thread::hardware_concurrency(), 2u) - 1};
+    render_lists.ProcessScene(scene.get());
+
+    for (auto _ : state) {
+        render_lists.Update(scene.get(), {}, &workers);
+        benchmark::DoNotOptimize(render_lists.Opaque().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * mesh_count);
+}
+
+BENCHMARK(BM_RenderListsProcessScene)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK(BM_RenderListsUpdate)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK(BM_RenderListsUpdateParallel)->RangeMultiplier(10)->Range(100, 10'000);
\ No newline at end of file
@@ -0,0 +1,79 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <gleam/geometries/box_geometry.hpp>
+#include <gleam/geometries/sphere_geometry.hpp>
+
+// Generator benchmarks take the segment count as their argument, so the
+// reported item rate is vertices per second for each tessellation level.
+
+namespace {
+
+class UncachedSphereGeometry : public gleam::SphereGeometry {
+public:
+    using SphereGeometry::SphereGeometry;
+
+    auto ResetBounds() {
+        bounding_sphere_.reset();
+    }
+};
+
+} // unnamed namespace
+
+static void BM_SphereGeometry(benchmark::State& state) {
+    const auto segments = static_cast<unsigned>(state.range(0));
+    auto vertices = 0UL;
+
+    for (auto _ : state) {
+        auto geometry = gleam::SphereGeometry::Create({
+            .width_segments = segments,
+            .height_segments = segments / 2
+        });
+        vertices = geometry->VertexCount();
+        benchmark::DoNotOptimize(geometry.get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * vertices);
+}
+
+static void BM_BoxGeometry(benchmark::State& state) {
+    const auto segments = static_cast<unsigned>(state.range(0));
+    auto vertices = 0UL;
+
+    for (auto _ : state) {
+        auto geometry = gleam::BoxGeometry::Create({
+            .width_segments = segments,
+            .height_segments = segments,
+            .depth_segments = segments
+        });
+        vertices = geometry->VertexCount();
+        benchmark::DoNotOptimize(geometry.get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * vertices);
+}
+
+static void BM_GeometryBoundingSphere(benchmark::State& state) {
+    const auto segments = static_cast<unsigned>(state.range(0));
+    auto geometry = UncachedSphereGeometry {{
+        .width_segments = segments,
+        .height_segments = segments / 2
+    }};
+
+    for (auto _ : state) {
+        geometry.ResetBounds();
+        benchmark::DoNotOptimize(geometry.BoundingSphere());
+    }
+
+    state.SetItemsProcessed(state.iterations() * geometry.VertexCount());
+}
+
+BENCHMARK(BM_SphereGeometry)->RangeMultiplier(4)->Range(16, 256);
+BENCHMARK(BM_BoxGeometry)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(BM_GeometryBoundingSphere)->RangeMultiplier(4)->Range(16, 256);
\ No newline at end of file
@@ -0,0 +1,129 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <gleam/loaders/mesh_loader.hpp>
+#include <gleam/loaders/texture_loader.hpp>
+#include <gleam/nodes/node.hpp>
+#include <gleam/textures/texture_2d.hpp>
+
+#include "asset_builder/include/types.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// The loaders are measured against synthetic files written to the temp
+// directory, so file sizes can be scaled well past the test assets. The
+// first run reads from disk, every other run reads from the page cache.
+
+namespace {
+
+namespace fs = std::filesystem;
+
+auto write_texture(uint32_t size) {
+    const auto path = fs::temp_directory_path() / ("gleam_bench_" + std::to_string(size) + ".tex");
+    if (fs::exists(path)) return path;
+
+    auto header = TextureHeader {};
+    std::memcpy(header.magic, "TEX0", 4);
+    header.version = 1;
+    header.header_size = sizeof(TextureHeader);
+    header.width = size;
+    header.height = size;
+    header.format = TextureFormat::RGBA8;
+    header.mip_levels = 1;
+    header.pixel_data_size = static_cast<uint64_t>(size) * size * 4;
+
+    auto pixels = std::vector<char>(header.pixel_data_size, 0x7F);
+    auto file = std::ofstream {path, std::ios::binary};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(pixels.data(), pixels.size());
+    return path;
+}
+
+auto write_mesh(uint32_t mesh_count, uint32_t vertex_count) {
+    const auto path = fs::temp_directory_path() / (
+        "gleam_bench_" + std::to_string(mesh_count) + "x" + std::to_string(vertex_count) + ".msh"
+    );
+    if (fs::exists(path)) return path;
+
+    constexpr auto stride = 8u;
+    auto header = MeshHeader {};
+    std::memcpy(header.magic, "MES0", 4);
+    header.version = 1;
+    header.header_size = sizeof(MeshHeader);
+    header.material_count = 0;
+    header.mesh_count = mesh_count;
+
+    auto file = std::ofstream {path, std::ios::binary};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    auto vertices = std::vector<float>(vertex_count * stride, 0.5f);
+    auto indices = std::vector<uint32_t>(vertex_count);
+    for (auto i = 0u; i < vertex_count; ++i) indices[i] = i;
+
+    for (auto i = 0u; i < mesh_count; ++i) {
+        auto entry = MeshEntryHeader {};
+        entry.vertex_count = vertex_count;
+        entry.index_count = vertex_count;
+        entry.vertex_stride = stride;
+        entry.material_index = static_cast<uint32_t>(-1);
+        entry.vertex_data_size = vertices.size() * sizeof(float);
+        entry.index_data_size = indices.size() * sizeof(uint32_t);
+        entry.vertex_flags = Positions | Normals | UVs;
+
+        file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+        file.write(reinterpret_cast<const char*>(vertices.data()), entry.vertex_data_size);
+        file.write(reinterpret_cast<const char*>(indices.data()), entry.index_data_size);
+    }
+    return path;
+}
+
+} // unnamed namespace
+
+static void BM_TextureLoader(benchmark::State& state) {
+    const auto path = write_texture(static_cast<uint32_t>(state.range(0)));
+    auto loader = gleam::TextureLoader::Create();
+
+    for (auto _ : state) {
+        auto result = loader->Load(path);
+        if (!result) {
+            state.SkipWithError(result.error().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(result.value().get());
+    }
+
+    state.SetBytesProcessed(state.iterations() * fs::file_size(path));
+}
+
+static void BM_MeshLoader(benchmark::State& state) {
+    const auto path = write_mesh(
+        static_cast<uint32_t>(state.range(0)),
+        static_cast<uint32_t>(state.range(1))
+    );
+    auto loader = gleam::MeshLoader::Create();
+
+    for (auto _ : state) {
+        auto result = loader->Load(path);
+        if (!result) {
+            state.SkipWithError(result.error().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(result.value().get());
+    }
+
+    state.SetBytesProcessed(state.iterations() * fs::file_size(path));
+}
+
+BENCHMARK(BM_TextureLoader)->Arg(256)->Arg(1024)->Arg(2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MeshLoader)->Args({1, 65536})->Args({64, 4096})->Args({1024, 256})->Unit(benchmark::kMillisecond);
\ No newline at end of file
@@ -0,0 +1,71 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "utilities/mesh_codec.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace {
+
+constexpr auto stride = 8u;
+
+auto make_vertices(std::size_t count) {
+    auto vertices = std::vector<float> {};
+    vertices.reserve(count * stride);
+    for (auto i = std::size_t {0}; i < count; ++i) {
+        const auto t = static_cast<float>(i) * 0.001f;
+        vertices.insert(vertices.end(), {
+            std::cos(t), std::sin(t), t,
+            std::cos(t), std::sin(t), 0.0f,
+            t, 1.0f - t
+        });
+    }
+    return vertices;
+}
+
+} // unnamed namespace
+
+static void BM_MeshCodecEncode(benchmark::State& state) {
+    const auto vertices = make_vertices(static_cast<std::size_t>(state.range(0)));
+    const auto bytes = std::as_bytes(std::span {vertices});
+
+    auto encoded_size = std::size_t {0};
+    for (auto _ : state) {
+        auto encoded = gleam::encode_mesh_stream(bytes, stride);
+        encoded_size = encoded.size();
+        benchmark::DoNotOptimize(encoded.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+    state.counters["ratio"] = static_cast<double>(bytes.size()) / static_cast<double>(encoded_size);
+}
+
+static void BM_MeshCodecDecode(benchmark::State& state) {
+    const auto vertices = make_vertices(static_cast<std::size_t>(state.range(0)));
+    const auto encoded = gleam::encode_mesh_stream(std::as_bytes(std::span {vertices}), stride);
+    auto decoded = std::vector<float>(vertices.size());
+    const auto output = std::as_writable_bytes(std::span {decoded});
+
+    for (auto _ : state) {
+        if (!gleam::decode_mesh_stream(encoded, output, stride)) {
+            state.SkipWithError("Failed to decode mesh stream");
+            break;
+        }
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * output.size());
+}
+
+BENCHMARK(BM_MeshCodecEncode)->Arg(4096)->Arg(65536)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MeshCodecDecode)->Arg(4096)->Arg(65536)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
@@ -0,0 +1,68 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "utilities/texture_codec.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+constexpr auto size = 256u;
+
+auto make_image() {
+    auto rgba = std::vector<uint8_t> {};
+    rgba.reserve(size * size * 4);
+    for (auto y = 0u; y < size; ++y) {
+        for (auto x = 0u; x < size; ++x) {
+            const auto t = static_cast<float>(x + y) * 0.05f;
+            rgba.insert(rgba.end(), {
+                static_cast<uint8_t>(x),
+                static_cast<uint8_t>(y),
+                static_cast<uint8_t>(127.5f + 127.5f * std::sin(t)),
+                static_cast<uint8_t>(127.5f + 127.5f * std::cos(t * 0.5f))
+            });
+        }
+    }
+    return rgba;
+}
+
+} // unnamed namespace
+
+static void BM_TextureCodecEncode(benchmark::State& state) {
+    const auto image = make_image();
+    const auto format = static_cast<gleam::BlockFormat>(state.range(0));
+    const auto quality = static_cast<gleam::BlockQuality>(state.range(1));
+
+    for (auto _ : state) {
+        auto blocks = gleam::encode_blocks(image, size, size, format, quality);
+        benchmark::DoNotOptimize(blocks.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * image.size());
+}
+
+static void BM_TextureCodecDecode(benchmark::State& state) {
+    const auto image = make_image();
+    const auto format = static_cast<gleam::BlockFormat>(state.range(0));
+    const auto blocks = gleam::encode_blocks(image, size, size, format, gleam::BlockQuality::Fast);
+
+    for (auto _ : state) {
+        auto decoded = gleam::decode_blocks(blocks, size, size, format);
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * image.size());
+}
+
+// Arguments are the block format (BC1, BC3, BC7) and the quality (fast, high).
+BENCHMARK(BM_TextureCodecEncode)->ArgsProduct({{0, 1, 2}, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TextureCodecDecode)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
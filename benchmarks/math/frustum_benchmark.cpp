@@ -0,0 +1,114 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <gleam/cameras/perspective_camera.hpp>
+#include <gleam/math/box3.hpp>
+#include <gleam/math/frustum.hpp>
+#include <gleam/math/sphere.hpp>
+#include <gleam/math/vector3.hpp>
+
+#include <random>
+#include <vector>
+
+// Volumes are scattered around the camera so that roughly a third of them
+// fall inside the frustum and the early-out paths are exercised as well.
+
+namespace {
+
+constexpr auto kVolumeCount = 4096;
+
+auto make_camera() {
+    return gleam::PerspectiveCamera::Create({
+        .fov = 1.0f,
+        .aspect = 1.5f,
+        .near = 0.1f,
+        .far = 100.0f
+    });
+}
+
+auto make_frustum() {
+    auto camera = make_camera();
+    return gleam::Frustum {camera->projection_transform * camera->view_transform};
+}
+
+auto make_points() {
+    auto rng = std::mt19937 {7};
+    auto dist = std::uniform_real_distribution<float> {-50.0f, 50.0f};
+    auto output = std::vector<gleam::Vector3> {};
+    output.reserve(kVolumeCount);
+    for (auto i = 0; i < kVolumeCount; ++i) {
+        output.emplace_back(dist(rng), dist(rng), dist(rng));
+    }
+    return output;
+}
+
+} // unnamed namespace
+
+static void BM_FrustumSetWithViewProjection(benchmark::State& state) {
+    auto camera = make_camera();
+    const auto view_projection = camera->projection_transform * camera->view_transform;
+    auto frustum = gleam::Frustum {};
+
+    for (auto _ : state) {
+        frustum.SetWithViewProjection(view_projection);
+        benchmark::DoNotOptimize(frustum);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_FrustumContainsPoint(benchmark::State& state) {
+    const auto frustum = make_frustum();
+    const auto points = make_points();
+
+    for (auto _ : state) {
+        for (const auto& point : points) {
+            benchmark::DoNotOptimize(frustum.ContainsPoint(point));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * kVolumeCount);
+}
+
+static void BM_FrustumIntersectsWithSphere(benchmark::State& state) {
+    const auto frustum = make_frustum();
+    auto spheres = std::vector<gleam::Sphere> {};
+    for (const auto& point : make_points()) {
+        spheres.emplace_back(point, 1.0f);
+    }
+
+    for (auto _ : state) {
+        for (const auto& sphere : spheres) {
+            benchmark::DoNotOptimize(frustum.IntersectsWithSphere(sphere));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * kVolumeCount);
+}
+
+static void BM_FrustumIntersectsWithBox3(benchmark::State& state) {
+    const auto frustum = make_frustum();
+    auto boxes = std::vector<gleam::Box3> {};
+    for (const auto& point : make_points()) {
+        boxes.emplace_back(point - gleam::Vector3 {1.0f}, point + gleam::Vector3 {1.0f});
+    }
+
+    for (auto _ : state) {
+        for (const auto& box : boxes) {
+            benchmark::DoNotOptimize(frustum.IntersectsWithBox3(box));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * kVolumeCount);
+}
+
+BENCHMARK(BM_FrustumSetWithViewProjection);
+BENCHMARK(BM_FrustumContainsPoint);
+BENCHMARK(BM_FrustumIntersectsWithSphere);
+BENCHMARK(BM_FrustumIntersectsWithBox3);
\ No newline at end of file
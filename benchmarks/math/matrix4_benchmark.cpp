@@ -0,0 +1,85 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <gleam/math/matrix4.hpp>
+#include <gleam/math/transform3.hpp>
+#include <gleam/math/vector3.hpp>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr auto kMatrixCount = 1024;
+
+auto make_matrices() {
+    auto rng = std::mt19937 {42};
+    auto dist = std::uniform_real_distribution<float> {-10.0f, 10.0f};
+    auto output = std::vector<gleam::Matrix4> {};
+    output.reserve(kMatrixCount);
+
+    // Affine transforms are always invertible, which keeps Inverse on its
+    // common path instead of bailing out on a zero determinant.
+    for (auto i = 0; i < kMatrixCount; ++i) {
+        auto transform = gleam::Transform3 {};
+        transform.Translate({dist(rng), dist(rng), dist(rng)});
+        transform.Rotate({0.0f, 1.0f, 0.0f}, dist(rng));
+        transform.Scale({1.5f, 1.5f, 1.5f});
+        output.emplace_back(transform.Get());
+    }
+    return output;
+}
+
+} // unnamed namespace
+
+static void BM_Matrix4Multiply(benchmark::State& state) {
+    const auto matrices = make_matrices();
+    auto i = 0;
+
+    for (auto _ : state) {
+        const auto& a = matrices[i % kMatrixCount];
+        const auto& b = matrices[(i + 1) % kMatrixCount];
+        auto result = a * b;
+        benchmark::DoNotOptimize(result);
+        ++i;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Matrix4Inverse(benchmark::State& state) {
+    const auto matrices = make_matrices();
+    auto i = 0;
+
+    for (auto _ : state) {
+        auto result = gleam::Inverse(matrices[i % kMatrixCount]);
+        benchmark::DoNotOptimize(result);
+        ++i;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Matrix4MultiplyVector3(benchmark::State& state) {
+    const auto matrices = make_matrices();
+    auto point = gleam::Vector3 {1.0f, 2.0f, 3.0f};
+    auto i = 0;
+
+    for (auto _ : state) {
+        auto result = matrices[i % kMatrixCount] * point;
+        benchmark::DoNotOptimize(result);
+        ++i;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Matrix4Multiply);
+BENCHMARK(BM_Matrix4Inverse);
+BENCHMARK(BM_Matrix4MultiplyVector3);
\ No newline at end of file
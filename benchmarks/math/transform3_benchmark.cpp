@@ -0,0 +1,45 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <gleam/math/transform3.hpp>
+
+// Transform3::Get caches its matrix until the transform is touched, so the
+// two cases measure the cached read and the full recomposition separately.
+
+static void BM_Transform3GetCached(benchmark::State& state) {
+    auto transform = gleam::Transform3 {};
+    transform.Translate({1.0f, 2.0f, 3.0f});
+    transform.Rotate({0.0f, 1.0f, 0.0f}, 0.5f);
+    benchmark::DoNotOptimize(transform.Get());
+
+    for (auto _ : state) {
+        auto result = transform.Get();
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Transform3GetTouched(benchmark::State& state) {
+    auto transform = gleam::Transform3 {};
+    transform.Translate({1.0f, 2.0f, 3.0f});
+    transform.Rotate({0.0f, 1.0f, 0.0f}, 0.5f);
+    transform.Scale({2.0f, 2.0f, 2.0f});
+
+    for (auto _ : state) {
+        transform.touched = true;
+        auto result = transform.Get();
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Transform3GetCached);
+BENCHMARK(BM_Transform3GetTouched);
\ No newline at end of file
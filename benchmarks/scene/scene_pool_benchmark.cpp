@@ -0,0 +1,84 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <gleam/core/geometry.hpp>
+#include <gleam/core/object_pool.hpp>
+#include <gleam/materials/flat_material.hpp>
+#include <gleam/nodes/mesh.hpp>
+#include <gleam/nodes/node.hpp>
+#include <gleam/nodes/scene.hpp>
+
+#include <memory>
+#include <vector>
+
+// Compares scene construction and traversal with pooled allocation disabled
+// (arg 0) and enabled (arg 1). Cache misses can be reported alongside the
+// timings when Google Benchmark is built with libpfm, e.g.:
+//   bench_scene_pool_benchmark --benchmark_perf_counters=CYCLES,CACHE-MISSES
+
+namespace {
+
+constexpr auto kGroupCount = 1000;
+constexpr auto kMeshesPerGroup = 99;
+
+auto build_scene(const std::shared_ptr<gleam::Geometry>& geometry) {
+    auto scene = gleam::Scene::Create();
+    auto groups = std::vector<std::shared_ptr<gleam::Node>> {};
+    groups.reserve(kGroupCount);
+
+    for (auto i = 0; i < kGroupCount; ++i) {
+        auto group = gleam::Node::Create();
+        auto meshes = std::vector<std::shared_ptr<gleam::Node>> {};
+        meshes.reserve(kMeshesPerGroup);
+        for (auto j = 0; j < kMeshesPerGroup; ++j) {
+            auto mesh = gleam::Mesh::Create(geometry, gleam::FlatMaterial::Create());
+            mesh->transform.Translate({static_cast<float>(j), 0.0f, 0.0f});
+            meshes.emplace_back(mesh);
+        }
+        group->AddChildren(meshes);
+        groups.emplace_back(group);
+    }
+
+    scene->AddChildren(groups);
+    return scene;
+}
+
+} // unnamed namespace
+
+static void BM_BuildAndDestroyScene(benchmark::State& state) {
+    gleam::ObjectPools::SetEnabled(state.range(0) == 1);
+    auto geometry = gleam::Geometry::Create();
+
+    for (auto _ : state) {
+        auto scene = build_scene(geometry);
+        benchmark::DoNotOptimize(scene.get());
+        scene.reset();
+    }
+
+    gleam::ObjectPools::SetEnabled(false);
+    state.SetItemsProcessed(state.iterations() * kGroupCount * (kMeshesPerGroup + 1));
+}
+
+static void BM_TraverseScene(benchmark::State& state) {
+    gleam::ObjectPools::SetEnabled(state.range(0) == 1);
+    auto scene = build_scene(gleam::Geometry::Create());
+    gleam::ObjectPools::SetEnabled(false);
+
+    for (auto _ : state) {
+        // Touching the root forces the whole hierarchy to be recomputed.
+        scene->transform.Translate({0.0f, 0.0f, 0.0f});
+        scene->UpdateTransformHierarchy();
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * kGroupCount * (kMeshesPerGroup + 1));
+}
+
+BENCHMARK(BM_BuildAndDestroyScene)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TraverseScene)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
\ No newline at end of file
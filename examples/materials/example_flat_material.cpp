@@ -33,7 +33,8 @@ auto ExampleFlatMaterial::OnAttached() -> void {
         "assets/checker.tex",
         [this](auto result) {
             if (result) texture_ = result.value();
-        }
+        },
+        {.deliver_on_main_thread = true}
     );
 }
 
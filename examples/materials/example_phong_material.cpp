@@ -53,7 +53,8 @@ auto ExamplePhongMaterial::OnAttached() -> void {
         "assets/checker.tex",
         [this](auto result) {
             if (result) texture_ = result.value();
-        }
+        },
+        {.deliver_on_main_thread = true}
     );
 }
 
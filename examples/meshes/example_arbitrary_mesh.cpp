@@ -51,7 +51,8 @@ auto ExampleArbitraryMesh::OnAttached() -> void {
                 mesh_ = result.value();
                 Add(mesh_);
             }
-        }
+        },
+        {.deliver_on_main_thread = true}
     );
 }
 
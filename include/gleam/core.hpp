@@ -16,6 +16,8 @@
 #include "gleam/core/application_context_xyz.hpp"
 #include "gleam/core/fog.hpp"
 #include "gleam/core/geometry.hpp"
+#include "gleam/core/object_pool.hpp"
+#include "gleam/core/render_statistics.hpp"
 #include "gleam/core/renderer.hpp"
 #include "gleam/core/timer.hpp"
 #include "gleam/core/window.hpp"
\ No newline at end of file
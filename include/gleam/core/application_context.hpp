@@ -16,10 +16,14 @@
 #include "gleam/core/window.hpp"
 #include "gleam/nodes/scene.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace gleam {
 
+class FrameThread;
 class PerformanceGraph;
 
 /**
@@ -36,6 +40,10 @@ public:
         int antialiasing {4}; ///< Number of samples for multisampling.
         bool vsync {true}; ///< Enable vertical synchronization.
         bool debug {false}; ///< Render the performance graph.
+        bool pipelined {false}; ///< Update the next frame while the current one is submitted. Vertex and pixel data of uploaded resources must not be edited in place.
+        bool headless {false}; ///< Render offscreen without creating a window.
+        std::size_t upload_budget_bytes {0}; ///< Bytes uploaded to the GPU per frame, `0` for no limit.
+        double upload_budget_ms {0.0}; ///< Time spent on GPU uploads per frame, `0` for no limit.
     };
 
     /**
@@ -107,6 +115,13 @@ public:
      */
     auto SetClearColor(const Color& color) -> void;
 
+    /**
+     * @brief Reads back the pixels of the last rendered frame.
+     *
+     * @return RGBA8 pixels with rows ordered from top to bottom.
+     */
+    [[nodiscard]] auto ReadPixels() const -> std::vector<uint8_t>;
+
     /**
      * @brief Retrieves the shared context of the application.
      *
@@ -138,6 +153,9 @@ private:
     /// @brief The shared context propgated through the scene graph.
     std::unique_ptr<SharedContext> shared_context_ {nullptr};
 
+    /// @brief Runs the update of the next frame in pipelined mode.
+    std::unique_ptr<FrameThread> frame_thread_ {nullptr};
+
     /**
      * @brief Initializes the window.
      */
@@ -15,8 +15,11 @@
 #include "gleam/math/color.hpp"
 #include "gleam/nodes/scene.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace gleam {
 
@@ -30,6 +33,10 @@ public:
         int antialiasing {0};
         bool vsync {true};
         bool debug {false};
+        bool pipelined {false};
+        bool headless {false};
+        std::size_t upload_budget_bytes {0};
+        double upload_budget_ms {0.0};
 
         [[nodiscard]] auto Ratio() const -> float {
             return static_cast<float>(width) / static_cast<float>(height);
@@ -52,6 +59,8 @@ public:
 
     [[nodiscard]] auto GetCamera() const -> const Camera*;
 
+    [[nodiscard]] auto ReadPixels() const -> std::vector<uint8_t>;
+
     auto SetScene(std::shared_ptr<Scene> scene) -> void;
 
     auto SetCamera(std::shared_ptr<Camera> camera) -> void;
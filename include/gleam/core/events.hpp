@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 namespace gleam {
 
@@ -39,14 +40,18 @@ struct GLEAM_EXPORT Event {
 struct GLEAM_EXPORT SceneEvent : public Event {
     enum class Type {
         NodeAdded,
-        NodeRemoved
+        NodeRemoved,
+        NodesAdded
     };
 
-    std::shared_ptr<Node> node;
     SceneEvent::Type type;
+    std::shared_ptr<Node> node;
+    std::vector<std::shared_ptr<Node>> nodes;
 
     SceneEvent(Type type, std::shared_ptr<Node> node) : type(type), node(node) {}
 
+    SceneEvent(Type type, const std::vector<std::shared_ptr<Node>>& nodes) : type(type), nodes(nodes) {}
+
     auto GetType() const -> EventType override {
         return EventType::Scene;
     }
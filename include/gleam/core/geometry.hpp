@@ -10,12 +10,15 @@
 #include "gleam_export.h"
 #include "gleam/core/disposable.hpp"
 #include "gleam/core/identity.hpp"
+#include "gleam/core/residency.hpp"
 #include "gleam/math/box3.hpp"
 #include "gleam/math/sphere.hpp"
 #include "gleam/math/utilities.hpp"
 
+#include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace gleam {
@@ -59,6 +62,12 @@ public:
     /// @brief Renderer-specific identifier assigned by the graphics API
     unsigned int renderer_id = 0;
 
+    /// @brief What happens to the vertex and index data once it's uploaded.
+    ResidencyPolicy residency {ResidencyPolicy::Keep};
+
+    /// @brief Function that loads the data again after it's released.
+    using Reloader = std::function<std::shared_ptr<Geometry>()>;
+
     /**
      * @brief Default construction.
      */
@@ -89,12 +98,42 @@ public:
         return std::make_shared<Geometry>(vertex_data, index_data);
     }
 
+    /**
+     * @brief Creates a geometry that views vertex and index data owned by
+     * another object, such as a memory-mapped file, instead of copying it.
+     *
+     * The storage is kept alive for as long as the data is. These geometries
+     * default to ResidencyPolicy::ReleaseAfterUpload, so the views and the
+     * storage are dropped once the renderer has uploaded the data.
+     *
+     * @param vertex_data View of the vertex data.
+     * @param index_data View of the index data.
+     * @param storage Owner of the memory the views point into.
+     * @return std::shared_ptr<Geometry> A shared pointer to the newly created Geometry object.
+     */
+    [[nodiscard]] static auto Create(
+        std::span<const float> vertex_data,
+        std::span<const unsigned int> index_data,
+        std::shared_ptr<const void> storage
+    ) {
+        auto geometry = std::make_shared<Geometry>();
+        geometry->external_vertex_data_ = vertex_data;
+        geometry->external_index_data_ = index_data;
+        geometry->external_storage_ = std::move(storage);
+        geometry->external_ = true;
+        geometry->residency = ResidencyPolicy::ReleaseAfterUpload;
+        return geometry;
+    }
+
     /**
      * @brief Gets the vertex data of the geometry.
      *
-     * @return const std::vector<float>& A reference to the vector containing the vertex data.
+     * @return std::span<const float> A view of the vertex data, empty once released.
      */
-    [[nodiscard]] const auto& VertexData() const { return vertex_data_; }
+    [[nodiscard]] auto VertexData() const -> std::span<const float> {
+        if (external_) return external_vertex_data_;
+        return vertex_data_;
+    }
 
     /**
      * @brief Calculates the number of vertex elements.
@@ -106,16 +145,65 @@ public:
     /**
      * @brief Gets the number of indices in the geometry.
      *
-     * @return The size of the index data vector.
+     * @return The number of indices, which is kept after the data is released.
      */
-    [[nodiscard]] auto IndexCount() const -> size_t { return index_data_.size(); }
+    [[nodiscard]] auto IndexCount() const -> size_t {
+        if (released_) return released_index_size_;
+        return external_ ? external_index_data_.size() : index_data_.size();
+    }
 
     /**
      * @brief Gets the index data of the geometry.
      *
-     * @return const std::vector<unsigned int>& A reference to the vector containing the index data.
+     * @return std::span<const unsigned int> A view of the index data, empty once released.
+     */
+    [[nodiscard]] auto IndexData() const -> std::span<const unsigned int> {
+        if (external_) return external_index_data_;
+        return index_data_;
+    }
+
+    /**
+     * @brief Checks whether the geometry views data owned by external storage.
+     *
+     * @return bool True if the geometry was created over external storage.
      */
-    [[nodiscard]] const auto& IndexData() const { return index_data_; }
+    [[nodiscard]] auto IsExternal() const { return external_; }
+
+    /**
+     * @brief Releases the vertex and index data, and external storage if any.
+     *
+     * Bounds are computed before the data goes away so they stay available.
+     * The renderer calls this once the data has been uploaded, unless the
+     * residency policy is ResidencyPolicy::Keep.
+     */
+    auto ReleaseData() -> void;
+
+    /**
+     * @brief Checks whether the vertex and index data was released.
+     *
+     * @return bool True if the data was released and not reloaded since.
+     */
+    [[nodiscard]] auto IsReleased() const { return released_; }
+
+    /**
+     * @brief Sets the function used to reload released data.
+     *
+     * Loaders set this for geometries they create, so the data can be
+     * brought back with Reload() when the policy is ResidencyPolicy::ReloadOnDemand.
+     *
+     * @param reloader Function that returns a geometry with the same data.
+     */
+    auto SetReloader(Reloader reloader) { reloader_ = std::move(reloader); }
+
+    /**
+     * @brief Restores released data from its source.
+     *
+     * Must not be called while the renderer is preparing a frame that
+     * contains the geometry.
+     *
+     * @return bool True if the data is available after the call.
+     */
+    auto Reload() -> bool;
 
     /**
      * @brief Gets the attributes of the geometry.
@@ -192,6 +280,30 @@ protected:
     /// @brief The attributes of the geometry.
     std::vector<GeometryAttribute> attributes_;
 
+    /// @brief View of vertex data owned by external storage.
+    std::span<const float> external_vertex_data_;
+
+    /// @brief View of index data owned by external storage.
+    std::span<const unsigned int> external_index_data_;
+
+    /// @brief Keeps external data alive for as long as the views are used.
+    std::shared_ptr<const void> external_storage_;
+
+    /// @brief Whether the geometry views external data instead of its vectors.
+    bool external_ {false};
+
+    /// @brief Whether the data was released.
+    bool released_ {false};
+
+    /// @brief Size of the vertex data before it was released.
+    size_t released_vertex_size_ {0};
+
+    /// @brief Size of the index data before it was released.
+    size_t released_index_size_ {0};
+
+    /// @brief Loads the data again after it was released.
+    Reloader reloader_;
+
     /**
      * @brief Create and cache a Bounding Box object.
      */
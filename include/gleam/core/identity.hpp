@@ -22,7 +22,10 @@ public:
     /**
      * @brief Returns the unique identifier of the node.
      *
-     * @return const std::string& The unique identifier of the node.
+     * The identifier is a 128-bit integer that can be used as a hash key.
+     * Its string form is produced only when it is formatted.
+     *
+     * @return const math::UUID& The unique identifier of the node.
      */
     [[nodiscard]] const auto& UUID() const { return uuid_; }
 
@@ -42,7 +45,7 @@ public:
 
 private:
     /// @brief The unique identifier of the node.
-    std::string uuid_ {math::GenerateUUID()};
+    math::UUID uuid_ {math::UUID::Generate()};
 
     /// @brief The name of the node.
     std::string name_ {};
@@ -0,0 +1,255 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "gleam_export.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace gleam {
+
+/**
+ * @brief Occupancy statistics of a single object pool.
+ * @ingroup CoreGroup
+ */
+struct PoolStatistics {
+    std::string_view name; ///< Name of the pooled type.
+    std::size_t block_size {0}; ///< Size of a single block in bytes.
+    std::size_t slab_count {0}; ///< Number of slabs allocated by the pool.
+    std::size_t capacity {0}; ///< Number of blocks in all slabs.
+    std::size_t in_use {0}; ///< Number of blocks currently in use.
+    std::size_t peak_in_use {0}; ///< Highest number of blocks in use at once.
+};
+
+/**
+ * @brief Fixed-size block allocator that carves blocks out of larger slabs.
+ *
+ * Freed blocks are kept on an intrusive free list and reused by subsequent
+ * allocations, so objects of the same type end up packed in a small number of
+ * contiguous slabs. Slabs are retained for the lifetime of the program.
+ * Allocation and deallocation are thread-safe.
+ *
+ * @ingroup CoreGroup
+ */
+class GLEAM_EXPORT SlabPool {
+public:
+    /// @brief Number of blocks carved out of each slab.
+    static constexpr std::size_t kBlocksPerSlab = 256;
+
+    /**
+     * @brief Constructs a SlabPool object and registers it for statistics.
+     *
+     * @param name Name of the pooled type.
+     * @param block_size Size of a single block in bytes.
+     * @param alignment Alignment of a single block in bytes.
+     */
+    SlabPool(std::string_view name, std::size_t block_size, std::size_t alignment);
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool(SlabPool&&) = delete;
+    auto operator=(const SlabPool&) -> SlabPool& = delete;
+    auto operator=(SlabPool&&) -> SlabPool& = delete;
+
+    /**
+     * @brief Returns a block from the free list, allocating a new slab if needed.
+     *
+     * @return void* Pointer to an uninitialized block.
+     */
+    [[nodiscard]] auto Allocate() -> void*;
+
+    /**
+     * @brief Returns a block to the free list.
+     *
+     * @param block Pointer to a block previously returned by Allocate().
+     */
+    auto Deallocate(void* block) -> void;
+
+    /**
+     * @brief Returns the occupancy statistics of the pool.
+     *
+     * @return PoolStatistics
+     */
+    [[nodiscard]] auto Statistics() const -> PoolStatistics;
+
+    /**
+     * @brief Releases all slabs and unregisters the pool.
+     */
+    ~SlabPool();
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    mutable std::mutex mutex_;
+
+    std::vector<std::byte*> slabs_;
+
+    FreeBlock* free_list_ {nullptr};
+
+    std::string_view name_;
+
+    std::size_t block_size_ {0};
+    std::size_t alignment_ {0};
+    std::size_t in_use_ {0};
+    std::size_t peak_in_use_ {0};
+
+    auto AllocateSlab() -> void;
+};
+
+/**
+ * @brief Controls pooled allocation of scene objects.
+ *
+ * Pooled allocation is disabled by default. When enabled, factory methods such
+ * as `Node::Create()`, `Mesh::Create()` and the material `Create()` methods
+ * allocate their objects, together with the shared pointer control block, from
+ * per-type slab pools instead of the general heap. Objects created before the
+ * switch remain valid and are released through the allocator that created them.
+ *
+ * @code
+ * gleam::ObjectPools::SetEnabled(true);
+ *
+ * for (const auto& pool : gleam::ObjectPools::Statistics()) {
+ *   std::println("{}: {}/{}", pool.name, pool.in_use, pool.capacity);
+ * }
+ * @endcode
+ *
+ * @ingroup CoreGroup
+ */
+class GLEAM_EXPORT ObjectPools {
+public:
+    /**
+     * @brief Enables or disables pooled allocation for subsequently created objects.
+     *
+     * @param enabled Whether to allocate scene objects from pools.
+     */
+    static auto SetEnabled(bool enabled) -> void;
+
+    /**
+     * @brief Returns whether pooled allocation is enabled.
+     *
+     * @return bool
+     */
+    [[nodiscard]] static auto Enabled() -> bool;
+
+    /**
+     * @brief Returns the occupancy statistics of all pools created so far.
+     *
+     * @return std::vector<PoolStatistics>
+     */
+    [[nodiscard]] static auto Statistics() -> std::vector<PoolStatistics>;
+
+private:
+    /// @brief Pools register themselves on construction and unregister on destruction.
+    friend class SlabPool;
+
+    static auto Register(const SlabPool* pool) -> void;
+
+    static auto Unregister(const SlabPool* pool) -> void;
+};
+
+namespace detail {
+
+template <typename T>
+constexpr auto type_name() -> std::string_view {
+#if defined(_MSC_VER)
+    constexpr auto name = std::string_view {__FUNCSIG__};
+    constexpr auto start = name.find("type_name<") + 10;
+    constexpr auto end = name.rfind(">(void)");
+    auto result = name.substr(start, end - start);
+    for (auto prefix : {std::string_view {"class "}, std::string_view {"struct "}}) {
+        if (result.starts_with(prefix)) result.remove_prefix(prefix.size());
+    }
+    return result;
+#else
+    constexpr auto name = std::string_view {__PRETTY_FUNCTION__};
+    constexpr auto start = name.find("T = ") + 4;
+    constexpr auto end = name.find_first_of(";]", start);
+    return name.substr(start, end - start);
+#endif
+}
+
+}
+
+/**
+ * @brief Standard allocator backed by a SlabPool per type.
+ *
+ * The allocator is stateless. `Tag` survives rebinding and names the pool, so
+ * the control block allocated by `std::allocate_shared` is accounted to the
+ * type it manages.
+ *
+ * @tparam T Type of the allocated objects.
+ * @tparam Tag Type used to name the pool.
+ * @ingroup CoreGroup
+ */
+template <typename T, typename Tag = T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = PoolAllocator<U, Tag>;
+    };
+
+    PoolAllocator() noexcept = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U, Tag>&) noexcept {}
+
+    [[nodiscard]] auto allocate(std::size_t n) -> T* {
+        if (n != 1) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t {alignof(T)}));
+        }
+        return static_cast<T*>(Pool().Allocate());
+    }
+
+    auto deallocate(T* ptr, std::size_t n) noexcept -> void {
+        if (n != 1) {
+            ::operator delete(ptr, std::align_val_t {alignof(T)});
+            return;
+        }
+        Pool().Deallocate(ptr);
+    }
+
+    template <typename U>
+    auto operator==(const PoolAllocator<U, Tag>&) const noexcept { return true; }
+
+private:
+    static auto Pool() -> SlabPool& {
+        // The pool is intentionally leaked so objects that outlive static
+        // destruction can still be returned to it.
+        static auto pool = new SlabPool(detail::type_name<Tag>(), sizeof(T), alignof(T));
+        return *pool;
+    }
+};
+
+/**
+ * @brief Creates a shared object from its pool if pooled allocation is enabled,
+ * otherwise falls back to `std::make_shared`.
+ *
+ * @tparam T Type of the object to create.
+ * @param args Arguments forwarded to the constructor of `T`.
+ * @return std::shared_ptr<T>
+ * @ingroup CoreGroup
+ */
+template <typename T, typename... Args>
+[[nodiscard]] auto MakeShared(Args&&... args) -> std::shared_ptr<T> {
+    if (ObjectPools::Enabled()) {
+        return std::allocate_shared<T>(PoolAllocator<T> {}, std::forward<Args>(args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+
+namespace gleam {
+
+/**
+ * @brief Measurements collected by the renderer for a single frame.
+ *
+ * Stage timings are CPU times in milliseconds. The stages don't overlap, so
+ * their sum is the CPU time the renderer spent on the frame. In pipelined mode
+ * the preparation stages and the submission stages of a frame run on
+ * different ticks, but they are reported together once the frame is submitted.
+ *
+ * GPU timings come from timer queries that are read back a few frames after
+ * they're issued, so they lag behind the CPU timings of the same frame and
+ * stay at zero for the first frames.
+ *
+ * Counters describe the work submitted to the driver during the frame, while
+ * the memory fields are the totals held by the renderer at the end of it.
+ *
+ * @ingroup CoreGroup
+ */
+struct RenderStatistics {
+    double transform_update_ms {0.0}; ///< Updating world transforms and the camera view.
+    double render_lists_ms {0.0}; ///< Building and updating the render lists and the frame snapshot.
+    double culling_ms {0.0}; ///< Frustum culling and sorting draw commands.
+    double uniform_setup_ms {0.0}; ///< Setting and uploading per-draw uniforms.
+    double upload_ms {0.0}; ///< Uploading geometries and textures to the GPU.
+    double submission_ms {0.0}; ///< Issuing GL state changes and draws, excluding uploads and uniform setup.
+    double gpu_clear_ms {0.0}; ///< GPU time spent clearing the framebuffer.
+    double gpu_opaque_ms {0.0}; ///< GPU time spent on the opaque pass.
+    double gpu_transparent_ms {0.0}; ///< GPU time spent on the transparent pass.
+    double gpu_frame_ms {0.0}; ///< GPU time from the start of the clear to the end of the last pass.
+    std::size_t draw_calls {0}; ///< Number of draw calls.
+    std::size_t triangles {0}; ///< Number of triangles drawn.
+    std::size_t instanced_draws {0}; ///< Number of instanced draw calls.
+    std::size_t program_switches {0}; ///< Number of times a different shader program was bound.
+    std::size_t vao_binds {0}; ///< Number of vertex array binds.
+    std::size_t texture_binds {0}; ///< Number of texture binds.
+    std::size_t uniform_uploads {0}; ///< Number of individual uniforms uploaded.
+    std::size_t ubo_bytes_uploaded {0}; ///< Bytes written to uniform buffers.
+    std::size_t buffer_bytes_uploaded {0}; ///< Bytes of vertex and index data uploaded.
+    std::size_t texture_bytes_uploaded {0}; ///< Bytes of texture data uploaded.
+    std::size_t uploads_deferred {0}; ///< Geometries and textures left waiting for upload by the upload budget.
+    std::size_t culled_frustum {0}; ///< Meshes outside the camera frustum.
+    std::size_t culled_invalid_geometry {0}; ///< Meshes skipped because their geometry can't be rendered.
+    std::size_t culled_invalid_program {0}; ///< Meshes skipped because their shader program failed to build.
+    std::size_t culled_not_resident {0}; ///< Meshes skipped because their geometry hasn't been uploaded yet.
+    std::size_t buffer_memory_bytes {0}; ///< Vertex and index buffer memory held by the renderer.
+    std::size_t texture_memory_bytes {0}; ///< Texture memory held by the renderer.
+    std::size_t geometry_cpu_memory_bytes {0}; ///< Vertex and index data uploaded geometries still keep in system memory.
+    std::size_t texture_cpu_memory_bytes {0}; ///< Pixel data uploaded textures still keep in system memory.
+};
+
+}
\ No newline at end of file
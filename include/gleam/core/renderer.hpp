@@ -10,10 +10,14 @@
 #include "gleam_export.h"
 
 #include "gleam/cameras/camera.hpp"
+#include "gleam/core/render_statistics.hpp"
 #include "gleam/math/color.hpp"
 #include "gleam/nodes/scene.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace gleam {
 
@@ -28,6 +32,10 @@ public:
     struct Parameters {
         int width;  ///< The width of the rendering viewport.
         int height; ///< The height of the rendering viewport.
+        unsigned int worker_threads {0}; ///< Frame preparation threads, `0` uses the hardware threads minus one.
+        std::size_t upload_budget_bytes {0}; ///< Bytes uploaded to the GPU per frame, `0` for no limit.
+        double upload_budget_ms {0.0}; ///< Time spent on GPU uploads per frame, `0` for no limit.
+        bool offscreen {false}; ///< Render into an offscreen framebuffer instead of the window.
     };
 
     /**
@@ -45,6 +53,45 @@ public:
      */
     auto Render(Scene* scene, Camera* camera) -> void;
 
+    /**
+     * @brief Updates the scene and captures the state needed to render it.
+     *
+     * The state is written to the back snapshot and no GL calls are made, so
+     * this can run on a different thread than Submit(), concurrently with the
+     * submission of the previous frame.
+     *
+     * @param scene A pointer to the scene to be rendered.
+     * @param camera A pointer to the camera defining the viewpoint for rendering.
+     */
+    auto Prepare(Scene* scene, Camera* camera) -> void;
+
+    /**
+     * @brief Makes the last prepared snapshot the one to be submitted.
+     *
+     * Geometries and textures uploaded by the last Submit() are assigned
+     * their GPU ids here, and released data of the ones that are waiting to
+     * be uploaded is reloaded. Must not be called while Prepare() or Submit()
+     * are running.
+     */
+    auto SwapSnapshots() -> void;
+
+    /**
+     * @brief Renders the front snapshot.
+     *
+     * Must be called on the thread that owns the GL context. Render() is
+     * equivalent to calling Prepare(), SwapSnapshots() and Submit() in order,
+     * except that it draws the scene's materials instead of copying them.
+     *
+     * Resources that aren't on the GPU yet are uploaded before drawing, visible
+     * ones first and nearest first, until the upload budget is spent. At least
+     * one upload happens per frame. Meshes whose geometry is still waiting are
+     * skipped, and textures that are still waiting are drawn as white.
+     *
+     * Scene resources aren't modified, so the next frame can be prepared on
+     * another thread in the meantime.
+     */
+    auto Submit() -> void;
+
     /**
      * @brief Sets the color to clear the screen with.
      *
@@ -52,6 +99,17 @@ public:
      */
     auto SetClearColor(const Color& color) -> void;
 
+    /**
+     * @brief Reads back the pixels of the last rendered frame.
+     *
+     * When the renderer is offscreen the pixels are read from its framebuffer,
+     * otherwise from the window's back buffer, which is only valid until the
+     * buffers are swapped. This call waits for the GPU to finish rendering.
+     *
+     * @return RGBA8 pixels with rows ordered from top to bottom.
+     */
+    [[nodiscard]] auto ReadPixels() const -> std::vector<uint8_t>;
+
     /**
      * @brief Gets the number of objects rendered per frame.
      *
@@ -59,6 +117,24 @@ public:
      */
     [[nodiscard]] auto RenderedObjectsPerFrame() const -> size_t;
 
+    /**
+     * @brief Gets the statistics of the last submitted frame.
+     *
+     * @return const RenderStatistics& Stage timings and draw counters.
+     */
+    [[nodiscard]] auto Statistics() const -> const RenderStatistics&;
+
+    /**
+     * @brief Gets the statistics averaged over the last 60 submitted frames.
+     *
+     * Counters are rounded to the nearest integer. Averages smooth out the
+     * frame-to-frame noise of the counters, which makes them better suited for
+     * overlays and capacity planning than the values of a single frame.
+     *
+     * @return RenderStatistics Rolling averages of the stage timings and counters.
+     */
+    [[nodiscard]] auto AverageStatistics() const -> RenderStatistics;
+
     /**
      * @brief Destructor for the Renderer class.
      */
@@ -0,0 +1,28 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+namespace gleam {
+
+/**
+ * @brief Controls what happens to the CPU copy of a resource's data once the
+ * renderer has uploaded it to the GPU.
+ *
+ * Released data is dropped on the render thread between frames, so it's
+ * never pulled out from under a frame that is being prepared. Sizes and
+ * cached bounds outlive the data.
+ *
+ * @ingroup CoreGroup
+ */
+enum class ResidencyPolicy {
+    Keep,               ///< Keep the CPU copy for the lifetime of the resource.
+    ReleaseAfterUpload, ///< Drop the CPU copy once it's uploaded.
+    ReloadOnDemand      ///< Drop the CPU copy once it's uploaded, and reload it from its source when needed.
+};
+
+}
\ No newline at end of file
@@ -34,7 +34,8 @@ public:
     auto Start() -> void;
 
     /**
-     * @brief Returns the elapsed time in milliseconds.
+     * @brief Returns the elapsed time in milliseconds, including fractions
+     * of a millisecond.
      *
      * @return double The elapsed time in milliseconds,
      * or 0 if the timer has not been started.
@@ -34,6 +34,7 @@ public:
         int height;         ///< Height of the window in pixels.
         int antialiasing;   ///< Number of samples for multisampling.
         bool vsync;         ///< Enable vertical synchronization.
+        bool headless {false}; ///< Create an offscreen context without a visible window.
     };
 
     /**
@@ -12,5 +12,7 @@
  * @brief Classes for loading and importing external resources.
  */
 
+#include "gleam/loaders/archive.hpp"
+#include "gleam/loaders/load_queue.hpp"
 #include "gleam/loaders/texture_loader.hpp"
 #include "gleam/loaders/mesh_loader.hpp"
\ No newline at end of file
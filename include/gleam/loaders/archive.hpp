@@ -0,0 +1,81 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "gleam_export.h"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <string>
+
+namespace gleam {
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Packed asset archives that loaders read from in place of loose files.
+ *
+ * An archive is a single `.pak` file produced by the `asset_builder`
+ * (`asset_builder --pack -i <directory>`). It holds a table of contents sorted
+ * by path hash and the packed assets, each aligned so it can be viewed in
+ * place. Archives are memory-mapped when they're mounted, so every asset in
+ * them is opened without further system calls or copies.
+ *
+ * Once an archive is mounted, all loaders resolve paths against it before
+ * the file system, including textures referenced by meshes.
+ *
+ * @code
+ * gleam::Archive::Mount("assets.pak", "assets");
+ * auto mesh = loaders.Mesh->Load("assets/plane.msh");
+ * @endcode
+ *
+ * @ingroup LoadersGroup
+ */
+class GLEAM_EXPORT Archive {
+public:
+    /**
+     * @brief Maps an archive and makes its entries visible to all loaders.
+     *
+     * Archives mounted later take precedence over earlier ones.
+     *
+     * @param path File system path to the archive.
+     * @param mount_point Directory the entries appear under, e.g. "assets".
+     * @return std::expected<void, std::string> Error if the archive can't be
+     * opened or is malformed.
+     */
+    static auto Mount(
+        const fs::path& path,
+        const fs::path& mount_point = {}
+    ) -> std::expected<void, std::string>;
+
+    /**
+     * @brief Unmounts an archive. Assets already loaded from it stay valid.
+     *
+     * @param path File system path the archive was mounted from.
+     * @return bool False if the archive wasn't mounted.
+     */
+    static auto Unmount(const fs::path& path) -> bool;
+
+    /**
+     * @brief Checks whether a path resolves to an entry of a mounted archive.
+     *
+     * @param path Path to the asset, as passed to a loader.
+     * @return bool
+     */
+    [[nodiscard]] static auto Contains(const fs::path& path) -> bool;
+
+    /**
+     * @brief Returns the number of mounted archives.
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]] static auto MountCount() -> std::size_t;
+};
+
+}
\ No newline at end of file
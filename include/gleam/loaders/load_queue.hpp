@@ -0,0 +1,167 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "gleam_export.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace gleam {
+
+class WorkerPool;
+
+/**
+ * @brief Order in which queued loads are picked up by the load queue.
+ *
+ * @ingroup LoadersGroup
+ */
+enum class LoadPriority {
+    Low,
+    Normal,
+    High
+};
+
+/**
+ * @brief Shared flag used to cancel one or more asynchronous loads.
+ *
+ * Copies of a token share the same state, so a single token can be passed
+ * to several loads and cancel all of them at once. Loads that haven't
+ * started when the token is cancelled are skipped, and callbacks of
+ * cancelled loads are never invoked.
+ *
+ * @ingroup LoadersGroup
+ */
+class GLEAM_EXPORT CancellationToken {
+public:
+    /**
+     * @brief Cancels every load that shares this token.
+     */
+    auto Cancel() const {
+        cancelled_->store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Checks whether the token has been cancelled.
+     *
+     * @return bool
+     */
+    [[nodiscard]] auto IsCancelled() const {
+        return cancelled_->load(std::memory_order_acquire);
+    }
+
+private:
+    /// @brief Cancellation state shared between copies.
+    std::shared_ptr<std::atomic<bool>> cancelled_ {
+        std::make_shared<std::atomic<bool>>(false)
+    };
+};
+
+/**
+ * @brief Options for asynchronous loads.
+ *
+ * @ingroup LoadersGroup
+ */
+struct LoadOptions {
+    /// @brief Priority of the load in the load queue.
+    LoadPriority priority {LoadPriority::Normal};
+
+    /// @brief Token used to cancel the load.
+    CancellationToken token {};
+
+    /// @brief Deliver the callback from LoadQueue::DispatchCallbacks instead
+    /// of the worker thread that performed the load.
+    bool deliver_on_main_thread {false};
+};
+
+/**
+ * @brief Bounded pool of worker threads shared by all loaders.
+ *
+ * Asynchronous loads are queued by priority and run on a small, fixed number
+ * of threads, so issuing many loads at once doesn't oversubscribe the system.
+ * Callbacks that should run on the main thread are held until
+ * `DispatchCallbacks` is called, which application contexts do at the start
+ * of every frame, before the scene is updated.
+ *
+ * @ingroup LoadersGroup
+ */
+class GLEAM_EXPORT LoadQueue {
+public:
+    /// @brief Upper bound on the number of worker threads.
+    static constexpr unsigned int kMaxThreads = 4;
+
+    /**
+     * @brief Returns the load queue shared by all loaders.
+     *
+     * @return LoadQueue&
+     */
+    [[nodiscard]] static auto Get() -> LoadQueue&;
+
+    LoadQueue(const LoadQueue&) = delete;
+    LoadQueue(LoadQueue&&) = delete;
+    auto operator=(const LoadQueue&) -> LoadQueue& = delete;
+    auto operator=(LoadQueue&&) -> LoadQueue& = delete;
+
+    /**
+     * @brief Queues a task to run on one of the worker threads.
+     *
+     * @param task Function to run.
+     * @param priority Priority of the task.
+     */
+    auto Submit(std::function<void()> task, LoadPriority priority) -> void;
+
+    /**
+     * @brief Queues a callback to run on the next call to `DispatchCallbacks`.
+     *
+     * @param callback Function to run.
+     */
+    auto PostToMainThread(std::function<void()> callback) -> void;
+
+    /**
+     * @brief Runs the callbacks queued with `PostToMainThread` on the calling
+     * thread. Callbacks queued while dispatching run on the next call.
+     *
+     * @return std::size_t Number of callbacks that were run.
+     */
+    auto DispatchCallbacks() -> std::size_t;
+
+    /**
+     * @brief Returns the number of worker threads.
+     *
+     * @return unsigned int
+     */
+    [[nodiscard]] auto ThreadCount() const -> unsigned int;
+
+    /**
+     * @brief Stops and joins the worker threads.
+     */
+    ~LoadQueue();
+
+private:
+    /// @brief Worker threads that run the loads.
+    std::unique_ptr<WorkerPool> pool_;
+
+    /// @brief Callbacks waiting for the main thread.
+    std::vector<std::function<void()>> callbacks_;
+
+    /// @brief Mutex guarding the pending callbacks.
+    std::mutex callbacks_mutex_;
+
+    /**
+     * @brief Constructs a LoadQueue object and starts the worker threads.
+     *
+     * **Marked private** to enforce access through `Get()`.
+     */
+    LoadQueue();
+};
+
+}
\ No newline at end of file
@@ -9,12 +9,16 @@
 
 #include "gleam_export.h"
 
+#include "gleam/loaders/archive.hpp"
+#include "gleam/loaders/load_queue.hpp"
+
+#include <chrono>
 #include <expected>
 #include <filesystem>
 #include <functional>
+#include <future>
 #include <memory>
 #include <string>
-#include <thread>
 
 namespace gleam {
 
@@ -26,6 +30,83 @@ using LoaderResult = std::expected<std::shared_ptr<T>, std::string>;
 template <typename T>
 using LoaderCallback = std::function<void(LoaderResult<T>)>;
 
+/**
+ * @brief Handle to an asynchronous load.
+ *
+ * The handle becomes ready once the load has finished and its callback has
+ * either run or been queued for the main thread. Handles are cheap to copy
+ * and can be discarded if the result is delivered through the callback.
+ *
+ * @tparam T Resource type being loaded.
+ * @ingroup LoadersGroup
+ */
+template <typename T>
+class LoadHandle {
+public:
+    /**
+     * @brief Constructs an empty handle.
+     */
+    LoadHandle() = default;
+
+    /**
+     * @brief Constructs a handle for a queued load.
+     *
+     * @param future Future that receives the result of the load.
+     * @param token Token used to cancel the load.
+     */
+    LoadHandle(std::shared_future<LoaderResult<T>> future, CancellationToken token)
+      : future_(std::move(future)), token_(std::move(token)) {}
+
+    /**
+     * @brief Cancels the load. Has no effect on the result if the load has
+     * already started, but its callback won't be invoked.
+     */
+    auto Cancel() const { token_.Cancel(); }
+
+    /**
+     * @brief Checks whether the load has been cancelled.
+     *
+     * @return bool
+     */
+    [[nodiscard]] auto IsCancelled() const { return token_.IsCancelled(); }
+
+    /**
+     * @brief Checks whether the handle refers to a load.
+     *
+     * @return bool
+     */
+    [[nodiscard]] auto IsValid() const { return future_.valid(); }
+
+    /**
+     * @brief Checks whether the result is available without blocking.
+     *
+     * @return bool
+     */
+    [[nodiscard]] auto IsReady() const {
+        return future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    /**
+     * @brief Blocks until the result is available.
+     */
+    auto Wait() const { future_.wait(); }
+
+    /**
+     * @brief Blocks until the result is available and returns it. Loads that
+     * were cancelled before they started return an error.
+     *
+     * @return const LoaderResult<T>&
+     */
+    [[nodiscard]] auto Get() const -> const LoaderResult<T>& { return future_.get(); }
+
+private:
+    /// @brief Future that receives the result of the load.
+    std::shared_future<LoaderResult<T>> future_;
+
+    /// @brief Token used to cancel the load.
+    CancellationToken token_;
+};
+
 /**
  * @brief **Abstract** base class for loading resources from the file system.
  *
@@ -42,7 +123,8 @@ class GLEAM_EXPORT Loader : public std::enable_shared_from_this<Loader<Resource>
 public:
     /**
      * @brief Loads a resource synchronously from the specified file path. This
-     * method verifies that the file exists before attempting to load.
+     * method verifies that the file exists, in a mounted Archive or on the
+     * file system, before attempting to load.
      * If the file is missing or an error occurs during loading, an error
      * message is returned via `std::unexpected`.
      *
@@ -51,7 +133,7 @@ public:
      * to the loaded resource, or an error string.
      */
     auto Load(const fs::path& path) const -> LoaderResult<Resource> {
-        if (!fs::exists(path)) {
+        if (!Archive::Contains(path) && !fs::exists(path)) {
             const auto message = "File not found '" + path.string() + "'";
             return std::unexpected(message);
         }
@@ -61,25 +143,60 @@ public:
 
     /**
      * @brief Loads a resource asynchronously from the specified file path.
-     * The result is delivered to the provided callback on a background thread.
-     * File existence is verified before loading. This implementation currently
-     * spawns a detached thread and should be updated to use a thread pool
-     * for better control and efficiency.
+     *
+     * The load is queued on the shared LoadQueue and runs on one of its
+     * worker threads, ordered by `options.priority`. The result is delivered
+     * to the callback on that worker thread, or on the main thread during
+     * `LoadQueue::DispatchCallbacks` if `options.deliver_on_main_thread` is
+     * set. Callbacks of cancelled loads are not invoked.
      *
      * @param path File system path to the resource.
-     * @param callback Callback that receives the result of the loading operation.
+     * @param callback Callback that receives the result of the loading
+     * operation. May be empty if the result is read through the handle.
+     * @param options Priority, cancellation and delivery options.
+     * @return LoadHandle<Resource> Handle to wait on or cancel the load.
      */
-    auto LoadAsync(const fs::path& path, LoaderCallback<Resource> callback) const {
-        if (!fs::exists(path)) {
-            const auto message = "File not found '" + path.string() + "'";
-            callback(std::unexpected(message));
-        }
+    auto LoadAsync(
+        const fs::path& path,
+        LoaderCallback<Resource> callback,
+        const LoadOptions& options = {}
+    ) const -> LoadHandle<Resource> {
+        auto promise = std::make_shared<std::promise<LoaderResult<Resource>>>();
+        auto handle = LoadHandle<Resource> {promise->get_future().share(), options.token};
 
         auto self = this->shared_from_this();
-        std::thread([self, path, callback]() {
-            auto result = self->LoadImpl(path);
-            callback(result);
-        }).detach();
+        LoadQueue::Get().Submit([self, path, callback, options, promise]() {
+            const auto& token = options.token;
+            auto result = token.IsCancelled()
+                ? LoaderResult<Resource> {std::unexpected("Load cancelled '" + path.string() + "'")}
+                : self->Load(path);
+
+            if (callback && !token.IsCancelled()) {
+                if (options.deliver_on_main_thread) {
+                    LoadQueue::Get().PostToMainThread([callback, result, token]() {
+                        if (!token.IsCancelled()) callback(result);
+                    });
+                } else {
+                    callback(result);
+                }
+            }
+
+            promise->set_value(std::move(result));
+        }, options.priority);
+
+        return handle;
+    }
+
+    /**
+     * @brief Loads a resource asynchronously without a callback. The result
+     * is read through the returned handle.
+     *
+     * @param path File system path to the resource.
+     * @param options Priority and cancellation options.
+     * @return LoadHandle<Resource> Handle to wait on or cancel the load.
+     */
+    auto LoadAsync(const fs::path& path, const LoadOptions& options = {}) const {
+        return LoadAsync(path, nullptr, options);
     }
 
     /**
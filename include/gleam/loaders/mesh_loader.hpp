@@ -9,19 +9,68 @@
 
 #include "gleam_export.h"
 
+#include "gleam/core/residency.hpp"
 #include "gleam/loaders/loader.hpp"
 
+#include <cstddef>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <string>
 
 namespace gleam {
 
+class Mesh;
 class Node;
 
 namespace fs = std::filesystem;
 
 using MeshCallback = std::function<void(std::shared_ptr<Node>)>;
 
+/**
+ * @brief Progress of a streaming mesh load, reported once per mesh entry.
+ *
+ * @ingroup LoadersGroup
+ */
+struct MeshStreamProgress {
+    /// @brief Mesh that was just attached to the root node.
+    std::shared_ptr<Mesh> mesh;
+
+    /// @brief Number of entries attached so far, including this one.
+    std::size_t loaded {0};
+
+    /// @brief Number of entries in the file.
+    std::size_t total {0};
+};
+
+/**
+ * @brief Options for streaming mesh loads.
+ *
+ * @ingroup LoadersGroup
+ */
+struct MeshStreamOptions {
+    /// @brief Upper bound on entries that have been read but not yet attached.
+    std::size_t max_in_flight {4};
+
+    /// @brief Priority of the reads in the load queue.
+    LoadPriority priority {LoadPriority::Normal};
+
+    /// @brief Token used to stop the stream. Entries that haven't been
+    /// attached when it's cancelled are dropped.
+    CancellationToken token {};
+
+    /// @brief Called after each entry is attached to the root node.
+    std::function<void(const MeshStreamProgress&)> on_progress {};
+
+    /// @brief Called once every entry is attached and every texture applied,
+    /// including files that have no entries. Not called if the stream fails
+    /// or is cancelled.
+    std::function<void()> on_complete {};
+
+    /// @brief Called if an entry fails to load, which ends the stream.
+    std::function<void(const std::string&)> on_error {};
+};
+
 /**
  * @brief Loads mesh data from engine-optimized `.msh` files.
  *
@@ -45,31 +94,90 @@ using MeshCallback = std::function<void(std::shared_ptr<Node>)>;
  * auto MyNode::OnAttached() -> void override {
  *   this->Context()->Loaders().Mesh->LoadAsync(
  *     "assets/my_model.msh",
- *     [this](auto result) { this->Add(result.value()); }
+ *     [this](auto result) { this->Add(result.value()); },
+ *     {.deliver_on_main_thread = true}
  *   );
  * }
  * @endcode
  *
+ * Large files with many entries can be loaded with `LoadStreaming`, which
+ * returns the root node right away and attaches each mesh as it's read.
+ *
+ * Geometries keep their data by default. A loader created with
+ * `.residency = ResidencyPolicy::ReloadOnDemand` lets the renderer drop
+ * their data after upload, and maps it again from the file when needed.
+ *
  * @ingroup LoadersGroup
  */
 class GLEAM_EXPORT MeshLoader : public Loader<Node> {
 public:
+    /// @brief Parameters for constructing a MeshLoader object.
+    struct Parameters {
+        /// @brief Residency policy of the loaded geometries.
+        ResidencyPolicy residency {ResidencyPolicy::Keep};
+    };
+
     /**
      * @brief Creates a shared pointer to a MeshLoader object.
      *
      * @return std::shared_ptr<MeshLoader>
      */
     [[nodiscard]] static auto Create() -> std::shared_ptr<MeshLoader> {
-        return std::shared_ptr<MeshLoader>(new MeshLoader());
+        return Create(Parameters {});
+    }
+
+    /**
+     * @brief Creates a shared pointer to a MeshLoader object.
+     *
+     * @param params MeshLoader::Parameters
+     * @return std::shared_ptr<MeshLoader>
+     */
+    [[nodiscard]] static auto Create(const Parameters& params) -> std::shared_ptr<MeshLoader> {
+        return std::shared_ptr<MeshLoader>(new MeshLoader(params));
     }
 
+    /**
+     * @brief Loads a mesh file progressively.
+     *
+     * The header is validated and an empty root node is returned right
+     * away. Entries are then read on the load queue, and each mesh is
+     * attached to the root node during `LoadQueue::DispatchCallbacks`, on the
+     * main thread, so the root can be added to the scene immediately. At most
+     * `options.max_in_flight` entries are read ahead of the ones attached.
+     * Meshes don't wait for textures, their materials are untextured until
+     * each texture is loaded and applied, also on the main thread.
+     *
+     * @code
+     * auto MyNode::OnAttached() -> void override {
+     *   auto root = this->Context()->Loaders().Mesh->LoadStreaming(
+     *     "assets/city.msh",
+     *     {.on_progress = [this](const auto& p) { progress_ = float(p.loaded) / p.total; }}
+     *   );
+     *   if (root) this->Add(root.value());
+     * }
+     * @endcode
+     *
+     * @param path File system path to the mesh file.
+     * @param options Read-ahead, priority, cancellation and progress options.
+     * @return LoaderResult<Node> Root node the meshes are attached to, or an
+     * error if the file can't be opened or isn't a valid mesh file.
+     */
+    [[nodiscard]] auto LoadStreaming(
+        const fs::path& path,
+        const MeshStreamOptions& options = {}
+    ) const -> LoaderResult<Node>;
+
 private:
+    Parameters params_;
+
     /**
      * @brief Constructs a MeshLoader object.
      *
      * **Marked private** to enforce creation through the `Create()` factory method.
+     *
+     * @param params MeshLoader::Parameters
      */
-    MeshLoader() = default;
+    explicit MeshLoader(const Parameters& params) : params_(params) {}
 
     /**
      * @brief Loads mesh data from engine-optimized `.msh` files.
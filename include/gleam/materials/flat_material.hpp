@@ -56,7 +56,7 @@ public:
      * @return std::shared_ptr<FlatMaterial>
      */
     [[nodiscard]] static auto Create(const Color& color = 0xFFFFFF) {
-        return std::make_shared<FlatMaterial>(color);
+        return MakeShared<FlatMaterial>(color);
     }
 
     /**
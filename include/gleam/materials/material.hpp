@@ -10,6 +10,7 @@
 #include "gleam_export.h"
 
 #include "gleam/core/identity.hpp"
+#include "gleam/core/object_pool.hpp"
 #include "gleam/math/color.hpp"
 
 #include <memory>
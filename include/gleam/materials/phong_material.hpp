@@ -64,7 +64,7 @@ public:
      * @return std::shared_ptr<PhongMaterial>
      */
     [[nodiscard]] static auto Create(const Color& color = 0xFFFFFF) {
-        return std::make_shared<PhongMaterial>(color);
+        return MakeShared<PhongMaterial>(color);
     }
 
     /**
@@ -91,7 +91,7 @@ public:
         std::string_view fragment_shader,
         const std::unordered_map<std::string, UniformValue>& uniforms
     ) {
-        return std::make_shared<ShaderMaterial>(vertex_shader, fragment_shader, uniforms);
+        return MakeShared<ShaderMaterial>(vertex_shader, fragment_shader, uniforms);
     }
 
     /**
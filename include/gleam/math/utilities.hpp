@@ -10,6 +10,9 @@
 #include "gleam_export.h"
 
 #include <cmath>
+#include <compare>
+#include <cstdint>
+#include <functional>
 #include <string>
 
 namespace gleam::math {
@@ -51,6 +54,39 @@ constexpr float epsilon = 1e-6f;
     return std::lerp(a, b, f);
 }
 
+/**
+ * @brief A 128-bit universally unique identifier (version 4).
+ *
+ * The identifier is stored as two integers and is cheap to generate, copy,
+ * compare and hash. The canonical string form is produced only on demand.
+ */
+struct GLEAM_EXPORT UUID {
+    /// @brief The most significant 64 bits.
+    uint64_t hi {0};
+
+    /// @brief The least significant 64 bits.
+    uint64_t lo {0};
+
+    /**
+     * @brief Generates a random version 4 UUID. This function is thread-safe.
+     *
+     * @return UUID A new identifier.
+     */
+    [[nodiscard]] static auto Generate() -> UUID;
+
+    /**
+     * @brief Formats the identifier as `xxxxxxxx-xxxx-4xxx-yxxx-xxxxxxxxxxxx`.
+     *
+     * @return std::string The canonical string form of the identifier.
+     */
+    [[nodiscard]] auto ToString() const -> std::string;
+
+    /**
+     * @brief Compares two identifiers.
+     */
+    auto operator<=>(const UUID&) const = default;
+};
+
 /**
  * @brief Generates a UUID.
  *
@@ -58,4 +94,12 @@ constexpr float epsilon = 1e-6f;
  */
 [[nodiscard]] GLEAM_EXPORT auto GenerateUUID() -> std::string;
 
-}
\ No newline at end of file
+}
+
+template <>
+struct std::hash<gleam::math::UUID> {
+    auto operator()(const gleam::math::UUID& uuid) const noexcept -> std::size_t {
+        // Both halves are random, so folding them is enough for a hash key.
+        return static_cast<std::size_t>(uuid.hi ^ uuid.lo);
+    }
+};
\ No newline at end of file
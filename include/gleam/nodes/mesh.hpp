@@ -51,7 +51,7 @@ public:
         std::shared_ptr<Geometry> geometry,
         std::shared_ptr<Material> material
     ) {
-        return std::make_shared<Mesh>(geometry, material);
+        return MakeShared<Mesh>(geometry, material);
     }
 
     /**
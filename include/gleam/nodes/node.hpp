@@ -9,6 +9,7 @@
 
 #include "gleam_export.h"
 #include "gleam/core/identity.hpp"
+#include "gleam/core/object_pool.hpp"
 #include "gleam/core/shared_context.hpp"
 #include "gleam/math/matrix4.hpp"
 #include "gleam/math/transform3.hpp"
@@ -20,6 +21,7 @@
 namespace gleam {
 
 // Forward declarations
+class Scene;
 struct KeyboardEvent;
 struct MouseEvent;
 
@@ -58,6 +60,17 @@ public:
      */
     auto Add(const std::shared_ptr<Node>& node) -> void;
 
+    /**
+     * @brief Adds multiple child nodes to this node in a single batch.
+     *
+     * Unlike calling Add() for each node, a single scene event is dispatched
+     * for the whole batch, so an active scene attaches the new subtrees in one
+     * pass and marks its render lists as dirty only once.
+     *
+     * @param nodes A vector of shared pointers to the nodes to add.
+     */
+    auto AddChildren(const std::vector<std::shared_ptr<Node>>& nodes) -> void;
+
     /**
      * @brief Removes a child node from this node.
      *
@@ -80,6 +93,9 @@ public:
     /**
      * @brief Checks if the specified node is a child of this node.
      *
+     * The check walks up the parent chain of the specified node, so its cost
+     * is bounded by the depth of the node rather than the size of the graph.
+     *
      * @param node A pointer to the node to check.
      * @return True if the node is a child of this node, otherwise false.
      */
@@ -169,7 +185,7 @@ public:
      * @return A `std::shared_ptr<Node>` pointing to the newly created instance.
      */
     [[nodiscard]] static auto Create() {
-        return std::make_shared<Node>();
+        return MakeShared<Node>();
     }
 
     /**
@@ -275,6 +291,9 @@ private:
     /// @brief The scene sets the node's shared context.
     friend class Scene;
 
+    /// @brief The render lists read world transforms from worker threads.
+    friend class RenderLists;
+
     /// @brief List of child nodes.
     std::vector<std::shared_ptr<Node>> children_;
 
@@ -284,6 +303,9 @@ private:
     /// @brief Pointer to the parent node.
     Node* parent_ {nullptr};
 
+    /// @brief Cached pointer to the scene that contains this node.
+    Scene* scene_ {nullptr};
+
     /// @brief Node's world transformation.
     Matrix4 world_transform_ {1.0f};
 
@@ -294,18 +316,21 @@ private:
      * @brief Recursively attaches the node and its children to the shared context.
      *
      * This method is called when the node is added to a scene. It ensures that the
-     * shared context is propagated to the node and all of its child nodes.
+     * shared context and the owning scene are propagated to the node and all of
+     * its child nodes.
      *
      * @param context A pointer to the shared context to attach to the node and its children.
+     * @param scene A pointer to the scene that contains the node.
      */
-    auto AttachRecursive(SharedContext* context) -> void;
+    auto AttachRecursive(SharedContext* context, Scene* scene) -> void;
 
     /**
      * @brief Recursively detaches the node and its children from the shared context.
      *
      * This method is called when the node is removed from a scene. It ensures that the
      * shared context is cleared for the node and all of its child nodes, effectively
-     * disconnecting them from the scene's shared resources.
+     * disconnecting them from the scene's shared resources. The cached scene
+     * pointer is cleared as well.
      */
     auto DetachRecursive() -> void;
 };
@@ -11,6 +11,7 @@
 
 #include "gleam/core/disposable.hpp"
 #include "gleam/core/identity.hpp"
+#include "gleam/core/residency.hpp"
 
 namespace gleam {
 
@@ -22,6 +23,21 @@ enum class TextureType {
     Texture2D
 };
 
+/**
+ * @brief Represents pixel formats of texture data.
+ *
+ * Block-compressed formats store 4x4 texel blocks. Renderers that can't
+ * sample them decompress the blocks when the texture is uploaded.
+ *
+ * @ingroup TexturesGroup
+ */
+enum class TextureFormat {
+    RGBA8, ///< Four 8-bit channels per texel.
+    BC1, ///< 8 bytes per block, opaque RGB.
+    BC3, ///< 16 bytes per block, RGB with interpolated alpha.
+    BC7 ///< 16 bytes per block, RGBA with higher precision.
+};
+
 /**
  * @brief **Abstract** base class for texture objects.
  *
@@ -35,6 +51,9 @@ public:
     /// @brief Renderer-specific identifier assigned by the graphics API
     unsigned int renderer_id = 0;
 
+    /// @brief What happens to the pixel data once it's uploaded.
+    ResidencyPolicy residency {ResidencyPolicy::Keep};
+
     /**
      * @brief Returns texture type.
      *
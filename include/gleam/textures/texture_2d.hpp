@@ -12,7 +12,12 @@
 #include "gleam/math/transform2.hpp"
 #include "gleam/textures/texture.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace gleam {
 
@@ -41,14 +46,25 @@ public:
     /// @brief Height in pixels.
     unsigned height;
 
-    /// @brief Underlying texture data.
+    /// @brief Number of mip levels in `data`, starting with the full-size level.
+    unsigned mip_levels {1};
+
+    /// @brief Pixel format of `data`.
+    TextureFormat format {TextureFormat::RGBA8};
+
+    /// @brief Underlying texture data, the mip levels stored back to back.
     std::vector<uint8_t> data {};
 
+    /// @brief Function that loads the pixel data again after it's released.
+    using Reloader = std::function<std::vector<uint8_t>()>;
+
     /// @brief Parameters for constructing a texture2D object.
     struct Parameters {
         unsigned width; ///< Width in pixels.
         unsigned height; ///< Height in pixels.
         std::vector<uint8_t> data; ///< Underlying texture data.
+        unsigned mip_levels {1}; ///< Number of mip levels in the data.
+        TextureFormat format {TextureFormat::RGBA8}; ///< Pixel format of the data.
     };
 
     /**
@@ -59,6 +75,8 @@ public:
     explicit Texture2D(const Parameters& params) :
         width(params.width),
         height(params.height),
+        mip_levels(params.mip_levels),
+        format(params.format),
         data(std::move(params.data)) {}
 
     /**
@@ -80,6 +98,103 @@ public:
         return TextureType::Texture2D;
     }
 
+    /**
+     * @brief Returns the width of a mip level.
+     *
+     * @param level Mip level, 0 being the full-size level.
+     * @return unsigned Width in pixels.
+     */
+    [[nodiscard]] auto LevelWidth(unsigned level) const { return std::max(width >> level, 1u); }
+
+    /**
+     * @brief Returns the height of a mip level.
+     *
+     * @param level Mip level, 0 being the full-size level.
+     * @return unsigned Height in pixels.
+     */
+    [[nodiscard]] auto LevelHeight(unsigned level) const { return std::max(height >> level, 1u); }
+
+    /**
+     * @brief Returns the size of an image in the given format.
+     *
+     * Block-compressed images are rounded up to whole 4x4 blocks.
+     *
+     * @param format Pixel format.
+     * @param width Width in pixels.
+     * @param height Height in pixels.
+     * @return std::size_t Size in bytes.
+     */
+    [[nodiscard]] static auto ImageSize(TextureFormat format, unsigned width, unsigned height) -> std::size_t {
+        const auto blocks = static_cast<std::size_t>((width + 3) / 4) * ((height + 3) / 4);
+        switch (format) {
+            case TextureFormat::BC1: return blocks * 8;
+            case TextureFormat::BC3:
+            case TextureFormat::BC7: return blocks * 16;
+            default: return static_cast<std::size_t>(width) * height * 4;
+        }
+    }
+
+    /**
+     * @brief Returns the size of the pixel data of a mip level.
+     *
+     * @param level Mip level, 0 being the full-size level.
+     * @return std::size_t Size in bytes.
+     */
+    [[nodiscard]] auto LevelSize(unsigned level) const {
+        return ImageSize(format, LevelWidth(level), LevelHeight(level));
+    }
+
+    /**
+     * @brief Returns the size of the pixel data of all mip levels.
+     *
+     * @return std::size_t Size in bytes.
+     */
+    [[nodiscard]] auto DataSize() const {
+        auto size = std::size_t {0};
+        for (auto level = 0u; level < mip_levels; ++level) size += LevelSize(level);
+        return size;
+    }
+
+    /**
+     * @brief Releases the pixel data. Width and height stay valid.
+     *
+     * The renderer calls this once the data has been uploaded, unless the
+     * residency policy is ResidencyPolicy::Keep.
+     */
+    auto ReleaseData() {
+        data = {};
+        released_ = true;
+    }
+
+    /**
+     * @brief Checks whether the pixel data was released.
+     *
+     * @return bool True if the data was released and not reloaded since.
+     */
+    [[nodiscard]] auto IsReleased() const { return released_; }
+
+    /**
+     * @brief Sets the function used to reload released pixel data.
+     *
+     * @param reloader Function that returns the pixel data.
+     */
+    auto SetReloader(Reloader reloader) { reloader_ = std::move(reloader); }
+
+    /**
+     * @brief Restores released pixel data from its source.
+     *
+     * @return bool True if the data is available after the call.
+     */
+    auto Reload() {
+        if (!released_) return true;
+        if (!reloader_) return false;
+        auto pixels = reloader_();
+        if (pixels.size() != DataSize()) return false;
+        data = std::move(pixels);
+        released_ = false;
+        return true;
+    }
+
     /**
      * @brief Returns the transformation matrix for UV mapping.
      *
@@ -120,6 +235,12 @@ public:
 private:
     /// @brief UV transformation matrix.
     Transform2 transform_;
+
+    /// @brief Loads the pixel data again after it was released.
+    Reloader reloader_;
+
+    /// @brief Whether the pixel data was released.
+    bool released_ {false};
 };
 
 }
\ No newline at end of file
@@ -7,8 +7,12 @@
 
 #include "gleam/core/application_context.hpp"
 
+#include "gleam/loaders/load_queue.hpp"
+
+#include "core/frame_thread.hpp"
 #include "utilities/logger.hpp"
 #include "utilities/performance_graph.hpp"
+#include "utilities/profiler.hpp"
 
 namespace gleam {
 
@@ -55,37 +59,82 @@ auto ApplicationContext::Start() -> void {
         return;
     }
 
+    if (params.pipelined) {
+        frame_thread_ = std::make_unique<FrameThread>();
+    }
+
     timer.Start();
 
     window_->Start([this]() {
         static auto last_frame_time = 0.0;
         static auto last_frame_rate_update = 0.0;
         static auto frame_time_ms = 0.0;
+        static auto latency_ms = 0.0;
+        static auto submitted_update_time = 0.0;
         static unsigned int frame_count = 0;
 
+        GLEAM_PROFILE_FRAME();
         const auto now = timer.GetElapsedSeconds();
         const auto delta = static_cast<float>(now - last_frame_time);
 
         last_frame_time = now;
         frame_count++;
 
+        // Loads that deliver on the main thread complete before the update.
+        // In pipelined mode the previous update has been joined by now, so
+        // callbacks are free to modify the scene.
+        LoadQueue::Get().DispatchCallbacks();
+
         // update the performance graph every second
         if (now - last_frame_rate_update >= 1.0) {
             using enum PerformanceMetric;
             performance_graph_->AddData(FramesPerSecond, frame_count);
             performance_graph_->AddData(FrameTime, frame_time_ms);
             performance_graph_->AddData(RenderedObjects, renderer_->RenderedObjectsPerFrame());
+            performance_graph_->AddData(Latency, latency_ms);
+            performance_graph_->AddData(GPUTime, renderer_->Statistics().gpu_frame_ms);
+            performance_graph_->SetStatistics(renderer_->AverageStatistics());
             frame_count = 0;
             last_frame_rate_update = now;
         }
 
-        if (Update(delta)) {
+        if (params.pipelined) {
+            // The update of the next frame runs on the frame thread while the
+            // previous frame is submitted. Its snapshot is swapped in once both
+            // are done, so it's presented on the next tick.
+            const auto start_time = timer.GetElapsedMilliseconds();
+            frame_thread_->Run([this, delta] {
+                if (!Update(delta)) return false;
+                scene_->ProcessUpdates(delta);
+                renderer_->Prepare(scene_.get(), camera_.get());
+                return true;
+            });
+            renderer_->Submit();
+            const auto submit_time = timer.GetElapsedMilliseconds();
+            const auto running = frame_thread_->Wait();
+            renderer_->SwapSnapshots();
+            const auto end_time = timer.GetElapsedMilliseconds();
+
+            frame_time_ms = end_time - start_time;
+            latency_ms = submit_time - submitted_update_time;
+            submitted_update_time = start_time;
+
+            if (!running) {
+                window_->Break();
+                return;
+            }
+
+            if (params.debug) {
+                performance_graph_->RenderGraph(static_cast<float>(params.width));
+            }
+        } else if (Update(delta)) {
             const auto start_time = timer.GetElapsedMilliseconds();
             scene_->ProcessUpdates(delta);
             renderer_->Render(scene_.get(), camera_.get());
             const auto end_time = timer.GetElapsedMilliseconds();
 
             frame_time_ms = end_time - start_time;
+            latency_ms = frame_time_ms;
 
             if (params.debug) {
                 performance_graph_->RenderGraph(static_cast<float>(params.width));
@@ -101,7 +150,8 @@ auto ApplicationContext::InitializeWindow() -> bool {
         .width = params.width,
         .height = params.height,
         .antialiasing = params.antialiasing,
-        .vsync = params.vsync
+        .vsync = params.vsync,
+        .headless = params.headless
     };
     window_ = std::make_unique<Window>(window_params);
     return window_->HasErrors() ? false : true;
@@ -110,7 +160,10 @@ auto ApplicationContext::InitializeWindow() -> bool {
 auto ApplicationContext::InitializeRenderer() -> bool {
     const auto renderer_params = Renderer::Parameters {
         .width = window_->Width(),
-        .height = window_->Height()
+        .height = window_->Height(),
+        .upload_budget_bytes = params.upload_budget_bytes,
+        .upload_budget_ms = params.upload_budget_ms,
+        .offscreen = params.headless
     };
     renderer_ = std::make_unique<Renderer>(renderer_params);
     return true;
@@ -133,6 +186,10 @@ auto ApplicationContext::SetClearColor(const Color& color) -> void {
     renderer_->SetClearColor(color);
 }
 
+auto ApplicationContext::ReadPixels() const -> std::vector<uint8_t> {
+    return renderer_->ReadPixels();
+}
+
 auto ApplicationContext::Context() const -> const SharedContext* {
     if (shared_context_ == nullptr) {
         Logger::Log(LogLevel::Error,
@@ -10,8 +10,11 @@
 #include "gleam/cameras/perspective_camera.hpp"
 #include "gleam/core/renderer.hpp"
 #include "gleam/core/window.hpp"
+#include "gleam/loaders/load_queue.hpp"
 
+#include "core/frame_thread.hpp"
 #include "utilities/performance_graph.hpp"
+#include "utilities/profiler.hpp"
 
 namespace gleam {
 
@@ -22,6 +25,7 @@ struct ApplicationContextXYZ::Impl {
     std::unique_ptr<Window> window;
     std::unique_ptr<Renderer> renderer;
     std::unique_ptr<SharedContext> shared_context;
+    std::unique_ptr<FrameThread> frame_thread;
 
     Impl() {
         performance_graph = std::make_unique<PerformanceGraph>();
@@ -32,7 +36,8 @@ struct ApplicationContextXYZ::Impl {
             .width = params.width,
             .height = params.height,
             .antialiasing = params.antialiasing,
-            .vsync = params.vsync
+            .vsync = params.vsync,
+            .headless = params.headless
         };
         window = std::make_unique<Window>(window_params);
         window->SetTitle(params.title);
@@ -50,7 +55,10 @@ struct ApplicationContextXYZ::Impl {
     auto InitializeRenderer(const ApplicationContextXYZ::Parameters& params) -> bool {
         const auto renderer_params = Renderer::Parameters {
             .width = window->Width(),
-            .height = window->Height()
+            .height = window->Height(),
+            .upload_budget_bytes = params.upload_budget_bytes,
+            .upload_budget_ms = params.upload_budget_ms,
+            .offscreen = params.headless
         };
         renderer = std::make_unique<Renderer>(renderer_params);
         renderer->SetClearColor(params.clear_color);
@@ -86,37 +94,82 @@ auto ApplicationContextXYZ::CreateDefaultCamera() const -> std::shared_ptr<Camer
 auto ApplicationContextXYZ::Start() -> void {
     Setup();
 
+    if (params.pipelined) {
+        impl_->frame_thread = std::make_unique<FrameThread>();
+    }
+
     timer.Start();
 
     impl_->window->Start([this]() {
         static auto last_frame_time = 0.0;
         static auto last_frame_rate_update = 0.0;
         static auto frame_time_ms = 0.0;
+        static auto latency_ms = 0.0;
+        static auto submitted_update_time = 0.0;
         static unsigned int frame_count = 0;
 
+        GLEAM_PROFILE_FRAME();
         const auto now = timer.GetElapsedSeconds();
         const auto delta = static_cast<float>(now - last_frame_time);
 
         last_frame_time = now;
         frame_count++;
 
+        // Loads that deliver on the main thread complete before the update.
+        // In pipelined mode the previous update has been joined by now, so
+        // callbacks are free to modify the scene.
+        LoadQueue::Get().DispatchCallbacks();
+
         // update the performance graph every second
         if (now - last_frame_rate_update >= 1.0) {
             using enum PerformanceMetric;
             impl_->performance_graph->AddData(FramesPerSecond, frame_count);
             impl_->performance_graph->AddData(FrameTime, frame_time_ms);
             impl_->performance_graph->AddData(RenderedObjects, impl_->renderer->RenderedObjectsPerFrame());
+            impl_->performance_graph->AddData(Latency, latency_ms);
+            impl_->performance_graph->AddData(GPUTime, impl_->renderer->Statistics().gpu_frame_ms);
+            impl_->performance_graph->SetStatistics(impl_->renderer->AverageStatistics());
             frame_count = 0;
             last_frame_rate_update = now;
         }
 
-        if (Update(delta)) {
+        if (params.pipelined) {
+            // The update of the next frame runs on the frame thread while the
+            // previous frame is submitted. Its snapshot is swapped in once both
+            // are done, so it's presented on the next tick.
+            const auto start_time = timer.GetElapsedMilliseconds();
+            impl_->frame_thread->Run([this, delta] {
+                if (!Update(delta)) return false;
+                impl_->scene->ProcessUpdates(delta);
+                impl_->renderer->Prepare(impl_->scene.get(), impl_->camera.get());
+                return true;
+            });
+            impl_->renderer->Submit();
+            const auto submit_time = timer.GetElapsedMilliseconds();
+            const auto running = impl_->frame_thread->Wait();
+            impl_->renderer->SwapSnapshots();
+            const auto end_time = timer.GetElapsedMilliseconds();
+
+            frame_time_ms = end_time - start_time;
+            latency_ms = submit_time - submitted_update_time;
+            submitted_update_time = start_time;
+
+            if (!running) {
+                impl_->window->Break();
+                return;
+            }
+
+            if (params.debug) {
+                impl_->performance_graph->RenderGraph(static_cast<float>(params.width));
+            }
+        } else if (Update(delta)) {
             const auto start_time = timer.GetElapsedMilliseconds();
             impl_->scene->ProcessUpdates(delta);
             impl_->renderer->Render(impl_->scene.get(), impl_->camera.get());
             const auto end_time = timer.GetElapsedMilliseconds();
 
             frame_time_ms = end_time - start_time;
+            latency_ms = frame_time_ms;
 
             if (params.debug) {
                 impl_->performance_graph->RenderGraph(static_cast<float>(params.width));
@@ -135,6 +188,10 @@ auto ApplicationContextXYZ::GetCamera() const -> const Camera* {
     return impl_->camera.get();
 }
 
+auto ApplicationContextXYZ::ReadPixels() const -> std::vector<uint8_t> {
+    return impl_->renderer->ReadPixels();
+}
+
 auto ApplicationContextXYZ::SetScene(std::shared_ptr<Scene> scene) -> void {
     impl_->scene = scene;
     impl_->scene->SetContext(impl_->shared_context.get());
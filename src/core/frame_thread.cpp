@@ -0,0 +1,62 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "core/frame_thread.hpp"
+
+#include "utilities/profiler.hpp"
+
+namespace gleam {
+
+FrameThread::FrameThread() : thread_([this]{ Work(); }) {}
+
+auto FrameThread::Run(Task task) -> void {
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        task_ = std::move(task);
+        done_ = false;
+    }
+    condition_.notify_all();
+}
+
+auto FrameThread::Wait() -> bool {
+    auto lock = std::unique_lock(mutex_);
+    condition_.wait(lock, [this]{ return done_; });
+    return result_;
+}
+
+auto FrameThread::Work() -> void {
+    GLEAM_PROFILE_THREAD("Frame update");
+    while (true) {
+        auto task = Task {};
+        {
+            auto lock = std::unique_lock(mutex_);
+            condition_.wait(lock, [this]{ return stop_ || task_ != nullptr; });
+            if (task_ == nullptr) return;
+            task = std::move(task_);
+            task_ = nullptr;
+        }
+
+        const auto result = task();
+        {
+            const auto lock = std::scoped_lock(mutex_);
+            result_ = result;
+            done_ = true;
+        }
+        condition_.notify_all();
+    }
+}
+
+FrameThread::~FrameThread() {
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    thread_.join();
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace gleam {
+
+/**
+ * @brief A persistent thread that runs one frame's work at a time.
+ *
+ * Pipelined application contexts hand the update of the next frame to this
+ * thread every tick, instead of paying for a new thread per frame.
+ */
+class FrameThread {
+public:
+    using Task = std::function<bool()>;
+
+    /**
+     * @brief Constructs a FrameThread object and starts its thread.
+     */
+    FrameThread();
+
+    FrameThread(const FrameThread&) = delete;
+    FrameThread(FrameThread&&) = delete;
+    auto operator=(const FrameThread&) -> FrameThread& = delete;
+    auto operator=(FrameThread&&) -> FrameThread& = delete;
+
+    /**
+     * @brief Hands a task over to the thread.
+     *
+     * The previous task must have been waited on.
+     *
+     * @param task Function to run.
+     */
+    auto Run(Task task) -> void;
+
+    /**
+     * @brief Waits for the task handed over by Run() to finish.
+     *
+     * @return The result of the task.
+     */
+    auto Wait() -> bool;
+
+    /**
+     * @brief Waits for the current task, then stops and joins the thread.
+     */
+    ~FrameThread();
+
+private:
+    Task task_;
+
+    bool result_ {false};
+
+    bool done_ {true};
+
+    bool stop_ {false};
+
+    std::mutex mutex_;
+
+    std::condition_variable condition_;
+
+    std::thread thread_;
+
+    auto Work() -> void;
+};
+
+}
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <numeric>
 
 namespace gleam {
@@ -28,10 +29,49 @@ auto Geometry::HasAttribute(GeometryAttributeType type) const -> bool {
 }
 
 auto Geometry::VertexCount() const -> size_t {
-    if (vertex_data_.empty() || attributes_.empty() || Stride() == 0) {
+    // Sizes are kept when the data is released, so the count survives it.
+    const auto size = released_ ? released_vertex_size_ : VertexData().size();
+    if (size == 0 || attributes_.empty() || Stride() == 0) {
         return 0;
     }
-    return vertex_data_.size() / Stride();
+    return size / Stride();
+}
+
+auto Geometry::ReleaseData() -> void {
+    if (released_) return;
+    if (HasAttribute(GeometryAttributeType::Position) && VertexCount() > 0) {
+        static_cast<void>(BoundingSphere());
+    }
+
+    released_vertex_size_ = VertexData().size();
+    released_index_size_ = IndexData().size();
+    released_ = true;
+
+    vertex_data_ = {};
+    index_data_ = {};
+    external_vertex_data_ = {};
+    external_index_data_ = {};
+    external_storage_.reset();
+}
+
+auto Geometry::Reload() -> bool {
+    if (!released_) return true;
+    if (!reloader_) return false;
+
+    auto source = reloader_();
+    if (source == nullptr || source->VertexData().size() != released_vertex_size_) {
+        Logger::Log(LogLevel::Error, "Failed to reload geometry data {}", *this);
+        return false;
+    }
+
+    vertex_data_ = std::move(source->vertex_data_);
+    index_data_ = std::move(source->index_data_);
+    external_vertex_data_ = source->external_vertex_data_;
+    external_index_data_ = source->external_index_data_;
+    external_storage_ = std::move(source->external_storage_);
+    external_ = source->external_;
+    released_ = false;
+    return true;
 }
 
 auto Geometry::Stride() const -> size_t {
@@ -60,12 +100,13 @@ auto Geometry::CreateBoundingBox() -> void {
     }
 
     bounding_box_ = Box3 {};
+    const auto vertex_data = VertexData();
     auto stride = Stride();
-    for (auto i = 0; i < vertex_data_.size(); i += stride) {
+    for (auto i = std::size_t {0}; i < vertex_data.size(); i += stride) {
         bounding_box_->ExpandWithPoint({
-            vertex_data_[i],
-            vertex_data_[i + 1],
-            vertex_data_[i + 2]
+            vertex_data[i],
+            vertex_data[i + 1],
+            vertex_data[i + 2]
         });
     }
 }
@@ -78,13 +119,14 @@ auto Geometry::CreateBoundingSphere() -> void {
     }
 
     auto center = BoundingBox().Center();
+    const auto vertex_data = VertexData();
     auto stride = Stride();
     auto max_distance_squared = 0.0f;
-    for (auto i = 0; i < vertex_data_.size(); i += stride) {
+    for (auto i = std::size_t {0}; i < vertex_data.size(); i += stride) {
         auto point = Vector3 {
-            vertex_data_[i],
-            vertex_data_[i + 1],
-            vertex_data_[i + 2]
+            vertex_data[i],
+            vertex_data[i + 1],
+            vertex_data[i + 2]
         };
 
         max_distance_squared = std::max(
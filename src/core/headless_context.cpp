@@ -0,0 +1,136 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "core/headless_context.hpp"
+
+#include "utilities/logger.hpp"
+
+#include <glad/glad.h>
+
+#ifdef GLEAM_USE_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <string_view>
+#endif
+
+namespace gleam {
+
+#ifdef GLEAM_USE_EGL
+
+namespace {
+
+auto has_extension(const char* extensions, std::string_view name) {
+    if (extensions == nullptr) return false;
+    auto list = std::string_view {extensions};
+    for (auto pos = list.find(name); pos != std::string_view::npos; pos = list.find(name, pos + 1)) {
+        const auto end = pos + name.size();
+        const auto starts = pos == 0 || list[pos - 1] == ' ';
+        const auto ends = end == list.size() || list[end] == ' ';
+        if (starts && ends) return true;
+    }
+    return false;
+}
+
+auto get_display() -> EGLDisplay {
+    // Prefer the surfaceless platform, which doesn't need a display server.
+    const auto extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (has_extension(extensions, "EGL_MESA_platform_surfaceless")) {
+        auto get_platform_display = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT")
+        );
+        if (get_platform_display) {
+            auto display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if (display != EGL_NO_DISPLAY) return display;
+        }
+    }
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+}
+
+HeadlessContext::HeadlessContext() {
+    auto display = get_display();
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
+        Logger::Log(LogLevel::Error, "Failed to initialize an EGL display {:#x}", eglGetError());
+        return;
+    }
+    display_ = display;
+
+    if (!has_extension(eglQueryString(display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context")) {
+        Logger::Log(LogLevel::Error, "The EGL display doesn't support surfaceless contexts");
+        return;
+    }
+
+    // Rendering goes to framebuffer objects, so the config only has to
+    // support desktop OpenGL. Surfaceless displays only expose pbuffer configs.
+    const EGLint config_attributes[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+
+    auto config = EGLConfig {};
+    auto num_configs = EGLint {0};
+    if (!eglChooseConfig(display, config_attributes, &config, 1, &num_configs) || num_configs == 0) {
+        Logger::Log(LogLevel::Error, "No EGL config supports desktop OpenGL");
+        return;
+    }
+
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        Logger::Log(LogLevel::Error, "Failed to bind the OpenGL API {:#x}", eglGetError());
+        return;
+    }
+
+    const EGLint context_attributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 1,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+
+    auto context = eglCreateContext(display, config, EGL_NO_CONTEXT, context_attributes);
+    if (context == EGL_NO_CONTEXT) {
+        Logger::Log(LogLevel::Error, "Failed to create an EGL context {:#x}", eglGetError());
+        return;
+    }
+    context_ = context;
+
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+        Logger::Log(LogLevel::Error, "Failed to make the EGL context current {:#x}", eglGetError());
+        return;
+    }
+
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress)) {
+        Logger::Log(LogLevel::Error, "Failed to initialize GLAD OpenGL loader");
+        return;
+    }
+
+    Logger::Log(LogLevel::Info, "Renderer: {}", reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+    Logger::Log(LogLevel::Info, "Version: {}", reinterpret_cast<const char*>(glGetString(GL_VERSION)));
+
+    initialized_ = true;
+}
+
+HeadlessContext::~HeadlessContext() {
+    if (display_ == nullptr) return;
+    eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (context_) eglDestroyContext(display_, context_);
+    eglTerminate(display_);
+}
+
+#else
+
+HeadlessContext::HeadlessContext() {
+    Logger::Log(LogLevel::Error, "Headless rendering requires EGL, which wasn't found at build time");
+}
+
+HeadlessContext::~HeadlessContext() = default;
+
+#endif
+
+}
\ No newline at end of file
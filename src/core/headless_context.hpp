@@ -0,0 +1,55 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+namespace gleam {
+
+/**
+ * @brief OpenGL context that isn't attached to a window.
+ *
+ * The context is created through EGL on a surfaceless display, which is
+ * available on Mesa (including the llvmpipe software rasterizer) and on
+ * NVIDIA drivers, so it works on machines without a display server or GPU.
+ * There is no default framebuffer, so the renderer must be created with
+ * `Renderer::Parameters::offscreen` set.
+ */
+class HeadlessContext {
+public:
+    /**
+     * @brief Creates the context and makes it current on the calling thread.
+     */
+    HeadlessContext();
+
+    HeadlessContext(const HeadlessContext&) = delete;
+    HeadlessContext(HeadlessContext&&) = delete;
+    auto operator=(const HeadlessContext&) -> HeadlessContext& = delete;
+    auto operator=(HeadlessContext&&) -> HeadlessContext& = delete;
+
+    /**
+     * @brief Checks whether the context was created and its functions loaded.
+     *
+     * @return bool
+     */
+    [[nodiscard]] auto IsValid() const { return initialized_; }
+
+    /**
+     * @brief Releases the context and terminates the display.
+     */
+    ~HeadlessContext();
+
+private:
+    /// @brief EGL display handle.
+    void* display_ {nullptr};
+
+    /// @brief EGL context handle.
+    void* context_ {nullptr};
+
+    bool initialized_ {false};
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "gleam/core/object_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+namespace gleam {
+
+namespace {
+
+std::atomic<bool> pooling_enabled {false};
+
+auto registry_mutex() -> std::mutex& {
+    static auto mutex = new std::mutex();
+    return *mutex;
+}
+
+auto registry() -> std::vector<const SlabPool*>& {
+    static auto pools = new std::vector<const SlabPool*>();
+    return *pools;
+}
+
+} // unnamed namespace
+
+SlabPool::SlabPool(std::string_view name, std::size_t block_size, std::size_t alignment)
+  : name_(name),
+    block_size_(std::max(block_size, sizeof(FreeBlock))),
+    alignment_(std::max(alignment, alignof(FreeBlock))) {
+    // Round the block size up so every block in a slab stays aligned.
+    block_size_ = (block_size_ + alignment_ - 1) / alignment_ * alignment_;
+    ObjectPools::Register(this);
+}
+
+auto SlabPool::Allocate() -> void* {
+    const auto lock = std::scoped_lock(mutex_);
+    if (free_list_ == nullptr) AllocateSlab();
+
+    auto block = free_list_;
+    free_list_ = block->next;
+    peak_in_use_ = std::max(peak_in_use_, ++in_use_);
+    return block;
+}
+
+auto SlabPool::Deallocate(void* block) -> void {
+    const auto lock = std::scoped_lock(mutex_);
+    auto free_block = static_cast<FreeBlock*>(block);
+    free_block->next = free_list_;
+    free_list_ = free_block;
+    --in_use_;
+}
+
+auto SlabPool::AllocateSlab() -> void {
+    auto slab = static_cast<std::byte*>(::operator new(
+        block_size_ * kBlocksPerSlab,
+        std::align_val_t {alignment_}
+    ));
+    slabs_.emplace_back(slab);
+
+    // Thread blocks in reverse so allocations walk the slab front to back.
+    for (auto i = kBlocksPerSlab; i > 0; --i) {
+        auto block = reinterpret_cast<FreeBlock*>(slab + (i - 1) * block_size_);
+        block->next = free_list_;
+        free_list_ = block;
+    }
+}
+
+auto SlabPool::Statistics() const -> PoolStatistics {
+    const auto lock = std::scoped_lock(mutex_);
+    return {
+        .name = name_,
+        .block_size = block_size_,
+        .slab_count = slabs_.size(),
+        .capacity = slabs_.size() * kBlocksPerSlab,
+        .in_use = in_use_,
+        .peak_in_use = peak_in_use_
+    };
+}
+
+SlabPool::~SlabPool() {
+    ObjectPools::Unregister(this);
+    for (auto slab : slabs_) {
+        ::operator delete(slab, std::align_val_t {alignment_});
+    }
+}
+
+auto ObjectPools::SetEnabled(bool enabled) -> void {
+    pooling_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+auto ObjectPools::Enabled() -> bool {
+    return pooling_enabled.load(std::memory_order_relaxed);
+}
+
+auto ObjectPools::Statistics() -> std::vector<PoolStatistics> {
+    const auto lock = std::scoped_lock(registry_mutex());
+    auto output = std::vector<PoolStatistics> {};
+    output.reserve(registry().size());
+    for (const auto pool : registry()) {
+        output.emplace_back(pool->Statistics());
+    }
+    return output;
+}
+
+auto ObjectPools::Register(const SlabPool* pool) -> void {
+    const auto lock = std::scoped_lock(registry_mutex());
+    registry().emplace_back(pool);
+}
+
+auto ObjectPools::Unregister(const SlabPool* pool) -> void {
+    const auto lock = std::scoped_lock(registry_mutex());
+    std::erase(registry(), pool);
+}
+
+}
\ No newline at end of file
@@ -20,6 +20,8 @@ struct ProgramAttributes {
         unsigned int directional {0};
         unsigned int point {0};
         unsigned int spot {0};
+
+        auto operator==(const LightsCounter&) const -> bool = default;
     };
 
     std::size_t key {0};
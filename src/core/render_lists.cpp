@@ -7,6 +7,12 @@
 
 #include "core/render_lists.hpp"
 
+#include "gleam/materials/flat_material.hpp"
+#include "gleam/materials/phong_material.hpp"
+
+#include "utilities/logger.hpp"
+#include "utilities/profiler.hpp"
+
 #include <ranges>
 #include <limits>
 
@@ -17,27 +23,78 @@ const auto& compare = [](auto* mesh) {
     return mesh->transform.GetPosition().z;
 };
 
+namespace {
+
+// Number of proxies updated by a single job.
+constexpr auto kProxiesPerJob = std::size_t {512};
+
+// Returns the reason a geometry can't be rendered, or an empty string.
+auto validate_geometry(Geometry* geometry) -> std::string_view {
+    if (geometry == nullptr) return "no geometry";
+    if (geometry->Disposed()) return "disposed geometry";
+    if (geometry->Attributes().empty()) return "no geometry attributes";
+    // Counts are used rather than the data, which is gone once it's released.
+    if (geometry->VertexCount() == 0) return "no geometry data";
+    return {};
+}
+
+// Packs the material and scene state the program attributes depend on, so
+// they're only recomputed when it changes.
+auto program_state(const Material* material, const Scene* scene) -> uint32_t {
+    auto textured = false;
+    if (material->GetType() == MaterialType::FlatMaterial) {
+        textured = static_cast<const FlatMaterial*>(material)->texture_map != nullptr;
+    }
+    if (material->GetType() == MaterialType::PhongMaterial) {
+        textured = static_cast<const PhongMaterial*>(material)->texture_map != nullptr;
+    }
+
+    return (textured ? 1u : 0u) |
+        (material->flat_shaded ? 2u : 0u) |
+        (material->two_sided ? 4u : 0u) |
+        (material->fog ? 8u : 0u) |
+        (scene->fog != nullptr ? 16u : 0u);
+}
+
+}
+
 auto RenderLists::ProcessScene(Scene* scene) -> void {
+    GLEAM_PROFILE_ZONE("RenderLists::ProcessScene");
     Reset();
 
+    auto opaque = std::vector<Mesh*> {};
+    auto transparent = std::vector<Mesh*> {};
     for (const auto& child : scene->Children()) {
-        ProcessNode(child.get());
+        ProcessNode(child.get(), opaque, transparent);
     }
 
     // Sort opaque meshes front-to-back to optimize depth buffer writes.
-    std::ranges::sort(opaque_, std::ranges::greater {}, compare);
+    std::ranges::sort(opaque, std::ranges::greater {}, compare);
 
     // Sort transparent meshes back-to-front to ensure correct blending.
-    std::ranges::sort(transparent_, std::ranges::less {}, compare);
+    std::ranges::sort(transparent, std::ranges::less {}, compare);
+
+    proxies_.reserve(opaque.size() + transparent.size());
+    meshes_.reserve(opaque.size() + transparent.size());
+    for (auto mesh : opaque) AddProxy(mesh);
+    for (auto mesh : transparent) AddProxy(mesh);
+    opaque_count_ = opaque.size();
+
+    geometry_indices_.clear();
+    material_indices_.clear();
 }
 
-auto RenderLists::ProcessNode(Node* node) -> void {
+auto RenderLists::ProcessNode(
+    Node* node,
+    std::vector<Mesh*>& opaque,
+    std::vector<Mesh*>& transparent
+) -> void {
     const auto type = node->GetNodeType();
     if (type == NodeType::MeshNode) {
         auto mesh = static_cast<Mesh*>(node);
         mesh->material->transparent ?
-            transparent_.emplace_back(mesh) :
-            opaque_.emplace_back(mesh);
+            transparent.emplace_back(mesh) :
+            opaque.emplace_back(mesh);
     }
 
     if (type == NodeType::LightNode) {
@@ -45,14 +102,152 @@ auto RenderLists::ProcessNode(Node* node) -> void {
     }
 
     for (const auto& child : node->Children()) {
-        ProcessNode(child.get());
+        ProcessNode(child.get(), opaque, transparent);
     }
 }
 
+auto RenderLists::AddProxy(Mesh* mesh) -> void {
+    auto proxy = RenderProxy {};
+
+    auto geometry = mesh->geometry.get();
+    auto [geometry_it, geometry_added] = geometry_indices_.try_emplace(
+        geometry, static_cast<uint32_t>(geometries_.size())
+    );
+    if (geometry_added) geometries_.emplace_back(mesh->geometry);
+    proxy.geometry_index = geometry_it->second;
+
+    auto material = mesh->material.get();
+    auto [material_it, material_added] = material_indices_.try_emplace(
+        material, static_cast<uint32_t>(materials_.size())
+    );
+    if (material_added) materials_.emplace_back(mesh->material, material->transparent);
+    proxy.material_index = material_it->second;
+
+    // Proxies start out valid so a skipped mesh is reported on the first update.
+    proxy.flags = RenderProxy::Valid;
+    if (material->transparent) proxy.flags |= RenderProxy::Transparent;
+
+    proxies_.emplace_back(proxy);
+    meshes_.emplace_back(mesh);
+}
+
+auto RenderLists::Update(
+    Scene* scene,
+    const ProgramAttributes::LightsCounter& lights,
+    WorkerPool* workers
+) -> void {
+    GLEAM_PROFILE_ZONE("RenderLists::Update");
+    if (IsStale()) ProcessScene(scene);
+
+    for (auto& entry : geometries_) {
+        auto geometry = entry.geometry.get();
+        entry.invalid_reason = validate_geometry(geometry);
+        if (!entry.invalid_reason.empty()) continue;
+
+        entry.bounds = geometry->BoundingSphere();
+        entry.primitive = geometry->primitive;
+        entry.indexed = geometry->IndexCount() > 0;
+        entry.count = static_cast<unsigned int>(entry.indexed
+            ? geometry->IndexCount()
+            : geometry->VertexCount()
+        );
+    }
+
+    UpdateProgramAttributes(scene, lights);
+
+    if (workers != nullptr) {
+        workers->ParallelFor(proxies_.size(), kProxiesPerJob, [this](auto begin, auto end) {
+            UpdateProxies(begin, end);
+        });
+    } else {
+        UpdateProxies(0, proxies_.size());
+    }
+}
+
+auto RenderLists::UpdateProxies(std::size_t begin, std::size_t end) -> void {
+    GLEAM_PROFILE_ZONE("RenderLists::UpdateProxies");
+    for (auto i = begin; i < end; ++i) {
+        auto& proxy = proxies_[i];
+        const auto& entry = geometries_[proxy.geometry_index];
+
+        if (!entry.invalid_reason.empty()) {
+            if (proxy.flags & RenderProxy::Valid) {
+                Logger::Log(LogLevel::Warning,
+                    "Skipped rendering a mesh with {} {}", entry.invalid_reason, *meshes_[i]
+                );
+            }
+            proxy.flags &= ~RenderProxy::Valid;
+            continue;
+        }
+
+        proxy.world = meshes_[i]->world_transform_;
+        proxy.world_bounds = entry.bounds;
+        proxy.world_bounds.ApplyTransform(proxy.world);
+        proxy.program_key = program_attributes_[proxy.material_index].key;
+        proxy.count = entry.count;
+        proxy.primitive = entry.primitive;
+        proxy.flags |= RenderProxy::Valid;
+        if (entry.indexed) {
+            proxy.flags |= RenderProxy::Indexed;
+        } else {
+            proxy.flags &= ~RenderProxy::Indexed;
+        }
+    }
+}
+
+auto RenderLists::UpdateProgramAttributes(
+    Scene* scene,
+    const ProgramAttributes::LightsCounter& lights
+) -> void {
+    // The attributes are cleared when the scene is processed again.
+    if (program_attributes_.size() != materials_.size() || lights != lights_counter_) {
+        lights_counter_ = lights;
+        program_attributes_.clear();
+        program_attributes_.reserve(materials_.size());
+        for (auto& entry : materials_) {
+            entry.program_state = program_state(entry.material.get(), scene);
+            program_attributes_.emplace_back(entry.material.get(), lights, scene);
+        }
+        return;
+    }
+
+    for (auto i = std::size_t {0}; i < materials_.size(); ++i) {
+        auto& entry = materials_[i];
+        const auto state = program_state(entry.material.get(), scene);
+        if (state != entry.program_state) {
+            entry.program_state = state;
+            program_attributes_[i] = ProgramAttributes {entry.material.get(), lights, scene};
+        }
+    }
+}
+
+auto RenderLists::IsStale() const -> bool {
+    // Meshes are checked first, the materials of the entries are only read
+    // while they're still the ones the meshes use.
+    for (auto i = std::size_t {0}; i < proxies_.size(); ++i) {
+        const auto& proxy = proxies_[i];
+        const auto mesh = meshes_[i];
+        if (mesh->geometry != geometries_[proxy.geometry_index].geometry ||
+            mesh->material != materials_[proxy.material_index].material) {
+            return true;
+        }
+    }
+
+    for (const auto& entry : materials_) {
+        if (entry.material->transparent != entry.transparent) return true;
+    }
+
+    return false;
+}
+
 auto RenderLists::Reset() -> void {
-    opaque_.clear();
-    transparent_.clear();
+    proxies_.clear();
+    meshes_.clear();
+    geometries_.clear();
+    materials_.clear();
+    program_attributes_.clear();
     lights_.clear();
+    opaque_count_ = 0;
 }
 
 }
\ No newline at end of file
@@ -7,42 +7,114 @@
 
 #pragma once
 
+#include "gleam/core/geometry.hpp"
 #include "gleam/lights/light.hpp"
+#include "gleam/materials/material.hpp"
+#include "gleam/math/matrix4.hpp"
+#include "gleam/math/sphere.hpp"
 #include "gleam/nodes/mesh.hpp"
 #include "gleam/nodes/node.hpp"
 #include "gleam/nodes/scene.hpp"
 
+#include "core/program_attributes.hpp"
+#include "core/worker_pool.hpp"
+
+#include <cstdint>
 #include <memory>
 #include <span>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace gleam {
 
+/**
+ * @brief Renderer-side snapshot of a mesh.
+ *
+ * Proxies are plain records stored in a dense array so culling, sorting and
+ * submission don't have to chase pointers through meshes, geometries and
+ * materials. Shared geometry and material state is referenced by index.
+ */
+struct RenderProxy {
+    enum Flags : uint32_t {
+        Valid = 1 << 0,       ///< The geometry can be rendered.
+        Transparent = 1 << 1, ///< The material is transparent.
+        Indexed = 1 << 2      ///< The geometry is drawn using its index buffer.
+    };
+
+    /// @brief World transform of the mesh.
+    Matrix4 world {1.0f};
+
+    /// @brief Bounding sphere of the geometry in world space.
+    Sphere world_bounds {};
+
+    /// @brief Key of the shader program used to render the mesh.
+    std::size_t program_key {0};
+
+    /// @brief Number of vertices, or indices if the proxy is indexed.
+    unsigned int count {0};
+
+    /// @brief Index of the geometry in the render lists.
+    uint32_t geometry_index {0};
+
+    /// @brief Index of the material and its program attributes in the render lists.
+    uint32_t material_index {0};
+
+    /// @brief Primitive type used to draw the geometry.
+    GeometryPrimitiveType primitive {GeometryPrimitiveType::Triangles};
+
+    /// @brief Combination of RenderProxy::Flags.
+    uint32_t flags {0};
+};
+
 class RenderLists {
 public:
     /**
-     * @brief Processes the scene and generates render lists.
+     * @brief Processes the scene and rebuilds the render proxies.
      *
      * @param scene The scene to process.
      */
     auto ProcessScene(Scene* scene) -> void;
 
     /**
-     * @brief Retrieves the list of opaque meshes in the scene.
+     * @brief Synchronizes the render proxies with the scene for the current frame.
+     *
+     * Geometry and material state is refreshed once per unique geometry and
+     * material, then copied into the proxies along with the world transforms.
+     * The proxies are rebuilt if a mesh was assigned a different geometry or
+     * material, or if a material changed its transparency. Program attributes
+     * are only recomputed for materials whose shader inputs changed, or for
+     * every material when the light counts change.
      *
-     * @return A vector of weak pointers to opaque meshes.
+     * World transforms are read as they are, so the scene's transform
+     * hierarchy must be updated beforehand.
+     *
+     * @param scene The scene to synchronize with.
+     * @param lights The number of lights of each type in the scene.
+     * @param workers Optional worker pool used to update the proxies in parallel.
      */
-    [[nodiscard]] auto Opaque() const -> std::span<Mesh* const> {
-        return opaque_;
+    auto Update(
+        Scene* scene,
+        const ProgramAttributes::LightsCounter& lights,
+        WorkerPool* workers = nullptr
+    ) -> void;
+
+    /**
+     * @brief Retrieves the render proxies of opaque meshes in the scene.
+     *
+     * @return A span of proxies sorted front-to-back.
+     */
+    [[nodiscard]] auto Opaque() const -> std::span<const RenderProxy> {
+        return std::span {proxies_}.first(opaque_count_);
     }
 
     /**
-     * @brief Retrieves the list of transparent meshes in the scene.
+     * @brief Retrieves the render proxies of transparent meshes in the scene.
      *
-     * @return A vector of weak pointers to transparent meshes.
+     * @return A span of proxies sorted back-to-front.
      */
-    [[nodiscard]] auto Transparent() const -> std::span<Mesh* const> {
-        return transparent_;
+    [[nodiscard]] auto Transparent() const -> std::span<const RenderProxy> {
+        return std::span {proxies_}.subspan(opaque_count_);
     }
 
     /**
@@ -54,22 +126,149 @@ public:
         return lights_;
     }
 
+    /**
+     * @brief Retrieves the geometry referenced by a render proxy.
+     *
+     * @param index The geometry index of the proxy.
+     * @return A shared pointer to the geometry.
+     */
+    [[nodiscard]] auto GetGeometry(uint32_t index) const -> const std::shared_ptr<Geometry>& {
+        return geometries_[index].geometry;
+    }
+
+    /**
+     * @brief Checks whether a geometry passed validation in the last update.
+     * Meshes with invalid geometries aren't rendered.
+     *
+     * @param index The index of the geometry.
+     * @return True if the geometry can be rendered.
+     */
+    [[nodiscard]] auto IsGeometryValid(uint32_t index) const {
+        return geometries_[index].invalid_reason.empty();
+    }
+
+    /**
+     * @brief Retrieves the number of unique geometries referenced by the proxies.
+     *
+     * @return The number of geometries.
+     */
+    [[nodiscard]] auto GeometryCount() const {
+        return geometries_.size();
+    }
+
+    /**
+     * @brief Retrieves the material referenced by a render proxy.
+     *
+     * @param index The material index of the proxy.
+     * @return A pointer to the material.
+     */
+    [[nodiscard]] auto GetMaterial(uint32_t index) const -> Material* {
+        return materials_[index].material.get();
+    }
+
+    /**
+     * @brief Retrieves the number of unique materials referenced by the proxies.
+     *
+     * @return The number of materials.
+     */
+    [[nodiscard]] auto MaterialCount() const {
+        return materials_.size();
+    }
+
+    /**
+     * @brief Retrieves the program attributes of the material referenced by a render proxy.
+     *
+     * @param index The material index of the proxy.
+     * @return The program attributes computed during the last update.
+     */
+    [[nodiscard]] auto GetProgramAttributes(uint32_t index) const -> const ProgramAttributes& {
+        return program_attributes_[index];
+    }
+
 private:
-    /// @brief A vector of weak pointers to opaque meshes in the scene.
-    std::vector<Mesh*> opaque_;
+    struct GeometryEntry {
+        std::shared_ptr<Geometry> geometry;
+        Sphere bounds {};
+        std::string_view invalid_reason {};
+        unsigned int count {0};
+        GeometryPrimitiveType primitive {GeometryPrimitiveType::Triangles};
+        bool indexed {false};
+    };
+
+    struct MaterialEntry {
+        std::shared_ptr<Material> material;
+        bool transparent {false};
+        uint32_t program_state {0};
+    };
+
+    /// @brief Dense array of proxies, opaque proxies first.
+    std::vector<RenderProxy> proxies_;
+
+    /// @brief Meshes the proxies were created from, in the same order.
+    std::vector<Mesh*> meshes_;
 
-    /// @brief A vector of weak pointers to transparent meshes in the scene.
-    std::vector<Mesh*> transparent_;
+    /// @brief Unique geometries referenced by the proxies.
+    std::vector<GeometryEntry> geometries_;
+
+    /// @brief Unique materials referenced by the proxies.
+    std::vector<MaterialEntry> materials_;
+
+    /// @brief Program attributes of each unique material.
+    std::vector<ProgramAttributes> program_attributes_;
 
     /// @brief A vector of weak pointers to lights in the scene.
     std::vector<Light*> lights_;
 
+    /// @brief Light counts the program attributes were computed with.
+    ProgramAttributes::LightsCounter lights_counter_ {};
+
+    /// @brief Lookup from geometry to its index, used while building proxies.
+    std::unordered_map<const Geometry*, uint32_t> geometry_indices_;
+
+    /// @brief Lookup from material to its index, used while building proxies.
+    std::unordered_map<const Material*, uint32_t> material_indices_;
+
+    /// @brief Number of opaque proxies at the front of the array.
+    std::size_t opaque_count_ {0};
+
     /**
      * @brief Processes nodes in the scene recursively.
      *
      * @param node The node to process.
+     * @param opaque Output list of opaque meshes.
+     * @param transparent Output list of transparent meshes.
+     */
+    auto ProcessNode(Node* node, std::vector<Mesh*>& opaque, std::vector<Mesh*>& transparent) -> void;
+
+    /**
+     * @brief Appends a render proxy for the mesh.
+     *
+     * @param mesh The mesh to create a proxy for.
+     */
+    auto AddProxy(Mesh* mesh) -> void;
+
+    /**
+     * @brief Copies the per-frame state into a range of proxies.
+     *
+     * @param begin Index of the first proxy.
+     * @param end Index past the last proxy.
+     */
+    auto UpdateProxies(std::size_t begin, std::size_t end) -> void;
+
+    /**
+     * @brief Recomputes the program attributes of materials that changed.
+     *
+     * @param scene The scene the materials are rendered in.
+     * @param lights The number of lights of each type in the scene.
+     */
+    auto UpdateProgramAttributes(Scene* scene, const ProgramAttributes::LightsCounter& lights) -> void;
+
+    /**
+     * @brief Checks whether any proxy no longer matches its mesh.
+     *
+     * @return `true` if the proxies need to be rebuilt, `false` otherwise.
      */
-    auto ProcessNode(Node*) -> void;
+    [[nodiscard]] auto IsStale() const -> bool;
 
     /**
      * @brief Resets the render lists.
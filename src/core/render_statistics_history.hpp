@@ -0,0 +1,125 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "gleam/core/render_statistics.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace gleam {
+
+namespace detail {
+
+template <class Fn>
+auto for_each_statistic(Fn&& fn) {
+    fn(&RenderStatistics::transform_update_ms);
+    fn(&RenderStatistics::render_lists_ms);
+    fn(&RenderStatistics::culling_ms);
+    fn(&RenderStatistics::uniform_setup_ms);
+    fn(&RenderStatistics::upload_ms);
+    fn(&RenderStatistics::submission_ms);
+    fn(&RenderStatistics::gpu_clear_ms);
+    fn(&RenderStatistics::gpu_opaque_ms);
+    fn(&RenderStatistics::gpu_transparent_ms);
+    fn(&RenderStatistics::gpu_frame_ms);
+    fn(&RenderStatistics::draw_calls);
+    fn(&RenderStatistics::triangles);
+    fn(&RenderStatistics::instanced_draws);
+    fn(&RenderStatistics::program_switches);
+    fn(&RenderStatistics::vao_binds);
+    fn(&RenderStatistics::texture_binds);
+    fn(&RenderStatistics::uniform_uploads);
+    fn(&RenderStatistics::ubo_bytes_uploaded);
+    fn(&RenderStatistics::buffer_bytes_uploaded);
+    fn(&RenderStatistics::texture_bytes_uploaded);
+    fn(&RenderStatistics::uploads_deferred);
+    fn(&RenderStatistics::culled_frustum);
+    fn(&RenderStatistics::culled_invalid_geometry);
+    fn(&RenderStatistics::culled_invalid_program);
+    fn(&RenderStatistics::culled_not_resident);
+    fn(&RenderStatistics::buffer_memory_bytes);
+    fn(&RenderStatistics::texture_memory_bytes);
+    fn(&RenderStatistics::geometry_cpu_memory_bytes);
+    fn(&RenderStatistics::texture_cpu_memory_bytes);
+}
+
+} // namespace detail
+
+/**
+ * @brief Fixed-size window of per-frame statistics used to compute rolling
+ * averages. Counters are rounded to the nearest integer.
+ */
+class RenderStatisticsHistory {
+public:
+    /// @brief Number of frames the averages are computed over.
+    static constexpr std::size_t kFrames = 60;
+
+    /**
+     * @brief Records the statistics of a frame, replacing the oldest frame
+     * once the window is full.
+     *
+     * @param statistics Statistics of the frame.
+     */
+    auto Add(const RenderStatistics& statistics) {
+        frames_[next_] = statistics;
+        next_ = (next_ + 1) % kFrames;
+        if (count_ < kFrames) count_++;
+    }
+
+    /**
+     * @brief Returns the average of the recorded frames.
+     *
+     * @return RenderStatistics
+     */
+    [[nodiscard]] auto Average() const {
+        auto average = RenderStatistics {};
+        if (count_ == 0) return average;
+
+        detail::for_each_statistic([&](auto field) {
+            auto sum = 0.0;
+            for (auto i = std::size_t {0}; i < count_; ++i) {
+                sum += static_cast<double>(frames_[i].*field);
+            }
+            using Field = std::remove_reference_t<decltype(average.*field)>;
+            const auto mean = sum / static_cast<double>(count_);
+            if constexpr (std::is_floating_point_v<Field>) {
+                average.*field = mean;
+            } else {
+                average.*field = static_cast<Field>(std::llround(mean));
+            }
+        });
+        return average;
+    }
+
+    /**
+     * @brief Returns the number of recorded frames, up to `kFrames`.
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]] auto Count() const { return count_; }
+
+    /**
+     * @brief Discards every recorded frame.
+     */
+    auto Clear() {
+        next_ = 0;
+        count_ = 0;
+    }
+
+private:
+    std::array<RenderStatistics, kFrames> frames_ {};
+
+    std::size_t next_ {0};
+
+    std::size_t count_ {0};
+};
+
+}
\ No newline at end of file
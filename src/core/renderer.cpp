@@ -18,14 +18,38 @@ auto Renderer::Render(Scene* scene, Camera* camera) -> void {
     impl_->Render(scene, camera);
 }
 
+auto Renderer::Prepare(Scene* scene, Camera* camera) -> void {
+    impl_->Prepare(scene, camera);
+}
+
+auto Renderer::SwapSnapshots() -> void {
+    impl_->SwapSnapshots();
+}
+
+auto Renderer::Submit() -> void {
+    impl_->Submit();
+}
+
 auto Renderer::SetClearColor(const Color &color) -> void {
     impl_->SetClearColor(color);
 }
 
+auto Renderer::ReadPixels() const -> std::vector<uint8_t> {
+    return impl_->ReadPixels();
+}
+
 auto Renderer::RenderedObjectsPerFrame() const -> size_t {
     return impl_->RenderedObjectsPerFrame();
 }
 
+auto Renderer::Statistics() const -> const RenderStatistics& {
+    return impl_->Statistics();
+}
+
+auto Renderer::AverageStatistics() const -> RenderStatistics {
+    return impl_->AverageStatistics();
+}
+
 Renderer::~Renderer() = default;
 
 }
\ No newline at end of file
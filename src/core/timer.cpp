@@ -35,11 +35,9 @@ auto Timer::GetElapsedMilliseconds() const -> double {
         return 0.0;
     }
 
-    return static_cast<double>(
-        std::chrono::duration_cast<std::chrono::milliseconds>(
-            Clock::now() - start_time_
-        ).count()
-    );
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+        Clock::now() - start_time_
+    ).count();
 }
 
 auto Timer::GetElapsedSeconds() const -> double {
@@ -28,12 +28,19 @@ static auto glfw_mouse_button_map(int button) -> MouseButton;
 static auto glfw_keyboard_map(int key) -> Key;
 
 static auto imgui_initialize(GLFWwindow* window) -> void;
+static auto imgui_initialize_headless(int width, int height) -> void;
 static auto imgui_before_render() -> void;
 static auto imgui_after_render() -> void;
 static auto imgui_event() -> bool;
 static auto imgui_cleanup() -> void;
+static auto imgui_cleanup_headless() -> void;
 
 Window::Impl::Impl(const Window::Parameters& params) {
+    if (params.headless) {
+        InitializeHeadless(params);
+        return;
+    }
+
     if (!glfwInit()) {
         Logger::Log(LogLevel::Error, "Failed to initialize GLFW {}", glfw_get_error());
         return;
@@ -82,7 +89,30 @@ Window::Impl::Impl(const Window::Parameters& params) {
     imgui_initialize(window_);
 }
 
+auto Window::Impl::InitializeHeadless(const Window::Parameters& params) -> void {
+    headless_ = std::make_unique<HeadlessContext>();
+    if (!headless_->IsValid()) return;
+
+    initialized_ = true;
+    buffer_width_ = params.width;
+    buffer_height_ = params.height;
+
+    imgui_initialize_headless(params.width, params.height);
+}
+
 auto Window::Impl::Start(const OnTickCallback& tick) -> void {
+    if (headless_) {
+        // There is nothing to present, so frames are produced back to back
+        // until the application breaks out of the loop. ImGui still gets a
+        // frame so application code doesn't have to special-case it.
+        while (!break_) {
+            ImGui::NewFrame();
+            tick();
+            ImGui::Render();
+        }
+        return;
+    }
+
     while(!glfwWindowShouldClose(window_) && !break_) {
         imgui_before_render();
 
@@ -99,6 +129,7 @@ auto Window::Impl::Break() -> void {
 }
 
 auto Window::Impl::SetTitle(std::string_view title) -> void {
+    if (window_ == nullptr) return;
     glfwSetWindowTitle(window_, title.data());
 }
 
@@ -114,6 +145,11 @@ auto Window::Impl::LogContextInfo() const -> void {
 }
 
 Window::Impl::~Impl() {
+    if (headless_) {
+        if (initialized_) imgui_cleanup_headless();
+        return;
+    }
+
     imgui_cleanup();
 
     if (window_) glfwDestroyWindow(window_);
@@ -129,6 +165,20 @@ static auto imgui_initialize(GLFWwindow* window) -> void {
     ImGui_ImplOpenGL3_Init();
 }
 
+static auto imgui_initialize_headless(int width, int height) -> void {
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    auto& io = ImGui::GetIO();
+    io.DisplaySize = {static_cast<float>(width), static_cast<float>(height)};
+    io.IniFilename = nullptr;
+
+    // Without a renderer backend the font atlas has to be built explicitly.
+    unsigned char* pixels = nullptr;
+    auto atlas_width = 0;
+    auto atlas_height = 0;
+    io.Fonts->GetTexDataAsAlpha8(&pixels, &atlas_width, &atlas_height);
+}
+
 static auto imgui_before_render() -> void {
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
@@ -151,6 +201,10 @@ static auto imgui_cleanup() -> void {
     ImGui::DestroyContext();
 }
 
+static auto imgui_cleanup_headless() -> void {
+    ImGui::DestroyContext();
+}
+
 #pragma endregion
 
 #pragma region GLFW callbacks
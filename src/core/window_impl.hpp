@@ -9,6 +9,10 @@
 
 #include "gleam/core/window.hpp"
 
+#include "core/headless_context.hpp"
+
+#include <memory>
+
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
@@ -49,6 +53,11 @@ private:
 
     GLFWwindow* window_ {nullptr};
 
+    /// @brief Context used instead of a GLFW window in headless mode.
+    std::unique_ptr<HeadlessContext> headless_;
+
+    auto InitializeHeadless(const Window::Parameters& params) -> void;
+
     auto LogContextInfo() const -> void;
 };
 
@@ -0,0 +1,111 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "core/worker_pool.hpp"
+
+#include "utilities/profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+namespace gleam {
+
+WorkerPool::WorkerPool(unsigned int thread_count) {
+    threads_.reserve(thread_count);
+    for (auto i = 0; i < thread_count; ++i) {
+        threads_.emplace_back([this]{ Work(); });
+    }
+}
+
+auto WorkerPool::ParallelFor(std::size_t count, std::size_t grain, const Range& fn) -> void {
+    grain = std::max<std::size_t>(grain, 1);
+    const auto chunks = (count + grain - 1) / grain;
+    if (chunks <= 1 || threads_.empty()) {
+        if (count > 0) fn(0, count);
+        return;
+    }
+
+    auto next = std::atomic<std::size_t> {0};
+    auto run = [&] {
+        for (auto chunk = next++; chunk < chunks; chunk = next++) {
+            const auto begin = chunk * grain;
+            fn(begin, std::min(begin + grain, count));
+        }
+    };
+
+    // Helpers share the caller's stack, so the caller waits for all of them
+    // to finish before returning, even if it processed every chunk itself.
+    // Helpers signal while holding the lock so the caller can't return and
+    // destroy the state before they're done with it.
+    const auto helpers = std::min<std::size_t>(threads_.size(), chunks - 1);
+    auto remaining = helpers;
+    auto helpers_mutex = std::mutex {};
+    auto helpers_done = std::condition_variable {};
+    // Helpers jump ahead of queued tasks since the caller is blocked on them.
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        for (auto i = 0; i < helpers; ++i) {
+            Push([&] {
+                run();
+                const auto lock = std::scoped_lock(helpers_mutex);
+                if (--remaining == 0) helpers_done.notify_one();
+            }, std::numeric_limits<int>::max());
+        }
+    }
+    condition_.notify_all();
+
+    run();
+
+    auto lock = std::unique_lock(helpers_mutex);
+    helpers_done.wait(lock, [&]{ return remaining == 0; });
+}
+
+auto WorkerPool::Submit(std::function<void()> task, int priority) -> void {
+    if (threads_.empty()) {
+        task();
+        return;
+    }
+
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        Push(std::move(task), priority);
+    }
+    condition_.notify_one();
+}
+
+auto WorkerPool::Push(std::function<void()> task, int priority) -> void {
+    tasks_.push_back({std::move(task), priority, sequence_++});
+    std::push_heap(tasks_.begin(), tasks_.end());
+}
+
+auto WorkerPool::Work() -> void {
+    GLEAM_PROFILE_THREAD("Worker");
+    while (true) {
+        auto task = std::function<void()> {};
+        {
+            auto lock = std::unique_lock(mutex_);
+            condition_.wait(lock, [this]{ return stop_ || !tasks_.empty(); });
+            if (stop_ && tasks_.empty()) return;
+            std::pop_heap(tasks_.begin(), tasks_.end());
+            task = std::move(tasks_.back().fn);
+            tasks_.pop_back();
+        }
+        task();
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    for (auto& thread : threads_) thread.join();
+}
+
+}
\ No newline at end of file
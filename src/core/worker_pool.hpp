@@ -0,0 +1,104 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gleam {
+
+class WorkerPool {
+public:
+    using Range = std::function<void(std::size_t begin, std::size_t end)>;
+
+    /**
+     * @brief Constructs a WorkerPool object and starts the worker threads.
+     *
+     * @param thread_count Number of worker threads. The calling thread also
+     * takes part in parallel loops, so `0` runs everything on the caller.
+     */
+    explicit WorkerPool(unsigned int thread_count);
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool(WorkerPool&&) = delete;
+    auto operator=(const WorkerPool&) -> WorkerPool& = delete;
+    auto operator=(WorkerPool&&) -> WorkerPool& = delete;
+
+    /**
+     * @brief Splits `[0, count)` into chunks and runs them on the pool.
+     *
+     * The calling thread processes chunks as well and the call returns once
+     * every chunk is done. Ranges no larger than a single chunk run inline.
+     *
+     * @param count Number of items to process.
+     * @param grain Maximum number of items in a chunk.
+     * @param fn Function invoked with the bounds of each chunk.
+     */
+    auto ParallelFor(std::size_t count, std::size_t grain, const Range& fn) -> void;
+
+    /**
+     * @brief Queues a task to run on one of the worker threads.
+     *
+     * Tasks with a higher priority are picked up first, tasks of equal
+     * priority run in submission order. Without worker threads the task
+     * runs inline.
+     *
+     * @param task Function to run.
+     * @param priority Priority of the task.
+     */
+    auto Submit(std::function<void()> task, int priority = 0) -> void;
+
+    /**
+     * @brief Returns the number of worker threads.
+     *
+     * @return unsigned int
+     */
+    [[nodiscard]] auto ThreadCount() const {
+        return static_cast<unsigned int>(threads_.size());
+    }
+
+    /**
+     * @brief Stops and joins the worker threads.
+     */
+    ~WorkerPool();
+
+private:
+    struct Task {
+        std::function<void()> fn;
+        int priority;
+        uint64_t sequence;
+
+        auto operator<(const Task& other) const {
+            if (priority != other.priority) return priority < other.priority;
+            return sequence > other.sequence;
+        }
+    };
+
+    std::vector<std::thread> threads_;
+
+    std::vector<Task> tasks_;
+
+    uint64_t sequence_ {0};
+
+    std::mutex mutex_;
+
+    std::condition_variable condition_;
+
+    bool stop_ {false};
+
+    auto Push(std::function<void()> task, int priority) -> void;
+
+    auto Work() -> void;
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "gleam/loaders/archive.hpp"
+
+#include "loaders/archive_reader.hpp"
+
+#include "utilities/profiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace gleam {
+
+namespace {
+
+struct MountedArchive {
+    fs::path path;
+    std::string prefix;
+    std::shared_ptr<ArchiveReader> reader;
+};
+
+struct MountTable {
+    std::mutex mutex;
+    std::vector<MountedArchive> archives;
+};
+
+auto mount_table() -> MountTable& {
+    // Never destroyed, so loads still in flight when the program exits can
+    // resolve their paths.
+    static auto instance = new MountTable();
+    return *instance;
+}
+
+// Entry names use forward slashes and no dot segments, so different
+// spellings of a path resolve to the same entry.
+auto entry_name(const fs::path& path) {
+    return path.lexically_normal().generic_string();
+}
+
+auto mount_prefix(const fs::path& mount_point) {
+    auto prefix = entry_name(mount_point);
+    while (prefix.ends_with('/')) prefix.pop_back();
+    return prefix == "." ? std::string {} : prefix;
+}
+
+auto in_bounds(std::span<const std::byte> bytes, uint64_t offset, uint64_t size) {
+    return offset <= bytes.size() && size <= bytes.size() - offset;
+}
+
+auto find_entry(const fs::path& path) -> std::optional<AssetData> {
+    const auto name = entry_name(path);
+    auto& table = mount_table();
+    const auto lock = std::scoped_lock(table.mutex);
+    for (auto it = table.archives.rbegin(); it != table.archives.rend(); ++it) {
+        auto relative = std::string_view {name};
+        if (!it->prefix.empty()) {
+            const auto size = it->prefix.size();
+            if (!relative.starts_with(it->prefix) || relative.size() <= size || relative[size] != '/') {
+                continue;
+            }
+            relative.remove_prefix(size + 1);
+        }
+        if (auto bytes = it->reader->Find(relative)) {
+            return AssetData {bytes.value(), it->reader->Mapping()};
+        }
+    }
+    return std::nullopt;
+}
+
+} // unnamed namespace
+
+auto ArchiveReader::Open(const fs::path& path)
+    -> std::expected<std::shared_ptr<ArchiveReader>, std::string>
+{
+    GLEAM_PROFILE_ZONE("ArchiveReader::Open");
+    auto path_s = path.string();
+    auto file = MappedFile::Open(path, MappedFile::Access::Random);
+    if (!file) {
+        return std::unexpected("Unable to open archive '" + path_s + "'");
+    }
+
+    auto reader = std::shared_ptr<ArchiveReader>(new ArchiveReader());
+    reader->mapping_ = std::move(file.value());
+    const auto bytes = reader->mapping_->Bytes();
+
+    auto header = ArchiveHeader {};
+    if (!ByteReader {bytes}.Read(header) || std::memcmp(header.magic, "PAK0", 4) != 0) {
+        return std::unexpected("Invalid archive file '" + path_s + "'");
+    }
+
+    if (header.version != 1 || header.header_size != sizeof(ArchiveHeader)) {
+        return std::unexpected("Unsupported archive version in file '" + path_s + "'");
+    }
+
+    const auto toc_size = static_cast<uint64_t>(header.entry_count) * sizeof(ArchiveEntry);
+    if (
+        !in_bounds(bytes, header.toc_offset, toc_size) ||
+        !in_bounds(bytes, header.names_offset, header.names_size)
+    ) {
+        return std::unexpected("Corrupt archive file '" + path_s + "'");
+    }
+
+    reader->entries_ = {
+        reinterpret_cast<const ArchiveEntry*>(bytes.data() + header.toc_offset),
+        header.entry_count
+    };
+    reader->names_ = {
+        reinterpret_cast<const char*>(bytes.data() + header.names_offset),
+        header.names_size
+    };
+
+    // Entries are checked up front, so lookups can hand out views directly.
+    for (const auto& entry : reader->entries_) {
+        const auto name_end = static_cast<uint64_t>(entry.name_offset) + entry.name_size;
+        if (!in_bounds(bytes, entry.offset, entry.size) || name_end > header.names_size) {
+            return std::unexpected("Corrupt archive file '" + path_s + "'");
+        }
+    }
+
+    return reader;
+}
+
+auto ArchiveReader::Find(std::string_view name) const -> std::optional<std::span<const std::byte>> {
+    const auto hash = archive_hash(name);
+    auto it = std::ranges::lower_bound(entries_, hash, {}, [](const ArchiveEntry& entry) {
+        return static_cast<uint64_t>(entry.hash);
+    });
+
+    for (; it != entries_.end() && it->hash == hash; ++it) {
+        if (names_.substr(it->name_offset, it->name_size) == name) {
+            return mapping_->Bytes().subspan(it->offset, it->size);
+        }
+    }
+    return std::nullopt;
+}
+
+auto open_asset(const fs::path& path) -> std::expected<AssetData, std::string> {
+    if (auto entry = find_entry(path)) return entry.value();
+
+    auto file = MappedFile::Open(path);
+    if (!file) {
+        return std::unexpected("Unable to open file '" + path.string() + "'");
+    }
+
+    auto mapping = std::shared_ptr<const MappedFile> {std::move(file.value())};
+    return AssetData {mapping->Bytes(), mapping};
+}
+
+auto Archive::Mount(const fs::path& path, const fs::path& mount_point) -> std::expected<void, std::string> {
+    auto reader = ArchiveReader::Open(path);
+    if (!reader) return std::unexpected(reader.error());
+
+    auto& table = mount_table();
+    const auto lock = std::scoped_lock(table.mutex);
+    table.archives.emplace_back(path.lexically_normal(), mount_prefix(mount_point), reader.value());
+    return {};
+}
+
+auto Archive::Unmount(const fs::path& path) -> bool {
+    auto& table = mount_table();
+    const auto lock = std::scoped_lock(table.mutex);
+    return std::erase_if(table.archives, [normal = path.lexically_normal()](const auto& archive) {
+        return archive.path == normal;
+    }) > 0;
+}
+
+auto Archive::Contains(const fs::path& path) -> bool {
+    return find_entry(path).has_value();
+}
+
+auto Archive::MountCount() -> std::size_t {
+    auto& table = mount_table();
+    const auto lock = std::scoped_lock(table.mutex);
+    return table.archives.size();
+}
+
+}
\ No newline at end of file
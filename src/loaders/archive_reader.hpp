@@ -0,0 +1,86 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "utilities/mapped_file.hpp"
+
+#include "asset_builder/include/types.hpp"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace gleam {
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Read-only view of a memory-mapped asset archive.
+ *
+ * The table of contents is validated once when the archive is opened, so
+ * lookups are a binary search over the mapped entries.
+ */
+class ArchiveReader {
+public:
+    /**
+     * @brief Maps an archive and validates its table of contents.
+     *
+     * @param path File system path to the archive.
+     * @return std::expected<std::shared_ptr<ArchiveReader>, std::string>
+     */
+    [[nodiscard]] static auto Open(const fs::path& path)
+        -> std::expected<std::shared_ptr<ArchiveReader>, std::string>;
+
+    /**
+     * @brief Finds an entry by name.
+     *
+     * @param name Entry name, relative to the archive root.
+     * @return std::optional<std::span<const std::byte>> Bytes of the entry.
+     */
+    [[nodiscard]] auto Find(std::string_view name) const -> std::optional<std::span<const std::byte>>;
+
+    [[nodiscard]] auto Mapping() const -> const std::shared_ptr<const MappedFile>& { return mapping_; }
+
+    [[nodiscard]] auto EntryCount() const { return entries_.size(); }
+
+private:
+    std::shared_ptr<const MappedFile> mapping_;
+
+    std::span<const ArchiveEntry> entries_;
+
+    std::string_view names_;
+
+    ArchiveReader() = default;
+};
+
+/**
+ * @brief Bytes of an asset and the object that owns them.
+ */
+struct AssetData {
+    /// @brief Bytes of the asset.
+    std::span<const std::byte> bytes;
+
+    /// @brief Owner of the bytes, a mapped loose file or archive.
+    std::shared_ptr<const MappedFile> mapping;
+};
+
+/**
+ * @brief Maps an asset from the mounted archives, or from the file system if
+ * no archive contains it.
+ *
+ * @param path Path to the asset, as passed to a loader.
+ * @return std::expected<AssetData, std::string>
+ */
+[[nodiscard]] auto open_asset(const fs::path& path) -> std::expected<AssetData, std::string>;
+
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "gleam/loaders/load_queue.hpp"
+
+#include "core/worker_pool.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace gleam {
+
+namespace {
+
+auto thread_count() {
+    // Leave a core for the main thread; loads are mostly I/O and decoding,
+    // so a handful of threads is enough to keep the disk busy.
+    const auto cores = std::max(std::thread::hardware_concurrency(), 2u);
+    return std::min(cores - 1, LoadQueue::kMaxThreads);
+}
+
+} // unnamed namespace
+
+LoadQueue::LoadQueue()
+  : pool_(std::make_unique<WorkerPool>(thread_count())) {}
+
+auto LoadQueue::Get() -> LoadQueue& {
+    // Never destroyed, so loads still in flight when the program exits don't
+    // race the destruction of other static objects they depend on.
+    static auto instance = new LoadQueue();
+    return *instance;
+}
+
+auto LoadQueue::Submit(std::function<void()> task, LoadPriority priority) -> void {
+    pool_->Submit(std::move(task), static_cast<int>(priority));
+}
+
+auto LoadQueue::PostToMainThread(std::function<void()> callback) -> void {
+    const auto lock = std::scoped_lock(callbacks_mutex_);
+    callbacks_.emplace_back(std::move(callback));
+}
+
+auto LoadQueue::DispatchCallbacks() -> std::size_t {
+    auto callbacks = std::vector<std::function<void()>> {};
+    {
+        const auto lock = std::scoped_lock(callbacks_mutex_);
+        callbacks.swap(callbacks_);
+    }
+    for (const auto& callback : callbacks) callback();
+    return callbacks.size();
+}
+
+auto LoadQueue::ThreadCount() const -> unsigned int {
+    return pool_->ThreadCount();
+}
+
+LoadQueue::~LoadQueue() = default;
+
+}
\ No newline at end of file
@@ -6,7 +6,6 @@
 */
 
 #include "gleam/loaders/mesh_loader.hpp"
-#include "gleam/loaders/texture_loader.hpp"
 
 #include "gleam/core/geometry.hpp"
 #include "gleam/materials/phong_material.hpp"
@@ -15,108 +14,450 @@
 #include "gleam/nodes/node.hpp"
 #include "gleam/textures/texture_2d.hpp"
 
-#include "utilities/file.hpp"
+#include "loaders/archive_reader.hpp"
+#include "loaders/texture_cache.hpp"
+#include "utilities/mapped_file.hpp"
+#include "utilities/mesh_codec.hpp"
+#include "utilities/profiler.hpp"
 
 #include "asset_builder/include/types.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
-#include <fstream>
+#include <expected>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <string>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace gleam {
 
 namespace {
 
-auto load_materials(const fs::path& path, uint32_t material_count, std::ifstream& file) {
-    auto output = std::vector<std::shared_ptr<Material>> {};
-    auto texture_loader = TextureLoader::Create();
-    auto textures = std::unordered_map<std::string, std::shared_ptr<Texture2D>> {};
+struct PendingMaterial {
+    MaterialEntryHeader header;
+    std::shared_ptr<TextureRequest> texture;
+};
+
+auto request_materials(const fs::path& path, uint32_t material_count, ByteReader& reader) {
+    GLEAM_PROFILE_ZONE("MeshLoader::RequestMaterials");
+    auto output = std::vector<PendingMaterial> {};
+    output.reserve(material_count);
 
-    for (auto i = 0; i < material_count; ++i) {
-        auto material_header = MaterialEntryHeader {};
-        read_binary(file, material_header);
+    for (auto i = uint32_t {0}; i < material_count; ++i) {
+        auto material = PendingMaterial {};
+        if (!reader.Read(material.header)) break;
 
-        auto tex = std::string {material_header.texture};
+        // Textures are loaded on the load queue while the geometry is read,
+        // and shared with other meshes that reference the same files.
+        const auto& texture = material.header.texture;
+        const auto tex = std::string {texture, strnlen(texture, sizeof(texture))};
         if (!tex.empty()) {
-            if (!textures.contains(tex)) {
-                const auto tex_path = path.parent_path().string() + "/" + tex;
-                const auto result = texture_loader->Load(tex_path);
-                if (result) textures[tex] = result.value();
-            }
+            material.texture = TextureCache::Get().Request(path.parent_path() / tex);
         }
 
-        auto mat = PhongMaterial::Create();
-        mat->color = Color {material_header.diffuse};
-        mat->specular = Color {material_header.specular};
-        mat->shininess = material_header.shininess;
-        if (textures.contains(tex)) {
-            mat->color = 0xFFFFFF;
-            mat->texture_map = textures[tex];
-        }
+        output.emplace_back(std::move(material));
+    }
+
+    return output;
+}
+
+auto create_material(MaterialEntryHeader& header) {
+    auto mat = PhongMaterial::Create();
+    mat->color = Color {header.diffuse};
+    mat->specular = Color {header.specular};
+    mat->shininess = header.shininess;
+    return mat;
+}
 
+auto apply_texture(PhongMaterial* mat, const std::shared_ptr<Texture2D>& texture_map) {
+    if (texture_map) {
+        mat->color = 0xFFFFFF;
+        mat->texture_map = texture_map;
+    }
+}
+
+auto create_materials(std::vector<PendingMaterial>& pending) {
+    GLEAM_PROFILE_ZONE("MeshLoader::LoadMaterials");
+    auto output = std::vector<std::shared_ptr<Material>> {};
+    output.reserve(pending.size());
+
+    for (auto& [header, texture] : pending) {
+        auto mat = create_material(header);
+        if (texture) apply_texture(mat.get(), texture->Get());
         output.emplace_back(mat);
     }
 
     return output;
 }
 
-} // unnamed namespace
+template <class T>
+auto view_as(std::span<const std::byte> bytes) {
+    return std::span<const T> {reinterpret_cast<const T*>(bytes.data()), bytes.size() / sizeof(T)};
+}
 
-auto MeshLoader::LoadImpl(const fs::path& path) const -> LoaderResult<Node> {
-    auto file = std::ifstream {path, std::ios::binary};
+template <class T>
+auto is_aligned(std::span<const std::byte> bytes) {
+    return reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(T) == 0;
+}
+
+struct MeshFile {
+    std::shared_ptr<const MappedFile> mapping;
+    ByteReader reader;
+    MeshHeader header;
+};
+
+auto open_mesh_file(const fs::path& path) -> std::expected<MeshFile, std::string> {
     auto path_s = path.string();
-    if (!file) {
-        return std::unexpected("Unable to open file '" + path_s + "'");
-    }
+    auto asset = open_asset(path);
+    if (!asset) return std::unexpected(asset.error());
+
+    // Geometries view the vertex and index data in place, and share the
+    // mapping of the file or archive for as long as any of them keeps its data.
+    auto output = MeshFile {asset->mapping, ByteReader {asset->bytes}, {}};
 
-    auto mesh_header = MeshHeader {};
-    read_binary(file, mesh_header);
-    if (std::memcmp(mesh_header.magic, "MES0", 4) != 0) {
+    auto& header = output.header;
+    if (!output.reader.Read(header) || std::memcmp(header.magic, "MES0", 4) != 0) {
         return std::unexpected("Invalid mesh file '" + path_s + "'");
     }
 
-    if (mesh_header.version != 1 || mesh_header.header_size != sizeof(MeshHeader)) {
+    const auto version_supported = header.version == 1 || header.version == 2;
+    if (!version_supported || header.header_size != sizeof(MeshHeader)) {
         return std::unexpected("Unsupported mesh version in file '" + path_s + "'");
     }
 
-    auto materials = load_materials(path, mesh_header.material_count, file);
-    auto root = Node::Create();
+    return output;
+}
 
-    for (auto i = 0; i < mesh_header.mesh_count; ++i) {
-        auto geometry_header = MeshEntryHeader {};
-        read_binary(file, geometry_header);
+auto decode_geometry(
+    std::span<const std::byte> vertex_stream,
+    std::span<const std::byte> index_stream,
+    const MeshEntryHeader& header,
+    const std::string& path_s
+) -> std::expected<std::shared_ptr<Geometry>, std::string> {
+    GLEAM_PROFILE_ZONE("MeshLoader::DecodeGeometry");
+    const auto vertex_size = header.vertex_data_size;
+    const auto index_size = header.index_data_size;
 
-        if (geometry_header.vertex_count == 0 || geometry_header.index_count == 0) {
-            return std::unexpected("Mesh entry has zero vertices or indices in file '" + path_s + "'");
-        }
+    // Both streams decode into one word-aligned allocation that the geometry
+    // keeps alive.
+    const auto words = (vertex_size + index_size) / sizeof(uint32_t);
+    auto storage = std::make_shared_for_overwrite<uint32_t[]>(words);
+    const auto bytes = std::as_writable_bytes(std::span {storage.get(), words});
+    const auto vertex_bytes = bytes.first(vertex_size);
+    const auto index_bytes = bytes.subspan(vertex_size);
+    if (
+        !decode_mesh_stream(vertex_stream, vertex_bytes, header.vertex_stride) ||
+        !decode_mesh_stream(index_stream, index_bytes, 1)
+    ) {
+        return std::unexpected("Corrupt mesh data in file '" + path_s + "'");
+    }
+
+    return Geometry::Create(
+        view_as<float>(vertex_bytes),
+        view_as<unsigned int>(index_bytes),
+        std::move(storage)
+    );
+}
+
+auto read_geometry(MeshFile& file, MeshEntryHeader& header, const std::string& path_s)
+    -> std::expected<std::shared_ptr<Geometry>, std::string>
+{
+    if (!file.reader.Read(header)) {
+        return std::unexpected("Truncated mesh file '" + path_s + "'");
+    }
+
+    if (header.vertex_count == 0 || header.index_count == 0) {
+        return std::unexpected("Mesh entry has zero vertices or indices in file '" + path_s + "'");
+    }
+
+    const auto vertex_size = static_cast<uint64_t>(header.vertex_count) *
+        header.vertex_stride * sizeof(float);
+    const auto index_size = static_cast<uint64_t>(header.index_count) * sizeof(unsigned int);
+    if (header.vertex_data_size != vertex_size || header.index_data_size != index_size) {
+        return std::unexpected("Mesh entry has inconsistent data sizes in file '" + path_s + "'");
+    }
+
+    // Version 1 files store the data uncompressed, without a stream header.
+    auto streams = MeshStreamHeader {MeshCodec::Uncompressed, vertex_size, index_size};
+    if (file.header.version >= 2 && !file.reader.Read(streams)) {
+        return std::unexpected("Truncated mesh file '" + path_s + "'");
+    }
+
+    const auto vertex_bytes = file.reader.Take(streams.vertex_stream_size);
+    const auto index_bytes = file.reader.Take(streams.index_stream_size);
+    if (vertex_bytes.size() != streams.vertex_stream_size || index_bytes.size() != streams.index_stream_size) {
+        return std::unexpected("Truncated mesh file '" + path_s + "'");
+    }
+
+    if (streams.codec == MeshCodec::DeltaPlaneLZ) {
+        return decode_geometry(vertex_bytes, index_bytes, header, path_s);
+    }
+
+    if (streams.codec != MeshCodec::Uncompressed || vertex_bytes.size() != vertex_size || index_bytes.size() != index_size) {
+        return std::unexpected("Unsupported mesh encoding in file '" + path_s + "'");
+    }
+
+    if (is_aligned<float>(vertex_bytes) && is_aligned<unsigned int>(index_bytes)) {
+        return Geometry::Create(
+            view_as<float>(vertex_bytes),
+            view_as<unsigned int>(index_bytes),
+            file.mapping
+        );
+    }
+
+    // The format keeps data 4-byte aligned, so this is only a safeguard.
+    auto vertex_data = std::vector<float>(vertex_size / sizeof(float));
+    auto index_data = std::vector<unsigned int>(index_size / sizeof(unsigned int));
+    std::memcpy(vertex_data.data(), vertex_bytes.data(), vertex_size);
+    std::memcpy(index_data.data(), index_bytes.data(), index_size);
+    return Geometry::Create(vertex_data, index_data);
+}
+
+auto reload_geometry(const fs::path& path, std::size_t offset) -> std::shared_ptr<Geometry> {
+    GLEAM_PROFILE_ZONE("MeshLoader::ReloadGeometry");
+    auto file = open_mesh_file(path);
+    if (!file || !file->reader.Seek(offset)) return nullptr;
+
+    auto header = MeshEntryHeader {};
+    auto geometry = read_geometry(file.value(), header, path.string());
+    return geometry ? geometry.value() : nullptr;
+}
+
+auto load_entry(MeshFile& file, const fs::path& path, ResidencyPolicy residency)
+    -> std::expected<std::pair<std::shared_ptr<Geometry>, uint32_t>, std::string>
+{
+    GLEAM_PROFILE_ZONE("MeshLoader::LoadGeometry");
+    const auto offset = file.reader.Offset();
+    auto header = MeshEntryHeader {};
+    auto result = read_geometry(file, header, path.string());
+    if (!result) return std::unexpected(result.error());
+
+    auto geometry = result.value();
+    geometry->SetName(header.name);
+
+    geometry->SetAttribute({.type = GeometryAttributeType::Position, .item_size = 3});
+    geometry->SetAttribute({.type = GeometryAttributeType::Normal, .item_size = 3});
+    if (header.vertex_flags & VertexAttributeFlags::UVs) {
+        geometry->SetAttribute({.type = GeometryAttributeType::UV, .item_size = 2});
+    }
+
+    // The file stays on disk, so the data can be mapped again if it's ever
+    // dropped. The entry is read straight from where it was found.
+    geometry->residency = residency;
+    geometry->SetReloader([path, offset]() { return reload_geometry(path, offset); });
+
+    // Bounds are computed while the pages are hot, before anything else
+    // can observe the geometry.
+    static_cast<void>(geometry->BoundingSphere());
+
+    return std::pair {geometry, header.material_index};
+}
+
+auto make_mesh(
+    const std::shared_ptr<Geometry>& geometry,
+    uint32_t mat_index,
+    const std::vector<std::shared_ptr<Material>>& materials
+) {
+    if (mat_index != std::numeric_limits<uint32_t>::max() && mat_index < materials.size()) {
+        return Mesh::Create(geometry, materials[mat_index]);
+    }
+    return Mesh::Create(geometry, PhongMaterial::Create());
+}
+
+struct MeshStream {
+    fs::path path;
+    MeshFile file;
+    MeshStreamOptions options;
+    ResidencyPolicy residency;
+    std::shared_ptr<Node> root;
+    std::vector<std::shared_ptr<Material>> materials;
+
+    // Only touched on the main thread.
+    std::size_t loaded {0};
+    std::size_t pending_textures {0};
+    bool completed {false};
+
+    std::mutex mutex;
+    uint32_t next {0};
+    std::size_t in_flight {0};
+    bool reading {true};
+};
 
-        auto vertex_data = std::vector<float>(geometry_header.vertex_count * geometry_header.vertex_stride);
-        read_binary(file, vertex_data, geometry_header.vertex_data_size);
+auto stream_entries(const std::shared_ptr<MeshStream>& stream) -> void;
 
-        auto index_data = std::vector<unsigned int>(geometry_header.index_count);
-        read_binary(file, index_data, geometry_header.index_data_size);
+auto complete_if_done(const std::shared_ptr<MeshStream>& stream) {
+    const auto done = stream->loaded == stream->file.header.mesh_count && stream->pending_textures == 0;
+    if (!done || stream->completed || stream->options.token.IsCancelled()) return;
+
+    stream->completed = true;
+    if (stream->options.on_complete) {
+        stream->options.on_complete();
+    }
+}
 
-        auto geometry = Geometry::Create(vertex_data, index_data);
-        geometry->SetName(geometry_header.name);
+auto stream_textures(const std::shared_ptr<MeshStream>& stream, std::vector<PendingMaterial>& pending) {
+    // Meshes are attached with untextured materials, and each texture that
+    // isn't cached yet is applied once it's loaded. Materials that share a
+    // file wait on the same request.
+    auto requests = std::vector<std::pair<std::shared_ptr<TextureRequest>, std::vector<PhongMaterial*>>> {};
+    for (auto i = std::size_t {0}; i < pending.size(); ++i) {
+        const auto& texture = pending[i].texture;
+        if (!texture) continue;
 
-        geometry->SetAttribute({.type = GeometryAttributeType::Position, .item_size = 3});
-        geometry->SetAttribute({.type = GeometryAttributeType::Normal, .item_size = 3});
-        if (geometry_header.vertex_flags & VertexAttributeFlags::UVs) {
-            geometry->SetAttribute({.type = GeometryAttributeType::UV, .item_size = 2});
+        auto mat = static_cast<PhongMaterial*>(stream->materials[i].get());
+        if (auto texture_map = texture->TryGet()) {
+            apply_texture(mat, texture_map);
+            continue;
         }
 
-        auto mat_index = geometry_header.material_index;
-        if (mat_index != -1 && mat_index < materials.size()) {
-            root->Add(Mesh::Create(geometry, materials[mat_index]));
+        auto it = std::ranges::find(requests, texture, &decltype(requests)::value_type::first);
+        if (it != requests.end()) {
+            it->second.push_back(mat);
         } else {
-            root->Add(Mesh::Create(geometry, PhongMaterial::Create()));
+            requests.emplace_back(texture, std::vector {mat});
+        }
+    }
+
+    stream->pending_textures = requests.size();
+    for (auto& [texture, materials] : requests) {
+        LoadQueue::Get().Submit([stream, texture, materials]() {
+            auto texture_map = stream->options.token.IsCancelled() ? nullptr : texture->Get();
+            LoadQueue::Get().PostToMainThread([stream, texture_map, materials]() {
+                if (!stream->options.token.IsCancelled()) {
+                    for (auto mat : materials) apply_texture(mat, texture_map);
+                }
+                --stream->pending_textures;
+                complete_if_done(stream);
+            });
+        }, stream->options.priority);
+    }
+}
+
+auto attach_entry(const std::shared_ptr<MeshStream>& stream, const std::shared_ptr<Mesh>& mesh) {
+    const auto& token = stream->options.token;
+    if (!token.IsCancelled()) {
+        stream->root->Add(mesh);
+        ++stream->loaded;
+        if (stream->options.on_progress) {
+            stream->options.on_progress({mesh, stream->loaded, stream->file.header.mesh_count});
+        }
+        complete_if_done(stream);
+    }
+
+    // The reader pauses when it's too far ahead, and resumes once an entry
+    // makes room.
+    auto resume = false;
+    {
+        const auto lock = std::scoped_lock(stream->mutex);
+        --stream->in_flight;
+        resume = !stream->reading && stream->next < stream->file.header.mesh_count && !token.IsCancelled();
+        if (resume) stream->reading = true;
+    }
+    if (resume) {
+        LoadQueue::Get().Submit([stream]() { stream_entries(stream); }, stream->options.priority);
+    }
+}
+
+auto stream_entries(const std::shared_ptr<MeshStream>& stream) -> void {
+    GLEAM_PROFILE_ZONE("MeshLoader::StreamEntries");
+    const auto count = stream->file.header.mesh_count;
+    const auto max_in_flight = std::max<std::size_t>(stream->options.max_in_flight, 1);
+
+    // Only one reader runs at a time, so the file isn't locked.
+    while (true) {
+        {
+            const auto lock = std::scoped_lock(stream->mutex);
+            if (stream->options.token.IsCancelled() || stream->next == count || stream->in_flight >= max_in_flight) {
+                stream->reading = false;
+                return;
+            }
+            ++stream->next;
+            ++stream->in_flight;
         }
+
+        auto result = load_entry(stream->file, stream->path, stream->residency);
+        if (!result) {
+            {
+                const auto lock = std::scoped_lock(stream->mutex);
+                stream->next = count;
+                stream->reading = false;
+            }
+            LoadQueue::Get().PostToMainThread([stream, error = result.error()]() {
+                if (stream->options.on_error && !stream->options.token.IsCancelled()) {
+                    stream->options.on_error(error);
+                }
+            });
+            return;
+        }
+
+        const auto& [geometry, mat_index] = result.value();
+        auto mesh = make_mesh(geometry, mat_index, stream->materials);
+        LoadQueue::Get().PostToMainThread([stream, mesh]() { attach_entry(stream, mesh); });
+    }
+}
+
+} // unnamed namespace
+
+auto MeshLoader::LoadImpl(const fs::path& path) const -> LoaderResult<Node> {
+    GLEAM_PROFILE_ZONE("MeshLoader::Load");
+    auto file = open_mesh_file(path);
+    if (!file) return std::unexpected(file.error());
+
+    auto pending = request_materials(path, file->header.material_count, file->reader);
+    auto geometries = std::vector<std::pair<std::shared_ptr<Geometry>, uint32_t>> {};
+    geometries.reserve(file->header.mesh_count);
+
+    for (auto i = uint32_t {0}; i < file->header.mesh_count; ++i) {
+        auto result = load_entry(file.value(), path, params_.residency);
+        if (!result) return std::unexpected(result.error());
+        geometries.emplace_back(std::move(result.value()));
     }
 
+    const auto materials = create_materials(pending);
+    auto root = Node::Create();
+    for (const auto& [geometry, mat_index] : geometries) {
+        root->Add(make_mesh(geometry, mat_index, materials));
+    }
+
+    return root;
+}
+
+auto MeshLoader::LoadStreaming(const fs::path& path, const MeshStreamOptions& options) const
+    -> LoaderResult<Node>
+{
+    GLEAM_PROFILE_ZONE("MeshLoader::LoadStreaming");
+    if (!Archive::Contains(path) && !fs::exists(path)) {
+        return std::unexpected("File not found '" + path.string() + "'");
+    }
+
+    auto file = open_mesh_file(path);
+    if (!file) return std::unexpected(file.error());
+
+    auto stream = std::make_shared<MeshStream>(
+        path,
+        std::move(file.value()),
+        options,
+        params_.residency,
+        Node::Create()
+    );
+    auto pending = request_materials(path, stream->file.header.material_count, stream->file.reader);
+    for (auto& material : pending) {
+        stream->materials.emplace_back(create_material(material.header));
+    }
+
+    const auto root = stream->root;
+    LoadQueue::Get().Submit([stream]() { stream_entries(stream); }, options.priority);
+    stream_textures(stream, pending);
+
+    // Files without entries or textures have nothing left to wait for.
+    if (stream->file.header.mesh_count == 0 && stream->pending_textures == 0) {
+        LoadQueue::Get().PostToMainThread([stream]() { complete_if_done(stream); });
+    }
     return root;
 }
 
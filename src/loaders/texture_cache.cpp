@@ -0,0 +1,98 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "loaders/texture_cache.hpp"
+
+#include "gleam/loaders/load_queue.hpp"
+
+#include "utilities/logger.hpp"
+#include "utilities/profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <system_error>
+
+namespace gleam {
+
+namespace {
+
+// Number of entries the cache can hold before the first prune.
+constexpr auto min_prune_size = std::size_t {64};
+
+auto cache_key(const fs::path& path) {
+    // Different spellings of the same file share an entry.
+    auto error = std::error_code {};
+    auto canonical = fs::weakly_canonical(path, error);
+    return error ? path.lexically_normal().string() : canonical.string();
+}
+
+} // unnamed namespace
+
+auto TextureRequest::Get() -> std::shared_ptr<Texture2D> {
+    Run();
+    return future_.get();
+}
+
+auto TextureRequest::TryGet() const -> std::shared_ptr<Texture2D> {
+    const auto ready = future_.wait_for(std::chrono::seconds::zero()) == std::future_status::ready;
+    return ready ? future_.get() : nullptr;
+}
+
+auto TextureRequest::Run() -> void {
+    if (claimed_.exchange(true, std::memory_order_acq_rel)) return;
+    promise_.set_value(TextureCache::Get().Load(path_));
+}
+
+auto TextureCache::Get() -> TextureCache& {
+    // Never destroyed, so queued loads can't outlive it at exit.
+    static auto instance = new TextureCache();
+    return *instance;
+}
+
+auto TextureCache::Request(const fs::path& path) -> std::shared_ptr<TextureRequest> {
+    const auto key = cache_key(path);
+    auto request = std::make_shared<TextureRequest>(path);
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        if (entries_.size() >= prune_size_) Prune();
+        auto& entry = entries_[key];
+        if (auto texture = entry.texture.lock()) {
+            request->claimed_ = true;
+            request->promise_.set_value(texture);
+            return request;
+        }
+        if (auto pending = entry.request.lock()) return pending;
+        entry.request = request;
+    }
+
+    LoadQueue::Get().Submit([request]() { request->Run(); }, LoadPriority::Normal);
+    return request;
+}
+
+auto TextureCache::Prune() -> void {
+    std::erase_if(entries_, [](const auto& item) {
+        return item.second.texture.expired() && item.second.request.expired();
+    });
+
+    // Waiting for the cache to double again keeps pruning amortized constant.
+    prune_size_ = std::max(min_prune_size, entries_.size() * 2);
+}
+
+auto TextureCache::Load(const fs::path& path) -> std::shared_ptr<Texture2D> {
+    GLEAM_PROFILE_ZONE("TextureCache::Load");
+    auto result = loader_->Load(path);
+    if (!result) {
+        Logger::Log(LogLevel::Warning, "Failed to load texture: {}", result.error());
+        return nullptr;
+    }
+
+    const auto lock = std::scoped_lock(mutex_);
+    entries_[cache_key(path)].texture = result.value();
+    return result.value();
+}
+
+}
\ No newline at end of file
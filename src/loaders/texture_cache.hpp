@@ -0,0 +1,121 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "gleam/loaders/texture_loader.hpp"
+#include "gleam/textures/texture_2d.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace gleam {
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Texture load shared by every caller that asked for the same file.
+ *
+ * The load is queued on the load queue when it's requested, but any caller
+ * that needs the result can run it inline if no worker has picked it up
+ * yet, so waiting on a request never depends on a free worker.
+ */
+class TextureRequest {
+public:
+    explicit TextureRequest(const fs::path& path)
+      : path_(path), future_(promise_.get_future().share()) {}
+
+    /**
+     * @brief Runs the load on the calling thread unless it already started
+     * elsewhere, then waits for the result.
+     *
+     * @return std::shared_ptr<Texture2D> Null if the texture failed to load.
+     */
+    auto Get() -> std::shared_ptr<Texture2D>;
+
+    /**
+     * @brief Returns the result without waiting.
+     *
+     * @return std::shared_ptr<Texture2D> Null if the load hasn't finished or failed.
+     */
+    [[nodiscard]] auto TryGet() const -> std::shared_ptr<Texture2D>;
+
+private:
+    friend class TextureCache;
+
+    fs::path path_;
+
+    std::promise<std::shared_ptr<Texture2D>> promise_;
+
+    std::shared_future<std::shared_ptr<Texture2D>> future_;
+
+    std::atomic<bool> claimed_ {false};
+
+    auto Run() -> void;
+};
+
+/**
+ * @brief Process-wide cache that deduplicates texture loads by path.
+ *
+ * Textures are held weakly, so a texture stays cached for as long as a
+ * material references it and is loaded again once it's gone. Entries of
+ * textures that are gone are pruned as the cache grows. Concurrent requests
+ * for the same file share a single load.
+ */
+class TextureCache {
+public:
+    /**
+     * @brief Returns the texture cache shared by all loaders.
+     *
+     * @return TextureCache&
+     */
+    [[nodiscard]] static auto Get() -> TextureCache&;
+
+    TextureCache(const TextureCache&) = delete;
+    TextureCache(TextureCache&&) = delete;
+    auto operator=(const TextureCache&) -> TextureCache& = delete;
+    auto operator=(TextureCache&&) -> TextureCache& = delete;
+
+    /**
+     * @brief Requests a texture, starting a background load if it isn't
+     * cached or already being loaded.
+     *
+     * @param path File system path to the texture.
+     * @return std::shared_ptr<TextureRequest>
+     */
+    [[nodiscard]] auto Request(const fs::path& path) -> std::shared_ptr<TextureRequest>;
+
+private:
+    friend class TextureRequest;
+
+    struct Entry {
+        std::weak_ptr<Texture2D> texture;
+        std::weak_ptr<TextureRequest> request;
+    };
+
+    std::unordered_map<std::string, Entry> entries_;
+
+    // Size of the cache at which entries of textures that are gone are dropped.
+    std::size_t prune_size_ {0};
+
+    std::mutex mutex_;
+
+    std::shared_ptr<TextureLoader> loader_ {TextureLoader::Create()};
+
+    TextureCache() = default;
+
+    auto Load(const fs::path& path) -> std::shared_ptr<Texture2D>;
+
+    auto Prune() -> void;
+};
+
+}
\ No newline at end of file
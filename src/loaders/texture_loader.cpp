@@ -7,25 +7,53 @@
 
 #include "gleam/loaders/texture_loader.hpp"
 
-#include "utilities/file.hpp"
+#include "loaders/archive_reader.hpp"
+#include "utilities/profiler.hpp"
 
 #include "asset_builder/include/types.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
-#include <fstream>
+#include <expected>
+#include <string>
+#include <vector>
 
 namespace gleam {
 
-auto TextureLoader::LoadImpl(const fs::path& path) const -> LoaderResult<Texture2D> {
-    auto file = std::ifstream {path, std::ios::binary};
-    auto path_s = path.string();
-    if (!file) {
-        return std::unexpected("Unable to open file '" + path_s + "'");
+namespace {
+
+struct TextureFile {
+    TextureHeader header;
+    std::vector<uint8_t> data;
+};
+
+auto max_mip_levels(uint32_t width, uint32_t height) {
+    auto levels = 1u;
+    for (auto size = std::max(width, height); size > 1; size >>= 1) ++levels;
+    return levels;
+}
+
+auto mip_chain_size(const TextureHeader& header) {
+    const auto format = static_cast<TextureFormat>(header.format);
+    auto size = uint64_t {0};
+    for (auto level = 0u; level < header.mip_levels; ++level) {
+        const auto width = std::max(header.width >> level, 1u);
+        const auto height = std::max(header.height >> level, 1u);
+        size += Texture2D::ImageSize(format, width, height);
     }
+    return size;
+}
+
+auto read_texture_file(const fs::path& path) -> std::expected<TextureFile, std::string> {
+    auto path_s = path.string();
+    auto asset = open_asset(path);
+    if (!asset) return std::unexpected(asset.error());
 
-    auto header = TextureHeader {};
-    read_binary(file, header);
-    if (std::memcmp(header.magic, "TEX0", 4) != 0) {
+    auto output = TextureFile {};
+    auto& header = output.header;
+    auto reader = ByteReader {asset->bytes};
+    if (!reader.Read(header) || std::memcmp(header.magic, "TEX0", 4) != 0) {
         return std::unexpected("Invalid texture file '" + path_s + "'");
     }
 
@@ -33,16 +61,49 @@ auto TextureLoader::LoadImpl(const fs::path& path) const -> LoaderResult<Texture
         return std::unexpected("Unsupported texture version in file '" + path_s + "'");
     }
 
-    auto data = std::vector<uint8_t>(header.pixel_data_size);
-    read_binary(file, data, header.pixel_data_size);
+    if (header.format > static_cast<uint32_t>(TextureFormat::BC7)) {
+        return std::unexpected("Unsupported texture format in file '" + path_s + "'");
+    }
+
+    if (header.mip_levels == 0 || header.mip_levels > max_mip_levels(header.width, header.height)) {
+        return std::unexpected("Invalid mip levels in texture file '" + path_s + "'");
+    }
+
+    if (header.pixel_data_size != mip_chain_size(header)) {
+        return std::unexpected("Texture has inconsistent data size in file '" + path_s + "'");
+    }
+
+    const auto pixels = reader.Take(header.pixel_data_size);
+    if (pixels.size() != header.pixel_data_size) {
+        return std::unexpected("Truncated texture file '" + path_s + "'");
+    }
+
+    output.data.resize(pixels.size());
+    std::memcpy(output.data.data(), pixels.data(), pixels.size());
+
+    return output;
+}
+
+} // unnamed namespace
+
+auto TextureLoader::LoadImpl(const fs::path& path) const -> LoaderResult<Texture2D> {
+    GLEAM_PROFILE_ZONE("TextureLoader::Load");
+    auto file = read_texture_file(path);
+    if (!file) return std::unexpected(file.error());
 
     auto texture = std::make_shared<Texture2D>(Texture2D::Parameters {
-        .width = header.width,
-        .height = header.height,
-        .data = std::move(data)
+        .width = file->header.width,
+        .height = file->header.height,
+        .data = std::move(file->data),
+        .mip_levels = file->header.mip_levels,
+        .format = static_cast<TextureFormat>(file->header.format)
     });
 
     texture->SetName(path.filename().string());
+    texture->SetReloader([path]() {
+        auto file = read_texture_file(path);
+        return file ? std::move(file->data) : std::vector<uint8_t> {};
+    });
 
     return texture;
 }
@@ -7,58 +7,57 @@
 
 #include "gleam/math/utilities.hpp"
 
+#include <array>
+#include <atomic>
+#include <cstdio>
 #include <random>
-#include <iomanip>
-#include <sstream>
 
 namespace gleam::math {
 
-auto GenerateUUID() -> std::string {
-    static std::vector<std::string> lut{
-        "00", "01", "02", "03", "04", "05", "06", "07", "08", "09", "0a",
-        "0b", "0c", "0d", "0e", "0f", "10", "11", "12", "13", "14", "15",
-        "16", "17", "18", "19", "1a", "1b", "1c", "1d", "1e", "1f", "20",
-        "21", "22", "23", "24", "25", "26", "27", "28", "29", "2a", "2b",
-        "2c", "2d", "2e", "2f", "30", "31", "32", "33", "34", "35", "36",
-        "37", "38", "39", "3a", "3b", "3c", "3d", "3e", "3f", "40", "41",
-        "42", "43", "44", "45", "46", "47", "48", "49", "4a", "4b", "4c",
-        "4d", "4e", "4f", "50", "51", "52", "53", "54", "55", "56", "57",
-        "58", "59", "5a", "5b", "5c", "5d", "5e", "5f", "60", "61", "62",
-        "63", "64", "65", "66", "67", "68", "69", "6a", "6b", "6c", "6d",
-        "6e", "6f", "70", "71", "72", "73", "74", "75", "76", "77", "78",
-        "79", "7a", "7b", "7c", "7d", "7e", "7f", "80", "81", "82", "83",
-        "84", "85", "86", "87", "88", "89", "8a", "8b", "8c", "8d", "8e",
-        "8f", "90", "91", "92", "93", "94", "95", "96", "97", "98", "99",
-        "9a", "9b", "9c", "9d", "9e", "9f", "a0", "a1", "a2", "a3", "a4",
-        "a5", "a6", "a7", "a8", "a9", "aa", "ab", "ac", "ad", "ae", "af",
-        "b0", "b1", "b2", "b3", "b4", "b5", "b6", "b7", "b8", "b9", "ba",
-        "bb", "bc", "bd", "be", "bf", "c0", "c1", "c2", "c3", "c4", "c5",
-        "c6", "c7", "c8", "c9", "ca", "cb", "cc", "cd", "ce", "cf", "d0",
-        "d1", "d2", "d3", "d4", "d5", "d6", "d7", "d8", "d9", "da", "db",
-        "dc", "dd", "de", "df", "e0", "e1", "e2", "e3", "e4", "e5", "e6",
-        "e7", "e8", "e9", "ea", "eb", "ec", "ed", "ee", "ef", "f0", "f1",
-        "f2", "f3", "f4", "f5", "f6", "f7", "f8", "f9", "fa", "fb", "fc",
-        "fd", "fe", "ff"
-    };
+namespace {
 
-    static std::random_device rd;
-    static std::mt19937 e2(rd());
-    static std::uniform_real_distribution dist(0.0, 1.0);
+auto splitmix64(uint64_t& state) {
+    auto z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
 
-    const auto d0 = static_cast<size_t>(dist(e2) * 0xffffffff) | 0;
-    const auto d1 = static_cast<size_t>(dist(e2) * 0xffffffff) | 0;
-    const auto d2 = static_cast<size_t>(dist(e2) * 0xffffffff) | 0;
-    const auto d3 = static_cast<size_t>(dist(e2) * 0xffffffff) | 0;
+auto generate_seed() -> uint64_t {
+    // Each thread draws its own seed once. The counter keeps seeds distinct
+    // on platforms where std::random_device is deterministic.
+    static std::atomic<uint64_t> counter {0};
+    auto rd = std::random_device {};
+    auto seed = (static_cast<uint64_t>(rd()) << 32) | rd();
+    return seed ^ (counter.fetch_add(1, std::memory_order_relaxed) * 0xD1B54A32D192ED03ULL);
+}
 
-    auto uuid = lut[d0 & 0xff] + lut[d0 >> 8 & 0xff] + lut[d0 >> 16 & 0xff] +
-                lut[d0 >> 24 & 0xff] + '-' + lut[d1 & 0xff] +
-                lut[d1 >> 8 & 0xff]  + '-' + lut[d1 >> 16 & 0x0f | 0x40] +
-                lut[d1 >> 24 & 0xff] + '-' + lut[d2 & 0x3f | 0x80] +
-                lut[d2 >> 8 & 0xff]  + '-' + lut[d2 >> 16 & 0xff] +
-                lut[d2 >> 24 & 0xff] + lut[d3 & 0xff] + lut[d3 >> 8 & 0xff] +
-                lut[d3 >> 16 & 0xff] + lut[d3 >> 24 & 0xff];
+} // unnamed namespace
 
+auto UUID::Generate() -> UUID {
+    thread_local auto state = generate_seed();
+
+    auto uuid = UUID {splitmix64(state), splitmix64(state)};
+    uuid.hi = (uuid.hi & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL; // version 4
+    uuid.lo = (uuid.lo & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL; // variant 1
     return uuid;
 }
 
+auto UUID::ToString() const -> std::string {
+    auto buffer = std::array<char, 37> {};
+    std::snprintf(buffer.data(), buffer.size(),
+        "%08x-%04x-%04x-%04x-%012llx",
+        static_cast<unsigned>(hi >> 32),
+        static_cast<unsigned>((hi >> 16) & 0xFFFF),
+        static_cast<unsigned>(hi & 0xFFFF),
+        static_cast<unsigned>(lo >> 48),
+        static_cast<unsigned long long>(lo & 0xFFFFFFFFFFFFULL)
+    );
+    return std::string(buffer.data());
+}
+
+auto GenerateUUID() -> std::string {
+    return UUID::Generate().ToString();
+}
+
 }
\ No newline at end of file
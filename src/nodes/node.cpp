@@ -12,7 +12,6 @@
 #include "core/event_dispatcher.hpp"
 #include "utilities/logger.hpp"
 
-#include <queue>
 #include <ranges>
 
 namespace gleam {
@@ -30,6 +29,24 @@ auto Node::Add(const std::shared_ptr<Node>& node) -> void {
     );
 }
 
+auto Node::AddChildren(const std::vector<std::shared_ptr<Node>>& nodes) -> void {
+    if (nodes.empty()) return;
+
+    children_.reserve(children_.size() + nodes.size());
+    for (const auto& node : nodes) {
+        if (node->parent_) {
+            node->parent_->Remove(node);
+        }
+        node->parent_ = this;
+        children_.emplace_back(node);
+    }
+
+    EventDispatcher::Get().Dispatch(
+        "node_added",
+        std::make_unique<SceneEvent>(SceneEvent::Type::NodesAdded, nodes)
+    );
+}
+
 auto Node::Remove(const std::shared_ptr<Node>& node) -> void {
     auto it = std::ranges::find(children_, node);
     if (it != children_.end()) {
@@ -65,23 +82,10 @@ auto Node::Children() -> std::vector<std::shared_ptr<Node>>& {
 }
 
 auto Node::IsChild(const Node* node) const -> bool {
-    auto to_process = std::queue<std::shared_ptr<Node>>();
-    for (const auto& child : children_) {
-        to_process.push(child);
+    if (node == nullptr) return false;
+    for (auto current = node->parent_; current != nullptr; current = current->parent_) {
+        if (current == this) return true;
     }
-
-    while (!to_process.empty()) {
-        auto len = to_process.size();
-        for (auto i = 0; i < len; ++i) {
-            const auto current = to_process.front();
-            to_process.pop();
-            if (current.get() == node) return true;
-            for (const auto& child : current->children_) {
-                to_process.push(child);
-            }
-        }
-    }
-
     return false;
 }
 
@@ -157,18 +161,20 @@ auto Node::LookAt(const Vector3& target) -> void {
         : transform.LookAt(target, position, up);
 }
 
-auto Node::AttachRecursive(SharedContext* context) -> void {
+auto Node::AttachRecursive(SharedContext* context, Scene* scene) -> void {
     context_ = context;
+    scene_ = scene;
     OnAttached();
     for (const auto& child : children_) {
         if (child != nullptr) {
-            child->AttachRecursive(context);
+            child->AttachRecursive(context, scene);
         }
     }
 }
 
 auto Node::DetachRecursive() -> void {
     context_ = nullptr;
+    scene_ = nullptr;
     for (const auto& child : children_) {
         if (child != nullptr) {
             child->DetachRecursive();
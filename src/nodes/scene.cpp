@@ -9,6 +9,7 @@
 
 #include "core/event_dispatcher.hpp"
 #include "utilities/logger.hpp"
+#include "utilities/profiler.hpp"
 
 #include <algorithm>
 #include <memory>
@@ -17,6 +18,7 @@
 namespace gleam {
 
 Scene::Scene() {
+    scene_ = this;
     AddEventListeners();
 }
 
@@ -45,6 +47,7 @@ auto Scene::AddEventListeners() -> void {
 }
 
 auto Scene::ProcessUpdates(float delta) -> void {
+    GLEAM_PROFILE_ZONE("Scene::ProcessUpdates");
     OnUpdate(delta);
      for (const auto& child : Children()) {
         HandleNodeUpdates(child, delta);
@@ -79,16 +82,38 @@ auto Scene::HandleInputEvent(std::weak_ptr<Node> node, Event* event) -> void {
 }
 
 auto Scene::HandleSceneEvents(const SceneEvent* event) -> void {
+    GLEAM_PROFILE_ZONE("Scene::HandleSceneEvents");
     using enum SceneEvent::Type;
-    if (IsChild(event->node.get())) {
+
+    // Every node caches a pointer to the scene that contains it, so membership
+    // is resolved through the parent of the added node instead of searching
+    // the scene graph.
+    if (event->type == NodeAdded) {
+        const auto parent = event->node->parent_;
+        if (parent && parent->scene_ == this) {
+            touched_ = true;
+            event->node->AttachRecursive(context_, this);
+        }
+    }
+
+    if (event->type == NodesAdded && !event->nodes.empty()) {
+        const auto parent = event->nodes.front()->parent_;
+        if (parent && parent->scene_ == this) {
+            touched_ = true;
+            for (const auto& node : event->nodes) {
+                node->AttachRecursive(context_, this);
+            }
+        }
+    }
+
+    if (event->type == NodeRemoved && event->node->scene_ == this) {
         touched_ = true;
-        if (event->type == NodeAdded) event->node->AttachRecursive(context_);
-        if (event->type == NodeRemoved) event->node->DetachRecursive();
+        event->node->DetachRecursive();
     }
 }
 
 auto Scene::SetContext(SharedContext* context) -> void {
-    this->AttachRecursive(context);
+    this->AttachRecursive(context, this);
 }
 
 Scene::~Scene() {
@@ -96,6 +121,14 @@ Scene::~Scene() {
     EventDispatcher::Get().RemoveEventListener("node_removed", scene_event_listener_);
     EventDispatcher::Get().RemoveEventListener("keyboard_event", input_event_listener_);
     EventDispatcher::Get().RemoveEventListener("mouse_event", input_event_listener_);
+
+    // Nodes can outlive the scene, and their cached scene pointer must not
+    // match another scene allocated at the same address.
+    for (const auto& child : Children()) {
+        if (child != nullptr) {
+            child->DetachRecursive();
+        }
+    }
 }
 
 }
\ No newline at end of file
@@ -15,33 +15,85 @@ namespace gleam {
 
 #define BUFFER_OFFSET(offset) ((void*)(offset * sizeof(GLfloat)))
 
-auto GLBuffers::Bind(const std::shared_ptr<Geometry>& geometry) -> void {
-    auto vao = geometry->renderer_id;
-    if (vao != 0 && vao == current_vao_) return;
+auto GLBuffers::Bind(GLuint vao) -> void {
+    if (vao == current_vao_) return;
 
-    if (vao == 0) {
-        GenerateBuffers(geometry.get());
-        vao = geometry->renderer_id;
+    glBindVertexArray(vao);
+    current_vao_ = vao;
+    bind_count_++;
+}
+
+auto GLBuffers::Upload(const std::shared_ptr<Geometry>& geometry) -> std::size_t {
+    if (geometry->renderer_id != 0 || uncommitted_.contains(geometry.get())) return 0;
+
+    const auto uploaded = uploaded_bytes_;
+    const auto vao = GenerateBuffers(geometry.get());
+    uncommitted_.try_emplace(geometry.get(), geometry, vao);
+
+    // Unbind the new vertex array so later uploads can't modify its state.
+    glBindVertexArray(0);
+    current_vao_ = 0;
+    return uploaded_bytes_ - uploaded;
+}
+
+auto GLBuffers::UncommittedId(const Geometry* geometry) const -> GLuint {
+    const auto it = uncommitted_.find(geometry);
+    return it != uncommitted_.end() ? it->second.second : 0;
+}
+
+auto GLBuffers::Commit() -> void {
+    for (auto& [_, entry] : uncommitted_) {
+        auto& [geometry, vao] = entry;
+        if (geometry->Disposed()) {
+            DeleteBuffers(vao);
+            continue;
+        }
+
+        geometry->renderer_id = vao;
+        geometry->OnDispose([this](Disposable* target){
+            const auto vao = static_cast<Geometry*>(target)->renderer_id;
+            if (std::this_thread::get_id() != gl_thread_) {
+                const auto lock = std::scoped_lock(disposed_mutex_);
+                disposed_.emplace_back(vao);
+                return;
+            }
+            DeleteBuffers(vao);
+            Logger::Log(LogLevel::Info, "Geometry buffer cleared {}", *static_cast<Geometry*>(target));
+        });
         geometries_.emplace_back(geometry);
+        if (geometry->residency != ResidencyPolicy::Keep) {
+            pending_release_.emplace_back(geometry);
+        }
     }
+    uncommitted_.clear();
+}
 
-    glBindVertexArray(vao);
-    current_vao_ = vao;
+auto GLBuffers::UploadSize(const Geometry& geometry) -> std::size_t {
+    // Counts survive a release, so this holds for geometries to be reloaded.
+    const auto floats = geometry.VertexCount() * geometry.Stride();
+    return floats * sizeof(GLfloat) + geometry.IndexCount() * sizeof(GLuint);
 }
 
-auto GLBuffers::GenerateBuffers(Geometry* geometry) -> void {
-    auto& vao = geometry->renderer_id;
+auto GLBuffers::GenerateBuffers(Geometry* geometry) -> GLuint {
+    auto vao = GLuint {0};
     auto buffers = std::array<GLuint, 2> {};
 
+    // Released data is reloaded when the snapshot is swapped in, so it's only
+    // missing here if that failed.
+    if (geometry->IsReleased()) {
+        Logger::Log(LogLevel::Error, "Uploading a geometry whose data was released {}", *geometry);
+    }
+
     glGenVertexArrays(1, &vao);
-    glBindVertexArray(geometry->renderer_id);
+    glBindVertexArray(vao);
     glGenBuffers(buffers.size(), buffers.data());
 
-    const auto& vertex = geometry->VertexData();
+    const auto vertex = geometry->VertexData();
+    auto bytes = vertex.size() * sizeof(GLfloat);
     glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
     glBufferData(
         GL_ARRAY_BUFFER,
-        vertex.size() * sizeof(GLfloat),
+        bytes,
         vertex.data(),
         GL_STATIC_DRAW
     );
@@ -66,8 +118,7 @@ auto GLBuffers::GenerateBuffers(Geometry* geometry) -> void {
         offset += attr.item_size;
     }
 
-    if (geometry->IndexData().size()) {
-        const auto& index = geometry->IndexData();
+    if (const auto index = geometry->IndexData(); !index.empty()) {
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
         glBufferData(
             GL_ELEMENT_ARRAY_BUFFER,
@@ -75,20 +126,49 @@ auto GLBuffers::GenerateBuffers(Geometry* geometry) -> void {
             index.data(),
             GL_STATIC_DRAW
         );
+        bytes += index.size() * sizeof(GLuint);
     }
 
-    bindings_.try_emplace(vao, std::move(buffers));
+    bindings_.try_emplace(vao, Binding {buffers, bytes, bytes});
+    uploaded_bytes_ += bytes;
+    memory_bytes_ += bytes;
+    cpu_memory_bytes_ += bytes;
+    return vao;
+}
 
-    geometry->OnDispose([this](Disposable* target){
-        const auto vao = static_cast<Geometry*>(target)->renderer_id;
-        auto& buffers = this->bindings_[vao];
-        glDeleteBuffers(buffers.size(), buffers.data());
-        Logger::Log(LogLevel::Info, "Geometry buffer cleared {}", *static_cast<Geometry*>(target));
-        this->bindings_.erase(vao);
-    });
+auto GLBuffers::DeleteBuffers(GLuint vao) -> void {
+    auto it = bindings_.find(vao);
+    if (it == bindings_.end()) return;
+    auto& buffers = it->second.buffers;
+    glDeleteBuffers(buffers.size(), buffers.data());
+    memory_bytes_ -= it->second.bytes;
+    cpu_memory_bytes_ -= it->second.cpu_bytes;
+    bindings_.erase(it);
+    if (current_vao_ == vao) current_vao_ = 0;
+}
+
+auto GLBuffers::ReleaseDisposed() -> void {
+    const auto lock = std::scoped_lock(disposed_mutex_);
+    for (auto vao : disposed_) DeleteBuffers(vao);
+    disposed_.clear();
+}
+
+auto GLBuffers::ReleaseUploadedData() -> void {
+    for (const auto& geometry : pending_release_) {
+        auto g = geometry.lock();
+        if (!g) continue;
+        if (auto it = bindings_.find(g->renderer_id); it != bindings_.end()) {
+            cpu_memory_bytes_ -= it->second.cpu_bytes;
+            it->second.cpu_bytes = 0;
+        }
+        g->ReleaseData();
+    }
+    pending_release_.clear();
 }
 
 GLBuffers::~GLBuffers() {
+    ReleaseDisposed();
+    for (const auto& [_, entry] : uncommitted_) DeleteBuffers(entry.second);
     for (const auto& geometry : geometries_) {
         if (auto g = geometry.lock()) g->Dispose();
     }
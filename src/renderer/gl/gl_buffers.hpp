@@ -11,8 +11,11 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <glad/glad.h>
@@ -28,18 +31,106 @@ public:
     GLBuffers& operator=(const GLBuffers&) = delete;
     GLBuffers& operator=(GLBuffers&&) = delete;
 
-    auto Bind(const std::shared_ptr<Geometry>& geometry) -> void;
+    /**
+     * @brief Binds the vertex array of an uploaded geometry.
+     */
+    auto Bind(GLuint vao) -> void;
+
+    /**
+     * @brief Creates the buffers of a geometry and uploads its data.
+     *
+     * The geometry itself isn't modified, its vertex array is assigned to it
+     * by Commit(), so the upload can run while another thread updates the
+     * scene.
+     *
+     * @return std::size_t Number of bytes uploaded.
+     */
+    auto Upload(const std::shared_ptr<Geometry>& geometry) -> std::size_t;
+
+    /**
+     * @brief Returns the vertex array of a geometry uploaded since the last
+     * commit, or 0.
+     */
+    [[nodiscard]] auto UncommittedId(const Geometry* geometry) const -> GLuint;
+
+    /**
+     * @brief Assigns the vertex arrays of geometries uploaded since the last
+     * call and registers their dispose callbacks. Buffers of geometries that
+     * were disposed in the meantime are deleted. Must be called while no
+     * frame is being prepared.
+     */
+    auto Commit() -> void;
+
+    /**
+     * @brief Returns the number of bytes an upload of the geometry would take.
+     */
+    [[nodiscard]] static auto UploadSize(const Geometry& geometry) -> std::size_t;
+
+    auto ReleaseDisposed() -> void;
+
+    /**
+     * @brief Releases the CPU copy of geometries uploaded since the last call,
+     * unless their residency policy keeps it. Must be called while no frame
+     * is being prepared.
+     */
+    auto ReleaseUploadedData() -> void;
+
+    /// @brief Number of vertex array binds since the counters were reset.
+    [[nodiscard]] auto BindCount() const { return bind_count_; }
+
+    /// @brief Bytes of vertex and index data uploaded since the counters were reset.
+    [[nodiscard]] auto UploadedBytes() const { return uploaded_bytes_; }
+
+    /// @brief Bytes of vertex and index data currently held in GPU buffers.
+    [[nodiscard]] auto MemoryBytes() const { return memory_bytes_; }
+
+    /// @brief Bytes of vertex and index data uploaded geometries still keep on the CPU.
+    [[nodiscard]] auto CPUMemoryBytes() const { return cpu_memory_bytes_; }
+
+    auto ResetCounters() -> void {
+        bind_count_ = 0;
+        uploaded_bytes_ = 0;
+    }
 
     ~GLBuffers();
 
 private:
-    std::unordered_map<GLuint, std::array<GLuint, 2>> bindings_;
+    struct Binding {
+        std::array<GLuint, 2> buffers {};
+        std::size_t bytes {0};
+        std::size_t cpu_bytes {0};
+    };
+
+    std::unordered_map<GLuint, Binding> bindings_;
+
+    // Geometries disposed on other threads are released on the GL thread.
+    std::vector<GLuint> disposed_;
+
+    std::mutex disposed_mutex_;
+
+    std::thread::id gl_thread_ {std::this_thread::get_id()};
 
     std::vector<std::weak_ptr<Geometry>> geometries_;
 
+    // Uploaded geometries whose vertex arrays haven't been assigned to them yet.
+    std::unordered_map<const Geometry*, std::pair<std::shared_ptr<Geometry>, GLuint>> uncommitted_;
+
+    // Uploaded geometries whose CPU copy is released at the next safe point.
+    std::vector<std::weak_ptr<Geometry>> pending_release_;
+
     GLuint current_vao_ {0};
 
-    auto GenerateBuffers(Geometry* geometry) -> void;
+    std::size_t bind_count_ {0};
+
+    std::size_t uploaded_bytes_ {0};
+
+    std::size_t memory_bytes_ {0};
+
+    std::size_t cpu_memory_bytes_ {0};
+
+    auto GenerateBuffers(Geometry* geometry) -> GLuint;
+
+    auto DeleteBuffers(GLuint vao) -> void;
 };
 
 }
\ No newline at end of file
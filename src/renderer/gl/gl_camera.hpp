@@ -16,7 +16,7 @@ public:
     auto Update(const Matrix4& projection, const Matrix4& view) {
         camera_.projection = projection;
         camera_.view = view;
-        uniform_buffer_.UploadIfNeeded(&camera_, sizeof(camera_));
+        return uniform_buffer_.UploadIfNeeded(&camera_, sizeof(camera_));
     }
 
 private:
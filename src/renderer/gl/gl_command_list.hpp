@@ -0,0 +1,32 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "core/render_lists.hpp"
+
+#include <vector>
+
+namespace gleam {
+
+struct GLDrawCommand {
+    /// @brief Copy of the proxy to draw, taken when the frame was prepared.
+    RenderProxy proxy {};
+
+    /// @brief Distance from the camera along the view direction.
+    float depth {0.0f};
+};
+
+struct GLCommandList {
+    /// @brief Opaque draws, grouped by program and sorted front-to-back.
+    std::vector<GLDrawCommand> opaque;
+
+    /// @brief Transparent draws, sorted back-to-front.
+    std::vector<GLDrawCommand> transparent;
+};
+
+}
\ No newline at end of file
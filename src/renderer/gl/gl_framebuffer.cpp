@@ -0,0 +1,64 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_framebuffer.hpp"
+
+#include "utilities/logger.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace gleam {
+
+GLFramebuffer::GLFramebuffer(int width, int height) {
+    glGenFramebuffers(1, &framebuffer_);
+    glGenRenderbuffers(2, renderbuffers_);
+
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers_[0]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers_[1]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers_[0]);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, renderbuffers_[1]);
+
+    const auto status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    complete_ = status == GL_FRAMEBUFFER_COMPLETE;
+    if (!complete_) {
+        Logger::Log(LogLevel::Error, "Offscreen framebuffer is incomplete {:#x}", status);
+    }
+}
+
+auto GLFramebuffer::Bind() const -> void {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+}
+
+GLFramebuffer::~GLFramebuffer() {
+    glDeleteFramebuffers(1, &framebuffer_);
+    glDeleteRenderbuffers(2, renderbuffers_);
+}
+
+auto read_framebuffer_pixels(int width, int height) -> std::vector<uint8_t> {
+    const auto row_size = static_cast<std::size_t>(width) * 4;
+    auto pixels = std::vector<uint8_t>(row_size * height);
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+    // OpenGL returns the bottom row first.
+    for (auto y = 0; y < height / 2; ++y) {
+        auto top = pixels.begin() + y * row_size;
+        auto bottom = pixels.begin() + (height - 1 - y) * row_size;
+        std::swap_ranges(top, top + row_size, bottom);
+    }
+
+    return pixels;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace gleam {
+
+class GLFramebuffer {
+public:
+    GLFramebuffer(int width, int height);
+
+    // delete move constructor and assignment operator
+    GLFramebuffer(GLFramebuffer&&) = delete;
+    auto operator=(GLFramebuffer&&) -> GLFramebuffer& = delete;
+
+    // delete copy constructor and assignment operator
+    GLFramebuffer(const GLFramebuffer&) = delete;
+    auto operator=(const GLFramebuffer&) -> GLFramebuffer& = delete;
+
+    auto Bind() const -> void;
+
+    [[nodiscard]] auto IsComplete() const { return complete_; }
+
+    ~GLFramebuffer();
+
+private:
+    GLuint framebuffer_ {0};
+
+    // Color and depth-stencil attachments.
+    GLuint renderbuffers_[2] {0, 0};
+
+    bool complete_ {false};
+};
+
+/**
+ * @brief Reads the color buffer of the bound framebuffer.
+ *
+ * @param width Width of the framebuffer in pixels.
+ * @param height Height of the framebuffer in pixels.
+ * @return RGBA8 pixels with rows ordered from top to bottom.
+ */
+auto read_framebuffer_pixels(int width, int height) -> std::vector<uint8_t>;
+
+}
\ No newline at end of file
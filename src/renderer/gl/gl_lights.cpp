@@ -87,10 +87,6 @@ auto GLLights::AddLight(Light* light, Camera* camera) -> void {
     }
 }
 
-auto GLLights::Update() -> void {
-    uniform_buffer_.UploadIfNeeded(&lights_, sizeof(lights_));
-}
-
 auto GLLights::HasLights() const -> bool {
     return ambient || directional || point || spot;
 }
@@ -13,8 +13,6 @@
 #include "gleam/math/color.hpp"
 #include "gleam/math/vector3.hpp"
 
-#include "renderer/gl/gl_uniform_buffer.hpp"
-
 #include <array>
 
 namespace gleam {
@@ -61,13 +59,11 @@ public:
 
     auto Reset() -> void;
 
-    auto Update() -> void;
+    [[nodiscard]] auto Data() const -> const UniformLights& { return lights_; }
 
 private:
     UniformLights lights_ {};
 
-    GLUniformBuffer uniform_buffer_ {"ub_Lights", sizeof(UniformLights)};
-
     unsigned int idx_ {0};
 };
 
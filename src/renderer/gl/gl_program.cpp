@@ -59,14 +59,16 @@ GLProgram::GLProgram(const std::vector<ShaderInfo>& shaders) {
     ProcessUniformBlocks();
 }
 
-auto GLProgram::UpdateUniforms() -> void {
+auto GLProgram::UpdateUniforms() -> std::size_t {
+    auto uploads = std::size_t {0};
     for (auto& [_, uniform] : unknown_uniforms_) {
-        uniform.UploadIfNeeded();
+        if (uniform.UploadIfNeeded()) uploads++;
     }
 
     for (auto& uniform : uniforms_) {
-        if (uniform != nullptr) uniform->UploadIfNeeded();
+        if (uniform != nullptr && uniform->UploadIfNeeded()) uploads++;
     }
+    return uploads;
 }
 
 auto GLProgram::SetUnknownUniform(const std::string& name, const void* v) -> void {
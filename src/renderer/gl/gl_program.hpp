@@ -36,7 +36,7 @@ public:
     GLProgram& operator=(const GLProgram&) = delete;
     GLProgram& operator=(GLProgram&&) = delete;
 
-    auto UpdateUniforms() -> void;
+    auto UpdateUniforms() -> std::size_t;
 
     auto IsValid() const { return !has_errors_ && program_ > 0; }
 
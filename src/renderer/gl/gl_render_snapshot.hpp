@@ -0,0 +1,80 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "gleam/core/fog.hpp"
+#include "gleam/core/geometry.hpp"
+#include "gleam/core/render_statistics.hpp"
+#include "gleam/materials/material.hpp"
+#include "gleam/math/matrix3.hpp"
+#include "gleam/math/matrix4.hpp"
+#include "gleam/textures/texture_2d.hpp"
+
+#include "core/program_attributes.hpp"
+#include "renderer/gl/gl_command_list.hpp"
+#include "renderer/gl/gl_lights.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace gleam {
+
+/**
+ * @brief Scene state captured for the submission of a single frame.
+ *
+ * The renderer keeps two snapshots. One is filled while the scene is being
+ * updated, the other is submitted to the GPU, so the submission never reads
+ * state that the update may be modifying. Resource ids are resolved when
+ * the snapshot is swapped in, and resources it uploads are only assigned
+ * their ids at the next swap.
+ */
+struct GLRenderSnapshot {
+    /// @brief Projection transform of the camera.
+    Matrix4 projection {1.0f};
+
+    /// @brief View transform of the camera.
+    Matrix4 view {1.0f};
+
+    /// @brief Lights packed in the layout of the lights uniform buffer.
+    GLLights lights;
+
+    /// @brief Copy of the scene fog, if any.
+    std::unique_ptr<Fog> fog;
+
+    /// @brief Geometries referenced by the draw commands, null for the ones the render lists skipped.
+    std::vector<std::shared_ptr<Geometry>> geometries;
+
+    /// @brief Vertex arrays of the geometries, 0 for geometries that aren't resident.
+    std::vector<unsigned int> geometry_ids;
+
+    /// @brief Materials referenced by the draw commands, either the scene's or their copies.
+    std::vector<Material*> materials;
+
+    /// @brief Copies of the materials, kept while the snapshot is filled for pipelined frames.
+    std::vector<std::unique_ptr<Material>> material_copies;
+
+    /// @brief Program attributes of the materials, in the same order.
+    std::vector<ProgramAttributes> program_attributes;
+
+    /// @brief Texture map of each material, if it has one.
+    std::vector<std::shared_ptr<Texture2D>> textures;
+
+    /// @brief Texture objects of the texture maps, 0 for textures that aren't resident.
+    std::vector<unsigned int> texture_ids;
+
+    /// @brief UV transforms of the texture maps, as they were when the snapshot was filled.
+    std::vector<Matrix3> texture_transforms;
+
+    /// @brief Culled and sorted draw commands.
+    GLCommandList commands;
+
+    /// @brief Timings of the stages that prepared the snapshot.
+    RenderStatistics statistics;
+};
+
+}
\ No newline at end of file
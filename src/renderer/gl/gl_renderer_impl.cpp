@@ -16,103 +16,406 @@
 #include "core/render_lists.hpp"
 #include "core/program_attributes.hpp"
 #include "utilities/logger.hpp"
+#include "utilities/profiler.hpp"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <functional>
+#include <limits>
+#include <span>
+#include <thread>
 #include <utility>
 
 #include <glad/glad.h>
 
 namespace gleam {
 
+namespace {
+
+// Number of proxies culled and packed by a single job.
+constexpr auto kCommandsPerJob = std::size_t {512};
+
+using Clock = std::chrono::steady_clock;
+
+auto elapsed_ms(Clock::time_point start, Clock::time_point end = Clock::now()) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+auto worker_thread_count(const Renderer::Parameters& params) -> unsigned int {
+    if (params.worker_threads > 0) return params.worker_threads;
+    const auto hardware_threads = std::thread::hardware_concurrency();
+    return hardware_threads > 1 ? hardware_threads - 1 : 0;
+}
+
+template <class T, class Base>
+auto copy_into(const Base* source, std::unique_ptr<Base>& target) {
+    // Snapshots are reused from frame to frame, so existing copies are
+    // assigned to rather than reallocated when the type didn't change.
+    auto s = static_cast<const T*>(source);
+    if (target && target->GetType() == s->GetType()) {
+        *static_cast<T*>(target.get()) = *s;
+    } else {
+        target = std::make_unique<T>(*s);
+    }
+}
+
+auto clone_material(const Material* source) -> std::unique_ptr<Material> {
+    switch (source->GetType()) {
+        case MaterialType::FlatMaterial:
+            return std::make_unique<FlatMaterial>(*static_cast<const FlatMaterial*>(source));
+        case MaterialType::PhongMaterial:
+            return std::make_unique<PhongMaterial>(*static_cast<const PhongMaterial*>(source));
+        case MaterialType::ShaderMaterial:
+            return std::make_unique<ShaderMaterial>(*static_cast<const ShaderMaterial*>(source));
+    }
+    return nullptr;
+}
+
+// Brings the copy of a material up to date, and returns whether it had to be
+// recreated, which invalidates program attributes that view its shaders.
+auto sync_material(const Material* source, std::unique_ptr<Material>& target) -> bool {
+    if (!target || target->UUID() != source->UUID() || target->GetType() != source->GetType()) {
+        target = clone_material(source);
+        return true;
+    }
+
+    switch (source->GetType()) {
+        case MaterialType::FlatMaterial:
+            *static_cast<FlatMaterial*>(target.get()) = *static_cast<const FlatMaterial*>(source);
+            break;
+        case MaterialType::PhongMaterial:
+            *static_cast<PhongMaterial*>(target.get()) = *static_cast<const PhongMaterial*>(source);
+            break;
+        case MaterialType::ShaderMaterial: {
+            // Shader sources can't change after construction, so only the
+            // material state and the uniforms that changed are copied.
+            auto s = static_cast<const ShaderMaterial*>(source);
+            auto t = static_cast<ShaderMaterial*>(target.get());
+            static_cast<Material&>(*t) = *s;
+            if (t->uniforms != s->uniforms) t->uniforms = s->uniforms;
+            break;
+        }
+    }
+    return false;
+}
+
+auto texture_map(const Material* material) -> std::shared_ptr<Texture2D> {
+    switch (material->GetType()) {
+        case MaterialType::FlatMaterial:
+            return static_cast<const FlatMaterial*>(material)->texture_map;
+        case MaterialType::PhongMaterial:
+            return static_cast<const PhongMaterial*>(material)->texture_map;
+        default:
+            return nullptr;
+    }
+}
+
+auto copy_fog(const Fog* source, std::unique_ptr<Fog>& target) {
+    if (source == nullptr) {
+        target.reset();
+        return;
+    }
+    switch (source->GetType()) {
+        case FogType::LinearFog:
+            copy_into<LinearFog>(source, target);
+            break;
+        case FogType::ExponentialFog:
+            copy_into<ExponentialFog>(source, target);
+            break;
+    }
+}
+
+}
+
 Renderer::Impl::Impl(const Renderer::Parameters& params)
   : params_(params),
-    render_lists_(std::make_unique<RenderLists>()) {
+    render_lists_(std::make_unique<RenderLists>()),
+    workers_(worker_thread_count(params)) {
+    if (params.offscreen) {
+        framebuffer_ = std::make_unique<GLFramebuffer>(params.width, params.height);
+    }
     state_.SetViewport(0, 0, params.width, params.height);
 }
 
-auto Renderer::Impl::RenderObjects(Scene* scene, Camera* camera) -> void {
-    camera_.Update(camera->projection_transform, camera->view_transform);
-    frustum_.SetWithViewProjection(camera->projection_transform * camera->view_transform);
+auto Renderer::Impl::CaptureState(Scene* scene, GLRenderSnapshot& snapshot, bool copy_materials) -> void {
+    GLEAM_PROFILE_FUNCTION();
+    copy_fog(scene->fog.get(), snapshot.fog);
 
-    for (auto mesh : render_lists_->Opaque()) {
-        RenderMesh(mesh, scene, camera);
+    const auto geometries = render_lists_->GeometryCount();
+    snapshot.geometries.resize(geometries);
+    for (auto i = std::size_t {0}; i < geometries; ++i) {
+        // Invalid geometries aren't drawn, so they aren't uploaded either.
+        auto& geometry = snapshot.geometries[i];
+        geometry = render_lists_->IsGeometryValid(i) ? render_lists_->GetGeometry(i) : nullptr;
     }
 
-    if (!render_lists_->Transparent().empty()) state_.SetDepthMask(false);
-    for (auto mesh : render_lists_->Transparent()) {
-        RenderMesh(mesh, scene, camera);
+    const auto materials = render_lists_->MaterialCount();
+    snapshot.materials.resize(materials);
+
+    // Texture transforms are computed lazily, so they're read here rather
+    // than while the snapshot is submitted.
+    snapshot.textures.resize(materials);
+    snapshot.texture_transforms.resize(materials);
+    for (auto i = std::size_t {0}; i < materials; ++i) {
+        auto& texture = snapshot.textures[i];
+        texture = texture_map(render_lists_->GetMaterial(i));
+        snapshot.texture_transforms[i] = texture ? texture->GetTransform() : Matrix3 {1.0f};
     }
 
-    state_.SetDepthMask(true);
+    // Without pipelining nothing modifies the scene during submission, so the
+    // materials and program attributes of the render lists are used as they are.
+    if (!copy_materials) {
+        snapshot.material_copies.clear();
+        snapshot.program_attributes.clear();
+        for (auto i = std::size_t {0}; i < materials; ++i) {
+            snapshot.materials[i] = render_lists_->GetMaterial(i);
+            snapshot.program_attributes.emplace_back(render_lists_->GetProgramAttributes(i));
+        }
+        return;
+    }
 
-    rendered_objects_per_frame_ = rendered_objects_counter_;
-    rendered_objects_counter_ = 0;
+    // Copies are kept from the last time the snapshot was filled and only
+    // updated. Program attributes of shader materials view the shader sources
+    // of the copies, so they're rebuilt when a copy is recreated or the key
+    // computed by the render lists changes.
+    const auto lights = ProgramAttributes::LightsCounter {
+        .directional = snapshot.lights.directional,
+        .point = snapshot.lights.point,
+        .spot = snapshot.lights.spot
+    };
+    auto& attributes = snapshot.program_attributes;
+    if (attributes.size() > materials) {
+        attributes.erase(attributes.begin() + materials, attributes.end());
+    }
+    snapshot.material_copies.resize(materials);
+    for (auto i = std::size_t {0}; i < materials; ++i) {
+        auto& copy = snapshot.material_copies[i];
+        const auto recreated = sync_material(render_lists_->GetMaterial(i), copy);
+        snapshot.materials[i] = copy.get();
+
+        const auto key = render_lists_->GetProgramAttributes(i).key;
+        if (i == attributes.size()) {
+            attributes.emplace_back(copy.get(), lights, scene);
+        } else if (recreated || attributes[i].key != key) {
+            attributes[i] = ProgramAttributes {copy.get(), lights, scene};
+        }
+    }
+}
+
+auto Renderer::Impl::PrepareCommands(GLRenderSnapshot& snapshot) -> void {
+    GLEAM_PROFILE_FUNCTION();
+    const auto& view = snapshot.view;
+    auto culled_frustum = std::atomic<std::size_t> {0};
+    auto culled_invalid = std::atomic<std::size_t> {0};
+    auto pack = [&](std::span<const RenderProxy> proxies, std::vector<GLDrawCommand>& commands) {
+        commands.resize(proxies.size());
+        workers_.ParallelFor(proxies.size(), kCommandsPerJob, [&](auto begin, auto end) {
+            auto frustum = std::size_t {0};
+            auto invalid = std::size_t {0};
+            for (auto i = begin; i < end; ++i) {
+                const auto& proxy = proxies[i];
+                auto& command = commands[i];
+                command.proxy = proxy;
+                if (!(proxy.flags & RenderProxy::Valid)) {
+                    invalid++;
+                    continue;
+                }
+                if (!frustum_.IntersectsWithSphere(proxy.world_bounds)) {
+                    command.proxy.flags &= ~RenderProxy::Valid;
+                    frustum++;
+                    continue;
+                }
+                command.depth = -(view * proxy.world_bounds.center).z;
+            }
+            culled_frustum.fetch_add(frustum, std::memory_order_relaxed);
+            culled_invalid.fetch_add(invalid, std::memory_order_relaxed);
+        });
+        std::erase_if(commands, [](const auto& command) {
+            return !(command.proxy.flags & RenderProxy::Valid);
+        });
+    };
+
+    auto& commands = snapshot.commands;
+    pack(render_lists_->Opaque(), commands.opaque);
+    pack(render_lists_->Transparent(), commands.transparent);
+    snapshot.statistics.culled_frustum = culled_frustum.load(std::memory_order_relaxed);
+    snapshot.statistics.culled_invalid_geometry = culled_invalid.load(std::memory_order_relaxed);
+
+    // Opaque draws are grouped by program to reduce state changes, then sorted
+    // front-to-back to optimize depth buffer writes. Transparent draws are
+    // sorted back-to-front to ensure correct blending.
+    workers_.ParallelFor(2, 1, [&](auto begin, auto) {
+        GLEAM_PROFILE_ZONE("SortCommands");
+        if (begin == 0) {
+            std::ranges::sort(commands.opaque, [](const auto& a, const auto& b) {
+                if (a.proxy.program_key != b.proxy.program_key) {
+                    return a.proxy.program_key < b.proxy.program_key;
+                }
+                return a.depth < b.depth;
+            });
+        } else {
+            std::ranges::stable_sort(commands.transparent, std::ranges::greater {}, &GLDrawCommand::depth);
+        }
+    });
 }
 
-auto Renderer::Impl::RenderMesh(Mesh* mesh, Scene* scene, Camera* camera) -> void {
-    if (!IsValidMesh(mesh)) return;
-    if (!IsVisible(mesh)) return;
+auto Renderer::Impl::UploadResources(GLRenderSnapshot& snapshot) -> void {
+    GLEAM_PROFILE_FUNCTION();
+    constexpr auto kCulled = std::numeric_limits<float>::max();
+    const auto upload_start = Clock::now();
+    auto& requests = upload_requests_;
+
+    material_depths_.assign(snapshot.materials.size(), kCulled);
+    auto add_commands = [&](const std::vector<GLDrawCommand>& commands) {
+        for (const auto& command : commands) {
+            const auto& proxy = command.proxy;
+            if (snapshot.geometry_ids[proxy.geometry_index] == 0) {
+                const auto& geometry = snapshot.geometries[proxy.geometry_index];
+                requests.push_back({.geometry = geometry, .depth = command.depth});
+            }
+            auto& depth = material_depths_[proxy.material_index];
+            depth = std::min(depth, command.depth);
+        }
+    };
+    add_commands(snapshot.commands.opaque);
+    add_commands(snapshot.commands.transparent);
+
+    // Resources of culled meshes are queued behind the visible ones, so they
+    // use up what's left of the budget and are ready when they come into view.
+    for (auto i = std::size_t {0}; i < snapshot.geometries.size(); ++i) {
+        const auto& geometry = snapshot.geometries[i];
+        if (geometry && snapshot.geometry_ids[i] == 0) {
+            requests.push_back({.geometry = geometry, .depth = kCulled});
+        }
+    }
+    for (auto i = std::size_t {0}; i < snapshot.textures.size(); ++i) {
+        const auto& texture = snapshot.textures[i];
+        if (texture && snapshot.texture_ids[i] == 0) {
+            requests.push_back({.texture = texture, .depth = material_depths_[i]});
+        }
+    }
+
+    if (requests.empty()) {
+        frame_statistics_.uploads_deferred = 0;
+        frame_statistics_.upload_ms = elapsed_ms(upload_start);
+        return;
+    }
+
+    // A resource is queued once per draw, keep the nearest request of each.
+    auto resource = [](const UploadRequest& request) -> const void* {
+        if (request.geometry) return request.geometry.get();
+        return request.texture.get();
+    };
+    std::ranges::sort(requests, [&](const auto& a, const auto& b) {
+        if (resource(a) != resource(b)) return std::less {}(resource(a), resource(b));
+        return a.depth < b.depth;
+    });
+    const auto duplicates = std::ranges::unique(requests, {}, resource);
+    requests.erase(duplicates.begin(), duplicates.end());
+    std::ranges::sort(requests, {}, &UploadRequest::depth);
+
+    const auto over_budget = [&](std::size_t bytes) {
+        const auto& p = params_;
+        if (p.upload_budget_bytes > 0 && bytes > p.upload_budget_bytes) return true;
+        return p.upload_budget_ms > 0.0 && elapsed_ms(upload_start) >= p.upload_budget_ms;
+    };
+
+    auto bytes = std::size_t {0};
+    auto uploads = std::size_t {0};
+    for (const auto& request : requests) {
+        const auto size = request.geometry
+            ? GLBuffers::UploadSize(*request.geometry)
+            : GLTextures::UploadSize(*request.texture);
+        // One resource is uploaded every frame regardless of the budget, so
+        // resources larger than the budget still make progress.
+        if (uploads > 0 && over_budget(bytes + size)) break;
+        bytes += request.geometry
+            ? buffers_.Upload(request.geometry)
+            : textures_.Upload(request.texture);
+        uploads++;
+    }
 
-    auto geometry = mesh->geometry.get();
-    auto material = mesh->material.get();
+    // Resources are only assigned their ids once the frame is committed, the
+    // snapshot refers to the new ones directly.
+    for (auto i = std::size_t {0}; i < snapshot.geometries.size(); ++i) {
+        const auto& geometry = snapshot.geometries[i];
+        auto& id = snapshot.geometry_ids[i];
+        if (geometry && id == 0) id = buffers_.UncommittedId(geometry.get());
+    }
+    for (auto i = std::size_t {0}; i < snapshot.textures.size(); ++i) {
+        const auto& texture = snapshot.textures[i];
+        auto& id = snapshot.texture_ids[i];
+        if (texture && id == 0) id = textures_.UncommittedId(texture.get());
+    }
 
-    auto attrs = ProgramAttributes {material, {
-        .directional = lights_.directional,
-        .point = lights_.point,
-        .spot = lights_.spot
-    }, scene};
-    auto program = programs_.GetProgram(attrs);
-    if (!program->IsValid()) {
+    frame_statistics_.uploads_deferred = requests.size() - uploads;
+    frame_statistics_.upload_ms = elapsed_ms(upload_start);
+    requests.clear();
+}
+
+auto Renderer::Impl::Draw(const GLDrawCommand& command, const GLRenderSnapshot& snapshot) -> void {
+    const auto& proxy = command.proxy;
+    auto program = material_programs_[proxy.material_index];
+    if (program == nullptr) {
+        frame_statistics_.culled_invalid_program++;
         return;
     }
 
+    const auto vao = snapshot.geometry_ids[proxy.geometry_index];
+    if (vao == 0) {
+        frame_statistics_.culled_not_resident++;
+        return;
+    }
+
+    auto material = snapshot.materials[proxy.material_index];
+    const auto& attrs = snapshot.program_attributes[proxy.material_index];
+
     state_.ProcessMaterial(material);
-    buffers_.Bind(mesh->geometry);
+    buffers_.Bind(vao);
 
-    SetUniforms(program, &attrs, mesh, camera, scene);
+    const auto uniforms_start = Clock::now();
+    SetUniforms(program, attrs, proxy, material, snapshot);
 
     state_.UseProgram(program->Id());
-    program->UpdateUniforms();
+    frame_statistics_.uniform_uploads += program->UpdateUniforms();
+    frame_statistics_.uniform_setup_ms += elapsed_ms(uniforms_start);
 
     auto primitive = GL_TRIANGLES;
-    if (geometry->primitive == GeometryPrimitiveType::Lines) {
+    if (proxy.primitive == GeometryPrimitiveType::Lines) {
         primitive = GL_LINES;
     }
-    if (geometry->primitive == GeometryPrimitiveType::LineLoop) {
+    if (proxy.primitive == GeometryPrimitiveType::LineLoop) {
         primitive = GL_LINE_LOOP;
     }
 
-    if (geometry->IndexData().empty()) {
-        glDrawArrays(primitive, 0, geometry->VertexCount());
+    if (proxy.flags & RenderProxy::Indexed) {
+        glDrawElements(primitive, proxy.count, GL_UNSIGNED_INT, nullptr);
     } else {
-        glDrawElements(
-            primitive,
-            geometry->IndexData().size(),
-            GL_UNSIGNED_INT,
-            nullptr
-        );
+        glDrawArrays(primitive, 0, proxy.count);
     }
 
     rendered_objects_counter_++;
+    frame_statistics_.draw_calls++;
+    if (primitive == GL_TRIANGLES) frame_statistics_.triangles += proxy.count / 3;
 }
 
 auto Renderer::Impl::SetUniforms(
     GLProgram* program,
-    ProgramAttributes* attrs,
-    Mesh* mesh,
-    Camera* camera,
-    Scene* scene
+    const ProgramAttributes& attrs,
+    const RenderProxy& proxy,
+    Material* material,
+    const GLRenderSnapshot& snapshot
 ) -> void {
-    auto material = mesh->material.get();
-    auto model = mesh->GetWorldTransform();
     auto resolution = Vector2(params_.width, params_.height);
 
-    program->SetUniform(Uniform::Model, &model);
+    program->SetUniform(Uniform::Model, &proxy.world);
     program->SetUniform(Uniform::Opacity, &material->opacity);
     program->SetUniform(Uniform::Resolution, &resolution);
 
-    if (auto fog = scene->fog.get()) {
+    if (auto fog = snapshot.fog.get()) {
         auto type = fog->GetType();
         program->SetUniform(Uniform::FogType, &type);
         if (type == FogType::LinearFog) {
@@ -129,34 +432,34 @@ auto Renderer::Impl::SetUniforms(
         }
     }
 
-    if (attrs->type == MaterialType::FlatMaterial) {
+    if (attrs.type == MaterialType::FlatMaterial) {
         auto m = static_cast<FlatMaterial*>(material);
         program->SetUniform(Uniform::Color, &m->color);
-        if (attrs->texture_map) {
-            const auto& transform = m->texture_map->GetTransform();
+        if (attrs.texture_map) {
+            const auto& transform = snapshot.texture_transforms[proxy.material_index];
             program->SetUniform(Uniform::TextureMap, 0);
             program->SetUniform(Uniform::TextureTransform, &transform);
-            textures_.Bind(m->texture_map);
+            textures_.Bind(snapshot.texture_ids[proxy.material_index]);
         }
     }
 
-    if (attrs->type == MaterialType::PhongMaterial) {
+    if (attrs.type == MaterialType::PhongMaterial) {
         auto m = static_cast<PhongMaterial*>(material);
-        if (lights_.HasLights()) {
+        if (snapshot.lights.HasLights()) {
             program->SetUniform(Uniform::MaterialDiffuseColor, &m->color);
             program->SetUniform(Uniform::MaterialSpecularColor, &m->specular);
             program->SetUniform(Uniform::MaterialShininess, &m->shininess);
         }
 
-        if (attrs->texture_map) {
-            const auto& transform = m->texture_map->GetTransform();
+        if (attrs.texture_map) {
+            const auto& transform = snapshot.texture_transforms[proxy.material_index];
             program->SetUniform(Uniform::TextureMap, 0);
             program->SetUniform(Uniform::TextureTransform, &transform);
-            textures_.Bind(m->texture_map);
+            textures_.Bind(snapshot.texture_ids[proxy.material_index]);
         }
     }
 
-    if (attrs->type == MaterialType::ShaderMaterial) {
+    if (attrs.type == MaterialType::ShaderMaterial) {
         auto m = static_cast<ShaderMaterial*>(material);
         for (const auto& [name, value] : m->uniforms) {
             program->SetUnknownUniform(name, &value);
@@ -165,60 +468,207 @@ auto Renderer::Impl::SetUniforms(
 }
 
 auto Renderer::Impl::Render(Scene* scene, Camera* camera) -> void {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    GLEAM_PROFILE_ZONE("Renderer::Render");
+    Prepare(scene, camera, false);
+    SwapSnapshots();
+    Submit();
+    CommitUploads();
+}
+
+auto Renderer::Impl::Prepare(Scene* scene, Camera* camera, bool copy_materials) -> void {
+    GLEAM_PROFILE_ZONE("Renderer::Prepare");
+    auto& snapshot = snapshots_[1 - front_];
+    auto& statistics = snapshot.statistics;
 
-    scene->UpdateTransformHierarchy();
-    camera->SetViewTransform();
+    auto stage_start = Clock::now();
+    {
+        GLEAM_PROFILE_ZONE("UpdateTransformHierarchy");
+        scene->UpdateTransformHierarchy();
+        camera->SetViewTransform();
+    }
+    auto stage_end = Clock::now();
+    statistics.transform_update_ms = elapsed_ms(stage_start, stage_end);
+    stage_start = stage_end;
 
     if (scene->touched_) {
+        GLEAM_PROFILE_ZONE("ProcessScene");
         render_lists_->ProcessScene(scene);
         scene->touched_ = false;
     }
 
-    lights_.Reset();
-    for(auto light : render_lists_->Lights()) lights_.AddLight(light, camera);
-    if (lights_.HasLights()) {
-        lights_.Update();
-    }
+    snapshot.projection = camera->projection_transform;
+    snapshot.view = camera->view_transform;
+
+    snapshot.lights.Reset();
+    for(auto light : render_lists_->Lights()) snapshot.lights.AddLight(light, camera);
+
+    render_lists_->Update(scene, {
+        .directional = snapshot.lights.directional,
+        .point = snapshot.lights.point,
+        .spot = snapshot.lights.spot
+    }, &workers_);
+
+    CaptureState(scene, snapshot, copy_materials);
+
+    stage_end = Clock::now();
+    statistics.render_lists_ms = elapsed_ms(stage_start, stage_end);
+    stage_start = stage_end;
+
+    frustum_.SetWithViewProjection(snapshot.projection * snapshot.view);
+    PrepareCommands(snapshot);
 
-    RenderObjects(scene, camera);
+    statistics.culling_ms = elapsed_ms(stage_start);
+    GLEAM_PROFILE_COUNTER("Opaque commands", snapshot.commands.opaque.size());
+    GLEAM_PROFILE_COUNTER("Transparent commands", snapshot.commands.transparent.size());
 }
 
-auto Renderer::Impl::SetClearColor(const Color& color) -> void {
-    state_.SetClearColor(color);
+auto Renderer::Impl::SwapSnapshots() -> void {
+    // No frame is being prepared at this point, so resources uploaded by the
+    // last submission can be assigned their ids and their CPU copies dropped.
+    CommitUploads();
+    buffers_.ReleaseUploadedData();
+    textures_.ReleaseUploadedData();
+    front_ = 1 - front_;
+    ReloadReleasedData(snapshots_[front_]);
+    ResolveResidentIds(snapshots_[front_]);
 }
 
-auto Renderer::Impl::IsValidMesh(Mesh* mesh) const -> bool {
-    auto geometry = mesh->geometry;
+auto Renderer::Impl::CommitUploads() -> void {
+    buffers_.Commit();
+    textures_.Commit();
+}
 
-    if (geometry->Disposed()) {
-        Logger::Log(LogLevel::Warning,
-            "Skipped rendering a mesh with disposed geometry {}", *mesh
-        );
-        return false;
+auto Renderer::Impl::ResolveResidentIds(GLRenderSnapshot& snapshot) -> void {
+    snapshot.geometry_ids.resize(snapshot.geometries.size());
+    for (auto i = std::size_t {0}; i < snapshot.geometries.size(); ++i) {
+        const auto& geometry = snapshot.geometries[i];
+        snapshot.geometry_ids[i] = geometry ? geometry->renderer_id : 0;
+    }
+    snapshot.texture_ids.resize(snapshot.textures.size());
+    for (auto i = std::size_t {0}; i < snapshot.textures.size(); ++i) {
+        const auto& texture = snapshot.textures[i];
+        snapshot.texture_ids[i] = texture ? texture->renderer_id : 0;
+    }
+}
+
+auto Renderer::Impl::ReloadReleasedData(const GLRenderSnapshot& snapshot) -> void {
+    GLEAM_PROFILE_FUNCTION();
+    // Released data has to be brought back before it's uploaded. Reloading
+    // replaces data the render lists read while preparing a frame, so it
+    // can't wait for the submission.
+    for (const auto& geometry : snapshot.geometries) {
+        if (geometry && geometry->renderer_id == 0 && geometry->IsReleased()) {
+            geometry->Reload();
+        }
     }
+    for (const auto& texture : snapshot.textures) {
+        if (texture && texture->renderer_id == 0 && texture->IsReleased()) {
+            texture->Reload();
+        }
+    }
+}
 
-    if (geometry->VertexData().empty()) {
-        Logger::Log(LogLevel::Warning,
-            "Skipped rendering a mesh with no geometry data {}", *mesh
-        );
-        return false;
+auto Renderer::Impl::Submit() -> void {
+    GLEAM_PROFILE_ZONE("Renderer::Submit");
+    auto& snapshot = snapshots_[front_];
+    const auto submit_start = Clock::now();
+    frame_statistics_ = snapshot.statistics;
+    frame_statistics_.uniform_setup_ms = 0.0;
+    frame_statistics_.draw_calls = 0;
+    frame_statistics_.triangles = 0;
+    frame_statistics_.uniform_uploads = 0;
+    frame_statistics_.culled_invalid_program = 0;
+    frame_statistics_.culled_not_resident = 0;
+
+    buffers_.ResetCounters();
+    textures_.ResetCounters();
+    state_.ResetCounters();
+
+    buffers_.ReleaseDisposed();
+    textures_.ReleaseDisposed();
+
+    UploadResources(snapshot);
+
+    if (framebuffer_) framebuffer_->Bind();
+    timer_queries_.BeginFrame();
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    timer_queries_.EndPass(GPUPass::Clear);
+
+    // Programs may have to be compiled, which can only happen on the GL thread,
+    // so they're resolved here once per material.
+    material_programs_.clear();
+    {
+        GLEAM_PROFILE_ZONE("ResolvePrograms");
+        for (const auto& attrs : snapshot.program_attributes) {
+            auto program = programs_.GetProgram(attrs);
+            material_programs_.emplace_back(program && program->IsValid() ? program : nullptr);
+        }
     }
 
-    if (geometry->Attributes().empty()) {
-        Logger::Log(LogLevel::Warning,
-            "Skipped rendering a mesh with no geometry attributes {}", *mesh
+    frame_statistics_.ubo_bytes_uploaded = camera_.Update(snapshot.projection, snapshot.view);
+    if (snapshot.lights.HasLights()) {
+        frame_statistics_.ubo_bytes_uploaded += lights_buffer_.UploadIfNeeded(
+            &snapshot.lights.Data(), sizeof(GLLights::UniformLights)
         );
-        return false;
     }
 
-    return true;
+    {
+        GLEAM_PROFILE_ZONE("DrawOpaque");
+        for (const auto& command : snapshot.commands.opaque) {
+            Draw(command, snapshot);
+        }
+    }
+    timer_queries_.EndPass(GPUPass::Opaque);
+
+    if (!snapshot.commands.transparent.empty()) state_.SetDepthMask(false);
+    {
+        GLEAM_PROFILE_ZONE("DrawTransparent");
+        for (const auto& command : snapshot.commands.transparent) {
+            Draw(command, snapshot);
+        }
+    }
+    timer_queries_.EndPass(GPUPass::Transparent);
+
+    state_.SetDepthMask(true);
+
+    rendered_objects_per_frame_ = rendered_objects_counter_;
+    rendered_objects_counter_ = 0;
+
+    frame_statistics_.submission_ms = elapsed_ms(submit_start)
+        - frame_statistics_.upload_ms
+        - frame_statistics_.uniform_setup_ms;
+
+    const auto& gpu_timings = timer_queries_.Timings();
+    frame_statistics_.gpu_clear_ms = gpu_timings.Pass(GPUPass::Clear);
+    frame_statistics_.gpu_opaque_ms = gpu_timings.Pass(GPUPass::Opaque);
+    frame_statistics_.gpu_transparent_ms = gpu_timings.Pass(GPUPass::Transparent);
+    frame_statistics_.gpu_frame_ms = gpu_timings.frame_ms;
+    frame_statistics_.program_switches = state_.ProgramSwitches();
+    frame_statistics_.vao_binds = buffers_.BindCount();
+    frame_statistics_.texture_binds = textures_.BindCount();
+    frame_statistics_.buffer_bytes_uploaded = buffers_.UploadedBytes();
+    frame_statistics_.texture_bytes_uploaded = textures_.UploadedBytes();
+    frame_statistics_.buffer_memory_bytes = buffers_.MemoryBytes();
+    frame_statistics_.texture_memory_bytes = textures_.MemoryBytes();
+    frame_statistics_.geometry_cpu_memory_bytes = buffers_.CPUMemoryBytes();
+    frame_statistics_.texture_cpu_memory_bytes = textures_.CPUMemoryBytes();
+    statistics_ = frame_statistics_;
+    statistics_history_.Add(statistics_);
+    GLEAM_PROFILE_COUNTER("Draw calls", statistics_.draw_calls);
+    GLEAM_PROFILE_COUNTER("Triangles", statistics_.triangles);
 }
 
-auto Renderer::Impl::IsVisible(Mesh* mesh) const -> bool {
-    auto bounding_sphere = mesh->geometry->BoundingSphere();
-    bounding_sphere.ApplyTransform(mesh->GetWorldTransform());
-    return frustum_.IntersectsWithSphere(bounding_sphere);
+auto Renderer::Impl::SetClearColor(const Color& color) -> void {
+    state_.SetClearColor(color);
+}
+
+auto Renderer::Impl::ReadPixels() const -> std::vector<uint8_t> {
+    if (framebuffer_) {
+        framebuffer_->Bind();
+    } else {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+    return read_framebuffer_pixels(params_.width, params_.height);
 }
 
 Renderer::Impl::~Impl() = default;
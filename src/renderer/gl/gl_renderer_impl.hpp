@@ -13,17 +13,26 @@
 
 #include "renderer/gl/gl_buffers.hpp"
 #include "renderer/gl/gl_camera.hpp"
+#include "renderer/gl/gl_command_list.hpp"
+#include "renderer/gl/gl_framebuffer.hpp"
 #include "renderer/gl/gl_lights.hpp"
 #include "renderer/gl/gl_programs.hpp"
+#include "renderer/gl/gl_render_snapshot.hpp"
 #include "renderer/gl/gl_state.hpp"
 #include "renderer/gl/gl_textures.hpp"
+#include "renderer/gl/gl_timer_queries.hpp"
+#include "renderer/gl/gl_uniform_buffer.hpp"
 
+#include "core/render_statistics_history.hpp"
+#include "core/worker_pool.hpp"
+
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace gleam {
 
-class RenderLists;
-
 class Renderer::Impl {
 public:
     explicit Impl(const Renderer::Parameters& params);
@@ -35,46 +44,118 @@ public:
 
     auto Render(Scene* scene, Camera* camera) -> void;
 
+    /**
+     * @brief Fills the back snapshot.
+     *
+     * @param copy_materials Copy the materials into the snapshot, so the scene
+     * can be modified while it's submitted.
+     */
+    auto Prepare(Scene* scene, Camera* camera, bool copy_materials = true) -> void;
+
+    auto SwapSnapshots() -> void;
+
+    auto Submit() -> void;
+
     auto SetClearColor(const Color& color) -> void;
 
+    [[nodiscard]] auto ReadPixels() const -> std::vector<uint8_t>;
+
     [[nodiscard]] auto RenderedObjectsPerFrame() const {
         return rendered_objects_per_frame_;
     }
 
+    [[nodiscard]] auto Statistics() const -> const RenderStatistics& {
+        return statistics_;
+    }
+
+    [[nodiscard]] auto AverageStatistics() const {
+        return statistics_history_.Average();
+    }
+
     ~Impl();
 
 private:
     GLBuffers buffers_;
     GLCamera camera_;
-    GLLights lights_;
     GLPrograms programs_;
     GLState state_;
     GLTextures textures_;
+    GLTimerQueries timer_queries_;
+
+    GLUniformBuffer lights_buffer_ {"ub_Lights", sizeof(GLLights::UniformLights)};
 
     Renderer::Parameters params_;
 
+    /// @brief Render target used instead of the default framebuffer when offscreen.
+    std::unique_ptr<GLFramebuffer> framebuffer_;
+
     Frustum frustum_;
 
     std::unique_ptr<RenderLists> render_lists_;
 
+    WorkerPool workers_;
+
+    /// @brief Snapshots written by Prepare() and read by Submit().
+    std::array<GLRenderSnapshot, 2> snapshots_;
+
+    /// @brief Index of the snapshot to submit, the other one is being prepared.
+    size_t front_ {0};
+
+    std::vector<GLProgram*> material_programs_;
+
+    /// @brief Resource waiting to be uploaded to the GPU.
+    struct UploadRequest {
+        std::shared_ptr<Geometry> geometry {nullptr};
+        std::shared_ptr<Texture> texture {nullptr};
+        float depth {0.0f};
+    };
+
+    /// @brief Uploads of the frame being submitted, reused from frame to frame.
+    std::vector<UploadRequest> upload_requests_;
+
+    /// @brief Depth of the nearest draw of each material in the frame being submitted.
+    std::vector<float> material_depths_;
+
     size_t rendered_objects_counter_ {0};
     size_t rendered_objects_per_frame_ {0};
 
-    auto RenderObjects(Scene* scene, Camera* camera) -> void;
+    /// @brief Statistics of the last submitted frame.
+    RenderStatistics statistics_;
+
+    /// @brief Statistics of the frame being submitted.
+    RenderStatistics frame_statistics_;
+
+    /// @brief Statistics of recently submitted frames.
+    RenderStatisticsHistory statistics_history_;
+
+    auto CaptureState(Scene* scene, GLRenderSnapshot& snapshot, bool copy_materials) -> void;
 
-    auto RenderMesh(Mesh* mesh, Scene* scene, Camera* camera) -> void;
+    auto PrepareCommands(GLRenderSnapshot& snapshot) -> void;
+
+    auto ReloadReleasedData(const GLRenderSnapshot& snapshot) -> void;
+
+    /**
+     * @brief Assigns the ids of resources uploaded by the last submission.
+     *
+     * Submissions don't modify geometries and textures, which the update of
+     * the next frame may be using. Must be called while no frame is being
+     * prepared.
+     */
+    auto CommitUploads() -> void;
+
+    auto ResolveResidentIds(GLRenderSnapshot& snapshot) -> void;
+
+    auto UploadResources(GLRenderSnapshot& snapshot) -> void;
+
+    auto Draw(const GLDrawCommand& command, const GLRenderSnapshot& snapshot) -> void;
 
     auto SetUniforms(
         GLProgram* program,
-        ProgramAttributes* attrs,
-        Mesh* mesh,
-        Camera* camera,
-        Scene* scene
+        const ProgramAttributes& attrs,
+        const RenderProxy& proxy,
+        Material* material,
+        const GLRenderSnapshot& snapshot
     ) -> void;
-
-    [[nodiscard]] auto IsValidMesh(Mesh* mesh) const -> bool;
-
-    [[nodiscard]] auto IsVisible(Mesh* mesh) const -> bool;
 };
 
 }
\ No newline at end of file
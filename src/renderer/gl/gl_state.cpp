@@ -56,6 +56,7 @@ auto GLState::UseProgram(unsigned int program_id) -> void {
     if (curr_program_ != program_id) {
         glUseProgram(program_id);
         curr_program_ = program_id;
+        program_switches_++;
     }
 }
 
@@ -10,6 +10,7 @@
 #include <gleam/materials/material.hpp>
 #include <gleam/math/color.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <unordered_map>
 
@@ -29,6 +30,11 @@ public:
 
     auto Reset() -> void;
 
+    /// @brief Number of program switches since the counters were reset.
+    [[nodiscard]] auto ProgramSwitches() const { return program_switches_; }
+
+    auto ResetCounters() -> void { program_switches_ = 0; }
+
 private:
     std::unordered_map<int, bool> features_;
 
@@ -42,6 +48,8 @@ private:
 
     unsigned int curr_program_ = 0;
 
+    std::size_t program_switches_ {0};
+
     auto Enable(int token) -> void;
 
     auto Disable(int token) -> void;
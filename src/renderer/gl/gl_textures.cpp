@@ -10,21 +10,143 @@
 #include "gleam/textures/texture_2d.hpp"
 
 #include "utilities/logger.hpp"
+#include "utilities/texture_codec.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
 
 namespace gleam {
 
-auto GLTextures::Bind(const std::shared_ptr<Texture>& texture) -> void {
-    auto tex_id = texture->renderer_id;
-    if (tex_id != 0 && tex_id == current_texture_id_) return;
+namespace {
+
+// glad is generated for the OpenGL 4.1 core profile, which doesn't define the
+// enums of the compression extensions.
+constexpr auto kCompressedRGBS3TCDXT1 = GLenum {0x83F0}; // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+
+constexpr auto kCompressedRGBAS3TCDXT5 = GLenum {0x83F3}; // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+
+constexpr auto kCompressedRGBABPTC = GLenum {0x8E8C}; // GL_COMPRESSED_RGBA_BPTC_UNORM
+
+auto internal_format(TextureFormat format) -> GLenum {
+    switch (format) {
+        case TextureFormat::BC1: return kCompressedRGBS3TCDXT1;
+        case TextureFormat::BC3: return kCompressedRGBAS3TCDXT5;
+        case TextureFormat::BC7: return kCompressedRGBABPTC;
+        default: return GL_RGBA8;
+    }
+}
+
+auto block_format(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::BC1: return BlockFormat::BC1;
+        case TextureFormat::BC3: return BlockFormat::BC3;
+        default: return BlockFormat::BC7;
+    }
+}
+
+auto has_extension(std::string_view name) {
+    auto count = GLint {0};
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (auto i = 0; i < count; ++i) {
+        const auto extension = glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i));
+        if (extension && reinterpret_cast<const char*>(extension) == name) return true;
+    }
+    return false;
+}
+
+} // unnamed namespace
 
-    if (tex_id == 0) {
-        GenerateTexture(texture.get());
+auto GLTextures::Bind(GLuint tex_id) -> void {
+    if (tex_id == 0) tex_id = Placeholder();
+    if (tex_id == current_texture_id_) return;
+
+    glBindTexture(GL_TEXTURE_2D, tex_id);
+    current_texture_id_ = tex_id;
+    bind_count_++;
+}
+
+auto GLTextures::Upload(const std::shared_ptr<Texture>& texture) -> std::size_t {
+    if (texture->renderer_id != 0 || uncommitted_.contains(texture.get())) return 0;
+
+    const auto uploaded = uploaded_bytes_;
+    const auto tex_id = GenerateTexture(texture.get());
+    uncommitted_.try_emplace(texture.get(), texture, tex_id);
+
+    // Generating the texture changed the binding, so the next bind can't be skipped.
+    current_texture_id_ = 0;
+    return uploaded_bytes_ - uploaded;
+}
+
+auto GLTextures::UncommittedId(const Texture* texture) const -> GLuint {
+    const auto it = uncommitted_.find(texture);
+    return it != uncommitted_.end() ? it->second.second : 0;
+}
+
+auto GLTextures::Commit() -> void {
+    for (auto& [_, entry] : uncommitted_) {
+        auto& [texture, tex_id] = entry;
+        if (texture->Disposed()) {
+            DeleteTexture(tex_id);
+            continue;
+        }
+
+        texture->renderer_id = tex_id;
+        texture->OnDispose([this](Disposable* target) {
+            const auto tex_id = static_cast<Texture*>(target)->renderer_id;
+            if (std::this_thread::get_id() != gl_thread_) {
+                const auto lock = std::scoped_lock(disposed_mutex_);
+                disposed_.emplace_back(tex_id);
+                return;
+            }
+            DeleteTexture(tex_id);
+            Logger::Log(LogLevel::Info, "Texture buffer cleared {}", *static_cast<Texture*>(target));
+        });
         textures_.emplace_back(texture);
+        if (texture->residency != ResidencyPolicy::Keep) {
+            pending_release_.emplace_back(texture);
+        }
+    }
+    uncommitted_.clear();
+}
+
+auto GLTextures::UploadSize(const Texture& texture) -> std::size_t {
+    // Currently, the engine only supports 2D textures.
+    return static_cast<const Texture2D&>(texture).DataSize();
+}
+
+auto GLTextures::SupportsFormat(TextureFormat format) -> bool {
+    if (!compression_queried_) {
+        s3tc_supported_ = has_extension("GL_EXT_texture_compression_s3tc");
+        bptc_supported_ = has_extension("GL_ARB_texture_compression_bptc");
+        compression_queried_ = true;
+    }
+
+    switch (format) {
+        case TextureFormat::BC1:
+        case TextureFormat::BC3: return s3tc_supported_;
+        case TextureFormat::BC7: return bptc_supported_;
+        default: return true;
+    }
+}
+
+auto GLTextures::Placeholder() -> GLuint {
+    if (placeholder_id_ == 0) {
+        constexpr auto white = std::array<uint8_t, 4> {0xFF, 0xFF, 0xFF, 0xFF};
+        glGenTextures(1, &placeholder_id_);
+        glBindTexture(GL_TEXTURE_2D, placeholder_id_);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     }
+    return placeholder_id_;
 }
 
-auto GLTextures::GenerateTexture(Texture* texture) const -> void {
-    auto& tex_id = texture->renderer_id;
+auto GLTextures::GenerateTexture(Texture* texture) -> GLuint {
+    auto tex_id = GLuint {0};
 
     glGenTextures(1, &tex_id);
     glBindTexture(GL_TEXTURE_2D, tex_id);
@@ -32,33 +154,121 @@ auto GLTextures::GenerateTexture(Texture* texture) const -> void {
     // Currently, the engine only supports 2D textures.
     auto texture_2d = static_cast<Texture2D*>(texture);
 
+    // Released data is reloaded when the snapshot is swapped in, so it's only
+    // missing here if that failed.
+    if (texture_2d->IsReleased()) {
+        Logger::Log(LogLevel::Error, "Uploading a texture whose data was released {}", *texture);
+    }
+
+    // Block-compressed data the driver can't sample is decompressed to RGBA8.
+    const auto format = texture_2d->format;
+    const auto compressed = format != TextureFormat::RGBA8;
+    const auto decompress = compressed && !SupportsFormat(format);
+    if (decompress) {
+        Logger::Log(LogLevel::Warning, "Decompressing texture the driver can't sample {}", *texture);
+    }
+
     // Use glTexImage2D instead of glTexStorage2D since we target OpenGL 4.1
-    glTexImage2D(
-        GL_TEXTURE_2D,
-        0,
-        // The engine-specific .tex format guarantees RGBA8 format.
-        GL_RGBA8,
-        texture_2d->width,
-        texture_2d->height,
-        0,
-        GL_RGBA,
-        GL_UNSIGNED_BYTE,
-        texture_2d->data.data()
-    );
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    auto offset = std::size_t {0};
+    auto bytes = std::size_t {0};
+    for (auto level = 0u; level < texture_2d->mip_levels; ++level) {
+        const auto width = texture_2d->LevelWidth(level);
+        const auto height = texture_2d->LevelHeight(level);
+        const auto size = texture_2d->LevelSize(level);
+        const auto pixels = offset + size <= texture_2d->data.size() ? texture_2d->data.data() + offset : nullptr;
+        offset += size;
+
+        if (compressed && !decompress) {
+            glCompressedTexImage2D(
+                GL_TEXTURE_2D,
+                static_cast<GLint>(level),
+                internal_format(format),
+                static_cast<GLsizei>(width),
+                static_cast<GLsizei>(height),
+                0,
+                static_cast<GLsizei>(size),
+                pixels
+            );
+            bytes += size;
+            continue;
+        }
+
+        auto decoded = std::vector<uint8_t> {};
+        if (decompress && pixels) {
+            decoded = decode_blocks({pixels, size}, width, height, block_format(format));
+        }
+        glTexImage2D(
+            GL_TEXTURE_2D,
+            static_cast<GLint>(level),
+            GL_RGBA8,
+            static_cast<GLsizei>(width),
+            static_cast<GLsizei>(height),
+            0,
+            GL_RGBA,
+            GL_UNSIGNED_BYTE,
+            decompress ? (decoded.empty() ? nullptr : decoded.data()) : pixels
+        );
+        bytes += static_cast<std::size_t>(width) * height * 4;
+    }
+
+    // Textures that ship with a mip chain are sampled trilinearly. The chain
+    // may stop short of 1x1, so the last level is set explicitly.
+    const auto mipmapped = texture_2d->mip_levels > 1;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(texture_2d->mip_levels - 1));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, mipmapped ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+
+    sizes_[tex_id] = {bytes, texture_2d->data.size()};
+    uploaded_bytes_ += bytes;
+    memory_bytes_ += bytes;
+    cpu_memory_bytes_ += texture_2d->data.size();
 
     if (glGetError() != GL_NO_ERROR) {
         Logger::Log(LogLevel::Error, "OpenGL error failed to generate texture");
     }
 
-    texture->OnDispose([this](Disposable* target) {
-        glDeleteTextures(1, &(static_cast<Texture*>(target)->renderer_id));
-        Logger::Log(LogLevel::Info, "Texture buffer cleared {}", *static_cast<Texture*>(target));
-    });
+    return tex_id;
+}
+
+auto GLTextures::ReleaseDisposed() -> void {
+    const auto lock = std::scoped_lock(disposed_mutex_);
+    if (!disposed_.empty()) {
+        glDeleteTextures(static_cast<GLsizei>(disposed_.size()), disposed_.data());
+        for (auto tex_id : disposed_) ReleaseMemory(tex_id);
+        disposed_.clear();
+    }
+}
+
+auto GLTextures::ReleaseUploadedData() -> void {
+    for (const auto& texture : pending_release_) {
+        auto t = texture.lock();
+        if (!t) continue;
+        if (auto it = sizes_.find(t->renderer_id); it != sizes_.end()) {
+            cpu_memory_bytes_ -= it->second.cpu_bytes;
+            it->second.cpu_bytes = 0;
+        }
+        static_cast<Texture2D*>(t.get())->ReleaseData();
+    }
+    pending_release_.clear();
+}
+
+auto GLTextures::DeleteTexture(GLuint tex_id) -> void {
+    glDeleteTextures(1, &tex_id);
+    ReleaseMemory(tex_id);
+}
+
+auto GLTextures::ReleaseMemory(GLuint tex_id) -> void {
+    if (auto it = sizes_.find(tex_id); it != sizes_.end()) {
+        memory_bytes_ -= it->second.bytes;
+        cpu_memory_bytes_ -= it->second.cpu_bytes;
+        sizes_.erase(it);
+    }
+    if (current_texture_id_ == tex_id) current_texture_id_ = 0;
 }
 
 GLTextures::~GLTextures() {
+    ReleaseDisposed();
+    for (const auto& [_, entry] : uncommitted_) DeleteTexture(entry.second);
+    if (placeholder_id_ != 0) glDeleteTextures(1, &placeholder_id_);
     for (const auto& texture : textures_) {
         if (auto t = texture.lock()) t->Dispose();
     }
@@ -10,8 +10,11 @@
 #include "gleam/textures/texture.hpp"
 
 #include <memory>
+#include <mutex>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <glad/glad.h>
@@ -27,16 +30,128 @@ public:
     GLTextures& operator=(const GLTextures&) = delete;
     GLTextures& operator=(GLTextures&&) = delete;
 
-    auto Bind(const std::shared_ptr<Texture>& texture) -> void;
+    /**
+     * @brief Binds an uploaded texture. Textures that haven't been uploaded
+     * yet are substituted with a white placeholder.
+     */
+    auto Bind(GLuint tex_id) -> void;
+
+    /**
+     * @brief Creates a texture object and uploads the texture data.
+     *
+     * The texture itself isn't modified, its texture object is assigned to it
+     * by Commit(), so the upload can run while another thread updates the
+     * scene.
+     *
+     * @return std::size_t Number of bytes uploaded.
+     */
+    auto Upload(const std::shared_ptr<Texture>& texture) -> std::size_t;
+
+    /**
+     * @brief Returns the texture object of a texture uploaded since the last
+     * commit, or 0.
+     */
+    [[nodiscard]] auto UncommittedId(const Texture* texture) const -> GLuint;
+
+    /**
+     * @brief Assigns the texture objects of textures uploaded since the last
+     * call and registers their dispose callbacks. Texture objects of textures
+     * that were disposed in the meantime are deleted. Must be called while no
+     * frame is being prepared.
+     */
+    auto Commit() -> void;
+
+    /**
+     * @brief Returns the number of bytes an upload of the texture would take.
+     * Block-compressed textures the driver can't sample take more once
+     * they're decompressed.
+     */
+    [[nodiscard]] static auto UploadSize(const Texture& texture) -> std::size_t;
+
+    auto ReleaseDisposed() -> void;
+
+    /**
+     * @brief Releases the CPU copy of textures uploaded since the last call,
+     * unless their residency policy keeps it. Must be called while no frame
+     * is being prepared.
+     */
+    auto ReleaseUploadedData() -> void;
+
+    /// @brief Number of texture binds since the counters were reset.
+    [[nodiscard]] auto BindCount() const { return bind_count_; }
+
+    /// @brief Bytes of texture data uploaded since the counters were reset.
+    [[nodiscard]] auto UploadedBytes() const { return uploaded_bytes_; }
+
+    /// @brief Bytes of texture data currently held in GPU memory.
+    [[nodiscard]] auto MemoryBytes() const { return memory_bytes_; }
+
+    /// @brief Bytes of pixel data uploaded textures still keep on the CPU.
+    [[nodiscard]] auto CPUMemoryBytes() const { return cpu_memory_bytes_; }
+
+    auto ResetCounters() -> void {
+        bind_count_ = 0;
+        uploaded_bytes_ = 0;
+    }
 
     ~GLTextures();
 
 private:
     std::vector<std::weak_ptr<Texture>> textures_;
 
+    // Uploaded textures whose texture objects haven't been assigned to them yet.
+    std::unordered_map<const Texture*, std::pair<std::shared_ptr<Texture>, GLuint>> uncommitted_;
+
+    // Textures disposed on other threads are released on the GL thread.
+    std::vector<GLuint> disposed_;
+
+    std::mutex disposed_mutex_;
+
+    std::thread::id gl_thread_ {std::this_thread::get_id()};
+
+    struct Allocation {
+        std::size_t bytes {0};
+        std::size_t cpu_bytes {0};
+    };
+
+    // Size of each live texture, so memory can be accounted for on release.
+    std::unordered_map<GLuint, Allocation> sizes_;
+
+    // Uploaded textures whose CPU copy is released at the next safe point.
+    std::vector<std::weak_ptr<Texture>> pending_release_;
+
     GLuint current_texture_id_ {0};
 
-    auto GenerateTexture(Texture* texture) const -> void;
+    // Bound in place of textures that are still waiting to be uploaded.
+    GLuint placeholder_id_ {0};
+
+    std::size_t bind_count_ {0};
+
+    std::size_t uploaded_bytes_ {0};
+
+    std::size_t memory_bytes_ {0};
+
+    std::size_t cpu_memory_bytes_ {0};
+
+    // Block compression extensions, queried on the first compressed upload.
+    bool compression_queried_ {false};
+
+    bool s3tc_supported_ {false};
+
+    bool bptc_supported_ {false};
+
+    /**
+     * @brief Checks whether the driver can sample a pixel format directly.
+     */
+    auto SupportsFormat(TextureFormat format) -> bool;
+
+    auto GenerateTexture(Texture* texture) -> GLuint;
+
+    auto Placeholder() -> GLuint;
+
+    auto DeleteTexture(GLuint tex_id) -> void;
+
+    auto ReleaseMemory(GLuint tex_id) -> void;
 };
 
 }
\ No newline at end of file
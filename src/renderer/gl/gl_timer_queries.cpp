@@ -0,0 +1,71 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_timer_queries.hpp"
+
+
+namespace gleam {
+
+namespace {
+
+auto to_ms(GLuint64 start, GLuint64 end) {
+    return end > start ? static_cast<double>(end - start) / 1'000'000.0 : 0.0;
+}
+
+} // unnamed namespace
+
+GLTimerQueries::GLTimerQueries() {
+    for (auto& frame : frames_) {
+        glGenQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+    }
+}
+
+auto GLTimerQueries::BeginFrame() -> void {
+    current_ = (current_ + 1) % kFrameLatency;
+    auto& frame = frames_[current_];
+    if (frame.pending) Collect(frame);
+
+    // Timestamps are used rather than GL_TIME_ELAPSED because only one
+    // elapsed-time query can be active at a time, which rules out timing the
+    // frame and its passes together.
+    glQueryCounter(frame.queries[0], GL_TIMESTAMP);
+    frame.pending = true;
+}
+
+auto GLTimerQueries::EndPass(GPUPass pass) -> void {
+    const auto marker = static_cast<std::size_t>(pass) + 1;
+    glQueryCounter(frames_[current_].queries[marker], GL_TIMESTAMP);
+}
+
+auto GLTimerQueries::Collect(Frame& frame) -> void {
+    frame.pending = false;
+
+    // Queries complete in order, so the last one being available means the
+    // whole frame is. If the GPU is running that far behind, the frame is
+    // skipped and the previous timings are kept.
+    auto available = GLuint {0};
+    glGetQueryObjectuiv(frame.queries.back(), GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) return;
+
+    auto timestamps = std::array<GLuint64, kMarkers> {};
+    for (auto i = 0; i < kMarkers; ++i) {
+        glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &timestamps[i]);
+    }
+
+    for (auto i = 0; i < timings_.passes_ms.size(); ++i) {
+        timings_.passes_ms[i] = to_ms(timestamps[i], timestamps[i + 1]);
+    }
+    timings_.frame_ms = to_ms(timestamps.front(), timestamps.back());
+}
+
+GLTimerQueries::~GLTimerQueries() {
+    for (auto& frame : frames_) {
+        glDeleteQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+    }
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <glad/glad.h>
+
+namespace gleam {
+
+enum class GPUPass {
+    Clear,
+    Opaque,
+    Transparent,
+    Count
+};
+
+struct GPUTimings {
+    /// @brief GPU time of each pass in milliseconds, indexed by GPUPass.
+    std::array<double, static_cast<std::size_t>(GPUPass::Count)> passes_ms {};
+
+    /// @brief GPU time from the start of the first pass to the end of the last one.
+    double frame_ms {0.0};
+
+    [[nodiscard]] auto Pass(GPUPass pass) const {
+        return passes_ms[static_cast<std::size_t>(pass)];
+    }
+};
+
+class GLTimerQueries {
+public:
+    /// @brief Number of frames a frame's queries stay in flight before they're read back.
+    static constexpr std::size_t kFrameLatency {4};
+
+    GLTimerQueries();
+
+    GLTimerQueries(const GLTimerQueries&) = delete;
+    GLTimerQueries(GLTimerQueries&&) = delete;
+    auto operator=(const GLTimerQueries&) -> GLTimerQueries& = delete;
+    auto operator=(GLTimerQueries&&) -> GLTimerQueries& = delete;
+
+    /**
+     * @brief Collects the results of the frame submitted kFrameLatency frames
+     * ago and records the start of a new frame. Results that aren't available
+     * yet are dropped rather than waited for, so this never stalls.
+     */
+    auto BeginFrame() -> void;
+
+    /**
+     * @brief Records the end of a pass. Passes are expected to run in the
+     * order they're declared in, each starting where the previous one ended.
+     *
+     * @param pass Pass that just ended.
+     */
+    auto EndPass(GPUPass pass) -> void;
+
+    /**
+     * @brief Returns the most recent timings read back from the GPU.
+     *
+     * @return const GPUTimings&
+     */
+    [[nodiscard]] auto Timings() const -> const GPUTimings& {
+        return timings_;
+    }
+
+    ~GLTimerQueries();
+
+private:
+    static constexpr std::size_t kMarkers {static_cast<std::size_t>(GPUPass::Count) + 1};
+
+    struct Frame {
+        std::array<GLuint, kMarkers> queries {};
+        bool pending {false};
+    };
+
+    std::array<Frame, kFrameLatency> frames_;
+
+    std::size_t current_ {0};
+
+    GPUTimings timings_;
+
+    auto Collect(Frame& frame) -> void;
+};
+
+}
\ No newline at end of file
@@ -86,8 +86,8 @@ auto GLUniform::SetValue(const void* value) -> void {
     }
 }
 
-auto GLUniform::UploadIfNeeded() -> void {
-    if (!needs_upload_) return;
+auto GLUniform::UploadIfNeeded() -> bool {
+    if (!needs_upload_) return false;
     switch(type_) {
         case UniformType::Float: glUniform1f(location_, data_.f); break;
         case UniformType::Int: glUniform1i(location_, data_.i); break;
@@ -100,6 +100,7 @@ auto GLUniform::UploadIfNeeded() -> void {
     }
 
     needs_upload_ = false;
+    return true;
 }
 
 }
\ No newline at end of file
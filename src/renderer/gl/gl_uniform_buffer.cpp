@@ -61,33 +61,34 @@ auto GLUniformBuffer::operator=(GLUniformBuffer&& other) noexcept -> GLUniformBu
     return *this;
 }
 
-auto GLUniformBuffer::UploadIfNeeded(const void* data, std::size_t size) const -> void {
-    if (binding_point_ == -1) return;
+auto GLUniformBuffer::UploadIfNeeded(const void* data, std::size_t size) const -> std::size_t {
+    if (binding_point_ == -1) return 0;
 
     if (size > size_) {
         Logger::Log(LogLevel::Error, "UBO {} update size exceeds buffer size", name_);
-        return;
+        return 0;
     }
-    if (std::memcmp(data_.get(), data, size) != 0) {
-        glBindBuffer(GL_UNIFORM_BUFFER, buffer_);
-
-        auto mapped = glMapBufferRange(
-            GL_UNIFORM_BUFFER,
-            /* offset = */ 0,
-            size,
-            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT
-        );
-
-        if (mapped) {
-            std::memcpy(mapped, data, size);
-            glUnmapBuffer(GL_UNIFORM_BUFFER);
-        } else {
-            Logger::Log(LogLevel::Error, "UBO {} map buffer failed", name_);
-        }
+    if (std::memcmp(data_.get(), data, size) == 0) return 0;
+
+    glBindBuffer(GL_UNIFORM_BUFFER, buffer_);
 
-        glBindBuffer(GL_UNIFORM_BUFFER, 0);
-        std::memcpy(data_.get(), data, size);
+    auto mapped = glMapBufferRange(
+        GL_UNIFORM_BUFFER,
+        /* offset = */ 0,
+        size,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT
+    );
+
+    if (mapped) {
+        std::memcpy(mapped, data, size);
+        glUnmapBuffer(GL_UNIFORM_BUFFER);
+    } else {
+        Logger::Log(LogLevel::Error, "UBO {} map buffer failed", name_);
     }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    std::memcpy(data_.get(), data, size);
+    return size;
 }
 
 GLUniformBuffer::~GLUniformBuffer() {
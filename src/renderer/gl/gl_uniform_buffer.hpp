@@ -41,7 +41,12 @@ public:
     GLUniformBuffer(const GLUniformBuffer&) = delete;
     auto operator=(const GLUniformBuffer&) -> GLUniformBuffer& = delete;
 
-    auto UploadIfNeeded(const void* data, std::size_t size) const -> void;
+    /**
+     * @brief Uploads the data if it differs from the last upload.
+     *
+     * @return std::size_t Number of bytes uploaded.
+     */
+    auto UploadIfNeeded(const void* data, std::size_t size) const -> std::size_t;
 
     ~GLUniformBuffer();
 
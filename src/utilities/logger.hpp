@@ -82,6 +82,21 @@ private:
 
 namespace std {
 
+template <>
+struct formatter<gleam::math::UUID, char> {
+    constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+    template <typename FormatContext>
+    auto format(const gleam::math::UUID& uuid, FormatContext& ctx) const {
+        return std::format_to(ctx.out(), "{:08x}-{:04x}-{:04x}-{:04x}-{:012x}",
+            uuid.hi >> 32,
+            (uuid.hi >> 16) & 0xFFFF,
+            uuid.hi & 0xFFFF,
+            uuid.lo >> 48,
+            uuid.lo & 0xFFFFFFFFFFFF
+        );
+    }
+};
+
 template <typename T>
 struct formatter<T, enable_if_t<std::is_base_of_v<gleam::Identity, T>, char>> {
     constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
@@ -0,0 +1,98 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "utilities/mapped_file.hpp"
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace gleam {
+
+auto MappedFile::Open(const fs::path& path, Access access)
+    -> std::expected<std::shared_ptr<MappedFile>, std::string>
+{
+    auto file = std::shared_ptr<MappedFile>(new MappedFile());
+    auto error = [&path]() {
+        return std::unexpected("Unable to map file '" + path.string() + "'");
+    };
+
+#ifdef _WIN32
+    const auto flags = access == Access::Sequential ? FILE_FLAG_SEQUENTIAL_SCAN : 0;
+    auto handle = CreateFileW(
+        path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | flags, nullptr
+    );
+    if (handle == INVALID_HANDLE_VALUE) return error();
+
+    auto size = LARGE_INTEGER {};
+    if (!GetFileSizeEx(handle, &size)) {
+        CloseHandle(handle);
+        return error();
+    }
+    file->size_ = static_cast<std::size_t>(size.QuadPart);
+    if (file->size_ == 0) {
+        CloseHandle(handle);
+        return file;
+    }
+
+    // The mapping object keeps the file open, so the handle can be closed.
+    file->mapping_ = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(handle);
+    if (file->mapping_ == nullptr) return error();
+
+    file->data_ = static_cast<const std::byte*>(
+        MapViewOfFile(file->mapping_, FILE_MAP_READ, 0, 0, 0)
+    );
+    if (file->data_ == nullptr) return error();
+#else
+    const auto fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) return error();
+
+    struct stat info {};
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return error();
+    }
+    file->size_ = static_cast<std::size_t>(info.st_size);
+    if (file->size_ == 0) {
+        close(fd);
+        return file;
+    }
+
+    // The mapping holds its own reference to the file, so it can be closed.
+    auto data = mmap(nullptr, file->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return error();
+
+    // Loose files are read front to back, so let the kernel read ahead
+    // aggressively. Archives are read an entry at a time, in any order.
+    if (access == Access::Sequential) madvise(data, file->size_, MADV_SEQUENTIAL);
+    file->data_ = static_cast<const std::byte*>(data);
+#endif
+
+    return file;
+}
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+    if (data_ != nullptr) UnmapViewOfFile(data_);
+    if (mapping_ != nullptr) CloseHandle(mapping_);
+#else
+    if (data_ != nullptr) munmap(const_cast<std::byte*>(data_), size_);
+#endif
+}
+
+}
\ No newline at end of file
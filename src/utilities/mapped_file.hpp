@@ -0,0 +1,135 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <type_traits>
+
+namespace gleam {
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Read-only memory mapping of a file.
+ *
+ * Pages are loaded by the OS on first access and shared with the page cache,
+ * so data can be read in place without first being copied into the process.
+ * The mapping is released when the last reference to the object goes away.
+ */
+class MappedFile {
+public:
+    /// @brief Expected order in which the mapped pages are read.
+    enum class Access {
+        Sequential,
+        Random
+    };
+
+    /**
+     * @brief Maps a file into memory.
+     *
+     * @param path File system path to the file.
+     * @param access Hint for how the OS should read ahead.
+     * @return std::expected<std::shared_ptr<MappedFile>, std::string>
+     */
+    [[nodiscard]] static auto Open(const fs::path& path, Access access = Access::Sequential)
+        -> std::expected<std::shared_ptr<MappedFile>, std::string>;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    /**
+     * @brief Returns the mapped bytes.
+     *
+     * @return std::span<const std::byte>
+     */
+    [[nodiscard]] auto Bytes() const {
+        return std::span<const std::byte> {data_, size_};
+    }
+
+    [[nodiscard]] auto Size() const { return size_; }
+
+    ~MappedFile();
+
+private:
+    const std::byte* data_ {nullptr};
+
+    std::size_t size_ {0};
+
+#ifdef _WIN32
+    void* mapping_ {nullptr};
+#endif
+
+    MappedFile() = default;
+};
+
+/**
+ * @brief Sequential reader over a byte range with bounds checking.
+ */
+class ByteReader {
+public:
+    explicit ByteReader(std::span<const std::byte> bytes) : bytes_(bytes) {}
+
+    /**
+     * @brief Copies a trivially copyable value out of the range.
+     *
+     * @param value Output value.
+     * @return bool False if the range doesn't hold enough bytes.
+     */
+    template <class T> requires std::is_trivially_copyable_v<T>
+    auto Read(T& value) {
+        if (Remaining() < sizeof(T)) return false;
+        std::memcpy(&value, bytes_.data() + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    /**
+     * @brief Returns a view of the next bytes and advances past them.
+     *
+     * @param size Number of bytes.
+     * @return std::span<const std::byte> Empty if the range doesn't hold enough bytes.
+     */
+    auto Take(std::size_t size) -> std::span<const std::byte> {
+        if (Remaining() < size) return {};
+        auto output = bytes_.subspan(offset_, size);
+        offset_ += size;
+        return output;
+    }
+
+    [[nodiscard]] auto Remaining() const -> std::size_t { return bytes_.size() - offset_; }
+
+    /// @brief Returns the number of bytes read so far.
+    [[nodiscard]] auto Offset() const -> std::size_t { return offset_; }
+
+    /**
+     * @brief Moves to an offset from the start of the range.
+     *
+     * @param offset Offset in bytes.
+     * @return bool False if the offset is past the end of the range.
+     */
+    auto Seek(std::size_t offset) {
+        if (offset > bytes_.size()) return false;
+        offset_ = offset;
+        return true;
+    }
+
+private:
+    std::span<const std::byte> bytes_;
+
+    std::size_t offset_ {0};
+};
+
+}
\ No newline at end of file
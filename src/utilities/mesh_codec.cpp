@@ -0,0 +1,225 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "utilities/mesh_codec.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace gleam {
+
+namespace {
+
+// The LZ stage follows the layout of LZ4 blocks. Each sequence starts with a
+// token holding the literal length in the high nibble and the match length
+// minus kMinMatch in the low nibble, either of which continues in extra bytes
+// when it's 15. Literals follow, then a 16-bit match offset. The last
+// sequence only has literals.
+constexpr auto kMinMatch = std::size_t {4};
+
+constexpr auto kMaxOffset = std::size_t {65535};
+
+constexpr auto kHashBits = 14;
+
+auto load32(const std::byte* ptr) {
+    auto value = uint32_t {};
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+auto store32(std::byte* ptr, uint32_t value) {
+    std::memcpy(ptr, &value, sizeof(value));
+}
+
+auto hash(uint32_t sequence) -> std::size_t {
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+// Maps small negative and positive differences to small unsigned values.
+auto zigzag(uint32_t value) -> uint32_t {
+    return (value << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(value) >> 31);
+}
+
+auto unzigzag(uint32_t value) -> uint32_t {
+    return (value >> 1) ^ (0u - (value & 1u));
+}
+
+auto write_length(std::vector<std::byte>& output, std::size_t length) {
+    for (; length >= 255; length -= 255) output.push_back(std::byte {255});
+    output.push_back(static_cast<std::byte>(length));
+}
+
+auto write_sequence(
+    std::vector<std::byte>& output,
+    std::span<const std::byte> literals,
+    std::size_t offset,
+    std::size_t match
+) {
+    const auto literal_nibble = std::min<std::size_t>(literals.size(), 15);
+    const auto match_nibble = match == 0 ? 0 : std::min<std::size_t>(match - kMinMatch, 15);
+    output.push_back(static_cast<std::byte>(literal_nibble << 4 | match_nibble));
+    if (literal_nibble == 15) write_length(output, literals.size() - 15);
+    output.insert(output.end(), literals.begin(), literals.end());
+
+    if (match == 0) return;
+    output.push_back(static_cast<std::byte>(offset & 0xFF));
+    output.push_back(static_cast<std::byte>(offset >> 8));
+    if (match_nibble == 15) write_length(output, match - kMinMatch - 15);
+}
+
+auto lz_compress(std::span<const std::byte> input) {
+    const auto size = input.size();
+    const auto data = input.data();
+    auto output = std::vector<std::byte> {};
+    output.reserve(size / 2 + 16);
+
+    // Positions are stored off by one, so zero marks an empty slot.
+    auto table = std::vector<uint32_t>(std::size_t {1} << kHashBits, 0);
+    auto anchor = std::size_t {0};
+    auto i = std::size_t {0};
+    while (size >= kMinMatch && i <= size - kMinMatch) {
+        const auto sequence = load32(data + i);
+        auto& slot = table[hash(sequence)];
+        const auto candidate = static_cast<std::size_t>(slot);
+        slot = static_cast<uint32_t>(i + 1);
+
+        if (candidate == 0 || i + 1 - candidate > kMaxOffset || load32(data + candidate - 1) != sequence) {
+            // Step faster through data that doesn't compress.
+            i += 1 + ((i - anchor) >> 6);
+            continue;
+        }
+
+        const auto match = candidate - 1;
+        auto length = kMinMatch;
+        while (i + length < size && data[match + length] == data[i + length]) ++length;
+
+        write_sequence(output, input.subspan(anchor, i - anchor), i - match, length);
+        i += length;
+        anchor = i;
+    }
+
+    write_sequence(output, input.subspan(anchor), 0, 0);
+    return output;
+}
+
+auto read_length(const std::byte*& ip, const std::byte* end, std::size_t& length) {
+    while (ip != end) {
+        const auto value = std::to_integer<std::size_t>(*ip++);
+        length += value;
+        if (value != 255) return true;
+    }
+    return false;
+}
+
+auto copy_match(std::byte* op, std::size_t offset, std::size_t length) {
+    const auto* match = op - offset;
+    if (offset == 1) {
+        std::memset(op, std::to_integer<int>(*match), length);
+        return;
+    }
+
+    // Overlapping matches repeat the last `offset` bytes, so they're copied
+    // in steps no longer than the offset.
+    while (length > 0) {
+        const auto step = std::min(length, offset);
+        std::memcpy(op, match, step);
+        op += step;
+        match += step;
+        length -= step;
+    }
+}
+
+auto lz_decompress(std::span<const std::byte> input, std::span<std::byte> output) {
+    auto ip = input.data();
+    const auto ip_end = ip + input.size();
+    auto op = output.data();
+    const auto op_begin = op;
+    const auto op_end = op + output.size();
+
+    while (ip < ip_end) {
+        const auto token = std::to_integer<std::size_t>(*ip++);
+
+        auto literals = token >> 4;
+        if (literals == 15 && !read_length(ip, ip_end, literals)) return false;
+        if (literals > static_cast<std::size_t>(ip_end - ip)) return false;
+        if (literals > static_cast<std::size_t>(op_end - op)) return false;
+        std::memcpy(op, ip, literals);
+        ip += literals;
+        op += literals;
+
+        if (ip == ip_end) break;
+
+        if (ip_end - ip < 2) return false;
+        const auto offset = std::to_integer<std::size_t>(ip[0]) |
+            std::to_integer<std::size_t>(ip[1]) << 8;
+        ip += 2;
+
+        auto length = token & 15;
+        if (length == 15 && !read_length(ip, ip_end, length)) return false;
+        length += kMinMatch;
+
+        if (offset == 0 || offset > static_cast<std::size_t>(op - op_begin)) return false;
+        if (length > static_cast<std::size_t>(op_end - op)) return false;
+        copy_match(op, offset, length);
+        op += length;
+    }
+
+    return op == op_end;
+}
+
+} // unnamed namespace
+
+auto encode_mesh_stream(std::span<const std::byte> data, uint32_t stride) -> std::vector<std::byte> {
+    stride = std::max(stride, 1u);
+    const auto count = data.size() / sizeof(uint32_t);
+    const auto words = data.data();
+
+    auto planes = std::vector<std::byte>(count * sizeof(uint32_t));
+    for (auto i = std::size_t {0}; i < count; ++i) {
+        const auto previous = i >= stride ? load32(words + (i - stride) * 4) : 0u;
+        const auto delta = zigzag(load32(words + i * 4) - previous);
+        planes[i] = static_cast<std::byte>(delta);
+        planes[count + i] = static_cast<std::byte>(delta >> 8);
+        planes[count * 2 + i] = static_cast<std::byte>(delta >> 16);
+        planes[count * 3 + i] = static_cast<std::byte>(delta >> 24);
+    }
+
+    return lz_compress(planes);
+}
+
+auto decode_mesh_stream(
+    std::span<const std::byte> encoded,
+    std::span<std::byte> output,
+    uint32_t stride
+) -> bool {
+    if (stride == 0 || output.size() % (sizeof(uint32_t) * stride) != 0) return false;
+
+    const auto count = output.size() / sizeof(uint32_t);
+    auto planes = std::make_unique_for_overwrite<std::byte[]>(output.size());
+    if (!lz_decompress(encoded, {planes.get(), output.size()})) return false;
+
+    // Interleaving the planes and undoing the deltas are separate passes, so
+    // the first has no dependency between words and vectorizes.
+    const auto p = planes.get();
+    const auto words = output.data();
+    for (auto i = std::size_t {0}; i < count; ++i) {
+        const auto delta =
+            std::to_integer<uint32_t>(p[i]) |
+            std::to_integer<uint32_t>(p[count + i]) << 8 |
+            std::to_integer<uint32_t>(p[count * 2 + i]) << 16 |
+            std::to_integer<uint32_t>(p[count * 3 + i]) << 24;
+        store32(words + i * 4, unzigzag(delta));
+    }
+    for (auto i = std::size_t {stride}; i < count; ++i) {
+        store32(words + i * 4, load32(words + i * 4) + load32(words + (i - stride) * 4));
+    }
+
+    return true;
+}
+
+}
\ No newline at end of file
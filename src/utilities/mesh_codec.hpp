@@ -0,0 +1,53 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace gleam {
+
+/**
+ * @brief Losslessly compresses a stream of 32-bit words, such as the vertex
+ * or index data of a mesh.
+ *
+ * The stream is treated as records of `stride` words. Each word is replaced
+ * by the zigzag-encoded difference to the same word of the previous record,
+ * the differences are split into byte planes so the mostly-zero high bytes
+ * end up next to each other, and the planes are compressed with a byte-wise
+ * LZ stage. Vertex streams use the vertex stride, index streams a stride of 1.
+ *
+ * @param data Bytes of the stream, a whole number of records.
+ * @param stride Number of 32-bit words in a record.
+ * @return std::vector<std::byte> Encoded stream.
+ */
+[[nodiscard]] auto encode_mesh_stream(
+    std::span<const std::byte> data,
+    uint32_t stride
+) -> std::vector<std::byte>;
+
+/**
+ * @brief Decodes a stream produced by `encode_mesh_stream`.
+ *
+ * The encoded stream is validated while it's decoded, so corrupt input is
+ * rejected rather than read or written out of bounds.
+ *
+ * @param encoded Encoded stream.
+ * @param output Destination for the decoded bytes, sized to the original stream.
+ * @param stride Number of 32-bit words in a record.
+ * @return bool False if the stream is corrupt or doesn't decode to `output.size()` bytes.
+ */
+[[nodiscard]] auto decode_mesh_stream(
+    std::span<const std::byte> encoded,
+    std::span<std::byte> output,
+    uint32_t stride
+) -> bool;
+
+}
\ No newline at end of file
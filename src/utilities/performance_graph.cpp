@@ -7,16 +7,31 @@
 
 #include "utilities/performance_graph.hpp"
 
+#include <cstddef>
+
 #include <imgui.h>
 
 namespace gleam {
 
+namespace {
+
+auto to_kb(std::size_t bytes) {
+    return static_cast<double>(bytes) / 1024.0;
+}
+
+auto to_mb(std::size_t bytes) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+} // unnamed namespace
+
 auto PerformanceGraph::RenderGraph(const float viewport_width) const -> void {
     static const float kWindowWidth {250.0f};
-    static const float kWindowHeight {195.0f};
-    ImGui::SetNextWindowSize({kWindowWidth, kWindowHeight});
+    // The height follows the content, since the counters can be collapsed.
+    ImGui::SetNextWindowSize({kWindowWidth, 0.0f});
     ImGui::SetNextWindowPos({viewport_width - kWindowWidth - 10.0f, 10.0f});
     ImGui::Begin("##Stats", nullptr,
+        ImGuiWindowFlags_AlwaysAutoResize |
         ImGuiWindowFlags_NoResize |
         ImGuiWindowFlags_NoMove |
         ImGuiWindowFlags_NoCollapse |
@@ -34,7 +49,7 @@ auto PerformanceGraph::RenderGraph(const float viewport_width) const -> void {
 
     // frame time
     ImGui::PushStyleColor(ImGuiCol_PlotHistogram, {0.40f, 0.70f, 0.20f, 1.0f});
-    ImGui::Text("Frame Time: %.0fms", frame_time_.LastValue());
+    ImGui::Text("Frame Time: %.2fms", frame_time_.LastValue());
     ImGui::PlotHistogram(
         "##Frame Time",
         frame_time_.Buffer(), 150, 0, nullptr, 0.0f, 10.0f, {235, 40}
@@ -50,7 +65,51 @@ auto PerformanceGraph::RenderGraph(const float viewport_width) const -> void {
     );
     ImGui::PopStyleColor();
 
+    // update to submission latency
+    ImGui::PushStyleColor(ImGuiCol_PlotHistogram, {0.85f, 0.55f, 0.10f, 1.0f});
+    ImGui::Text("Latency: %.0fms", latency_.LastValue());
+    ImGui::PlotHistogram(
+        "##Latency",
+        latency_.Buffer(), 150, 0, nullptr, 0.0f, 50.0f, {235, 40}
+    );
+    ImGui::PopStyleColor();
+
+    // gpu time, read back from timer queries a few frames late
+    ImGui::PushStyleColor(ImGuiCol_PlotHistogram, {0.55f, 0.30f, 0.75f, 1.0f});
+    ImGui::Text("GPU Time: %.2fms", gpu_time_.LastValue());
+    ImGui::PlotHistogram(
+        "##GPU Time",
+        gpu_time_.Buffer(), 150, 0, nullptr, 0.0f, 10.0f, {235, 40}
+    );
+    ImGui::PopStyleColor();
+
+    RenderCounters();
+
     ImGui::End();
 }
 
+auto PerformanceGraph::RenderCounters() const -> void {
+    const auto& s = statistics_;
+    if (!ImGui::CollapsingHeader("Renderer (avg)")) return;
+
+    ImGui::Text("Draw calls: %zu (%zu instanced)", s.draw_calls, s.instanced_draws);
+    ImGui::Text("Triangles: %zu", s.triangles);
+    ImGui::Text("Program switches: %zu", s.program_switches);
+    ImGui::Text("VAO binds: %zu", s.vao_binds);
+    ImGui::Text("Texture binds: %zu", s.texture_binds);
+    ImGui::Text("Uniform uploads: %zu", s.uniform_uploads);
+    ImGui::Text("UBO uploads: %.1fKB", to_kb(s.ubo_bytes_uploaded));
+    ImGui::Text("Buffer uploads: %.1fKB", to_kb(s.buffer_bytes_uploaded));
+    ImGui::Text("Texture uploads: %.1fKB", to_kb(s.texture_bytes_uploaded));
+    ImGui::Text("Uploads deferred: %zu", s.uploads_deferred);
+    ImGui::Text("Culled (frustum): %zu", s.culled_frustum);
+    ImGui::Text("Culled (geometry): %zu", s.culled_invalid_geometry);
+    ImGui::Text("Culled (program): %zu", s.culled_invalid_program);
+    ImGui::Text("Culled (not resident): %zu", s.culled_not_resident);
+    ImGui::Text("Buffer memory: %.2fMB", to_mb(s.buffer_memory_bytes));
+    ImGui::Text("Texture memory: %.2fMB", to_mb(s.texture_memory_bytes));
+    ImGui::Text("Geometry CPU copies: %.2fMB", to_mb(s.geometry_cpu_memory_bytes));
+    ImGui::Text("Texture CPU copies: %.2fMB", to_mb(s.texture_cpu_memory_bytes));
+}
+
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "gleam/core/render_statistics.hpp"
+
 #include "utilities/data_series.hpp"
 
 namespace gleam {
@@ -14,7 +16,9 @@ namespace gleam {
 enum class PerformanceMetric {
     FrameTime,
     FramesPerSecond,
-    RenderedObjects
+    RenderedObjects,
+    Latency,
+    GPUTime
 };
 
 class PerformanceGraph {
@@ -32,15 +36,32 @@ public:
         case RenderedObjects:
             rendered_objects_.Push(static_cast<float>(value));
             break;
+        case Latency:
+            latency_.Push(static_cast<float>(value));
+            break;
+        case GPUTime:
+            gpu_time_.Push(static_cast<float>(value));
+            break;
         }
     }
 
+    auto SetStatistics(const RenderStatistics& statistics) {
+        statistics_ = statistics;
+    }
+
     auto RenderGraph(const float viewport_width) const -> void;
 
 private:
     DataSeries<float, 150> frame_time_;
     DataSeries<float, 150> frames_per_second_;
     DataSeries<float, 150> rendered_objects_;
+    DataSeries<float, 150> latency_;
+    DataSeries<float, 150> gpu_time_;
+
+    /// @brief Renderer statistics averaged over recent frames.
+    RenderStatistics statistics_;
+
+    auto RenderCounters() const -> void;
 };
 
 }
\ No newline at end of file
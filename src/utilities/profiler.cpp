@@ -0,0 +1,183 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "utilities/profiler.hpp"
+
+#include <format>
+#include <fstream>
+#include <string_view>
+
+namespace gleam {
+
+namespace {
+
+// Threads don't own their buffers, the profiler does, so events survive the
+// thread until they're exported. WorkerPool threads keep theirs for the life
+// of the pool; the handle hands a buffer back for reuse when its thread exits,
+// which keeps short-lived threads (e.g. the asset builder's batch workers) from
+// growing the profiler by a buffer each time.
+struct ThreadBufferHandle {
+    ProfileBuffer* buffer {nullptr};
+
+    ~ThreadBufferHandle() {
+        if (buffer != nullptr) buffer->Release();
+    }
+};
+
+thread_local ThreadBufferHandle thread_buffer;
+
+auto escape(std::string_view str) {
+    auto output = std::string {};
+    output.reserve(str.size());
+    for (auto c : str) {
+        if (c == '"' || c == '\\') output += '\\';
+        if (static_cast<unsigned char>(c) < 0x20) continue;
+        output += c;
+    }
+    return output;
+}
+
+auto to_us(uint64_t ns) {
+    return static_cast<double>(ns) / 1000.0;
+}
+
+} // unnamed namespace
+
+auto Profiler::Get() -> Profiler& {
+    static auto instance = Profiler {};
+    return instance;
+}
+
+auto Profiler::ThreadBuffer() -> ProfileBuffer& {
+    if (thread_buffer.buffer == nullptr) {
+        const auto lock = std::scoped_lock(buffers_mutex_);
+        for (const auto& buffer : buffers_) {
+            if (buffer->TryAcquire()) {
+                thread_buffer.buffer = buffer.get();
+                return *thread_buffer.buffer;
+            }
+        }
+        const auto id = static_cast<uint32_t>(buffers_.size()) + 1;
+        buffers_.emplace_back(std::make_unique<ProfileBuffer>(id, kEventsPerThread));
+        thread_buffer.buffer = buffers_.back().get();
+    }
+    return *thread_buffer.buffer;
+}
+
+auto Profiler::SetThreadName(std::string_view name) -> void {
+    auto& buffer = ThreadBuffer();
+    const auto lock = std::scoped_lock(buffers_mutex_);
+    buffer.SetThreadName(name);
+}
+
+auto Profiler::MarkFrame() -> void {
+    const auto frame = frame_.fetch_add(1, std::memory_order_relaxed);
+    if (!IsEnabled()) return;
+
+    const auto now = Now();
+    ThreadBuffer().Push({
+        .name = "Frame",
+        .start = now,
+        .end = now,
+        .value = static_cast<double>(frame),
+        .type = ProfileEventType::Frame
+    });
+}
+
+auto Profiler::Counter(const char* name, double value) -> void {
+    if (!IsEnabled()) return;
+
+    const auto now = Now();
+    ThreadBuffer().Push({
+        .name = name,
+        .start = now,
+        .end = now,
+        .value = value,
+        .type = ProfileEventType::Counter
+    });
+}
+
+auto Profiler::Clear() -> void {
+    const auto lock = std::scoped_lock(buffers_mutex_);
+    for (auto& buffer : buffers_) buffer->Clear();
+    frame_ = 0;
+}
+
+auto Profiler::EventCount() -> std::size_t {
+    const auto lock = std::scoped_lock(buffers_mutex_);
+    auto count = std::size_t {0};
+    for (const auto& buffer : buffers_) {
+        const auto buffer_lock = buffer->Lock();
+        count += buffer->Count();
+    }
+    return count;
+}
+
+auto Profiler::WriteChromeTrace(std::ostream& stream) -> void {
+    const auto lock = std::scoped_lock(buffers_mutex_);
+    auto first = true;
+    auto write = [&](const std::string& event) {
+        stream << (first ? "\n    " : ",\n    ") << event;
+        first = false;
+    };
+
+    stream << R"({"displayTimeUnit": "ms", "traceEvents": [)";
+
+    for (const auto& buffer : buffers_) {
+        const auto buffer_lock = buffer->Lock();
+        const auto tid = buffer->ThreadId();
+        const auto& thread_name = buffer->ThreadName();
+        write(std::format(
+            R"({{"name": "thread_name", "ph": "M", "pid": 1, "tid": {}, "args": {{"name": "{}"}}}})",
+            tid, thread_name.empty() ? std::format("Thread {}", tid) : escape(thread_name)
+        ));
+
+        const auto count = buffer->Count();
+        for (auto i = std::size_t {0}; i < count; ++i) {
+            const auto& event = buffer->At(i);
+            const auto name = escape(event.name != nullptr ? event.name : "");
+            switch (event.type) {
+                case ProfileEventType::Zone:
+                    write(std::format(
+                        R"({{"name": "{}", "ph": "X", "pid": 1, "tid": {}, "ts": {:.3f}, "dur": {:.3f}, "args": {{"depth": {}}}}})",
+                        name, tid, to_us(event.start), to_us(event.end - event.start), event.depth
+                    ));
+                    break;
+                case ProfileEventType::Frame:
+                    write(std::format(
+                        R"({{"name": "{}", "ph": "i", "s": "g", "pid": 1, "tid": {}, "ts": {:.3f}, "args": {{"frame": {}}}}})",
+                        name, tid, to_us(event.start), static_cast<uint64_t>(event.value)
+                    ));
+                    break;
+                case ProfileEventType::Counter:
+                    write(std::format(
+                        R"({{"name": "{}", "ph": "C", "pid": 1, "tid": {}, "ts": {:.3f}, "args": {{"value": {}}}}})",
+                        name, tid, to_us(event.start), event.value
+                    ));
+                    break;
+            }
+        }
+
+        if (buffer->Dropped() > 0) {
+            write(std::format(
+                R"({{"name": "dropped_events", "ph": "C", "pid": 1, "tid": {}, "ts": 0, "args": {{"value": {}}}}})",
+                tid, buffer->Dropped()
+            ));
+        }
+    }
+
+    stream << "\n]}\n";
+}
+
+auto Profiler::ExportChromeTrace(const fs::path& path) -> bool {
+    auto file = std::ofstream {path};
+    if (!file) return false;
+    WriteChromeTrace(file);
+    return static_cast<bool>(file);
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,371 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Instrumentation macros. They compile to nothing unless GLEAM_PROFILING is
+ * defined, so zones can stay in hot paths of release builds. Names must
+ * outlive the profiler (string literals or `__func__`), since only the
+ * pointer is recorded.
+ */
+#ifdef GLEAM_PROFILING
+    #define GLEAM_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define GLEAM_PROFILE_CONCAT(a, b) GLEAM_PROFILE_CONCAT_IMPL(a, b)
+    #define GLEAM_PROFILE_ZONE(name) \
+        const auto GLEAM_PROFILE_CONCAT(profile_zone_, __LINE__) = ::gleam::ProfileZone {name}
+    #define GLEAM_PROFILE_FUNCTION() GLEAM_PROFILE_ZONE(__func__)
+    #define GLEAM_PROFILE_FRAME() ::gleam::Profiler::Get().MarkFrame()
+    #define GLEAM_PROFILE_COUNTER(name, value) \
+        ::gleam::Profiler::Get().Counter(name, static_cast<double>(value))
+    #define GLEAM_PROFILE_THREAD(name) ::gleam::Profiler::Get().SetThreadName(name)
+#else
+    #define GLEAM_PROFILE_ZONE(name) ((void)0)
+    #define GLEAM_PROFILE_FUNCTION() ((void)0)
+    #define GLEAM_PROFILE_FRAME() ((void)0)
+    #define GLEAM_PROFILE_COUNTER(name, value) ((void)0)
+    #define GLEAM_PROFILE_THREAD(name) ((void)0)
+#endif
+
+namespace gleam {
+
+namespace fs = std::filesystem;
+
+enum class ProfileEventType : uint8_t {
+    Zone,
+    Frame,
+    Counter
+};
+
+struct ProfileEvent {
+    /// @brief Name of the zone, frame marker or counter.
+    const char* name {nullptr};
+
+    /// @brief Start time in nanoseconds since the profiler was created.
+    uint64_t start {0};
+
+    /// @brief End time in nanoseconds. Equal to `start` for instant events.
+    uint64_t end {0};
+
+    /// @brief Counter value, or the frame index for frame markers.
+    double value {0.0};
+
+    /// @brief Nesting depth of a zone on its thread.
+    uint32_t depth {0};
+
+    /// @brief Event type.
+    ProfileEventType type {ProfileEventType::Zone};
+};
+
+class ProfileBuffer {
+public:
+    /**
+     * @brief Constructs a ProfileBuffer object with a fixed capacity.
+     *
+     * @param thread_id Sequential id of the owning thread.
+     * @param capacity Maximum number of events the buffer holds.
+     */
+    ProfileBuffer(uint32_t thread_id, std::size_t capacity)
+      : events_(capacity), thread_id_(thread_id) {}
+
+    /**
+     * @brief Appends an event. Only the owning thread writes to the buffer,
+     * so this is a plain store followed by publishing the new count. Events
+     * past the capacity are dropped and counted. A pending `Clear()` is
+     * applied first, which is the only time the owner takes the lock.
+     *
+     * @param event Event to append.
+     */
+    auto Push(const ProfileEvent& event) {
+        if (clear_pending_.load(std::memory_order_acquire)) ApplyClear();
+        const auto count = count_.load(std::memory_order_relaxed);
+        if (count == events_.size()) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        events_[count] = event;
+        count_.store(count + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Returns the number of published events.
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]] auto Count() const -> std::size_t {
+        if (clear_pending_.load(std::memory_order_acquire)) return 0;
+        return count_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns the number of events dropped because the buffer was full.
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]] auto Dropped() const -> std::size_t {
+        if (clear_pending_.load(std::memory_order_acquire)) return 0;
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns a published event.
+     *
+     * @param index Index of the event, less than `Count()`.
+     * @return const ProfileEvent&
+     */
+    [[nodiscard]] auto At(std::size_t index) const -> const ProfileEvent& {
+        return events_[index];
+    }
+
+    [[nodiscard]] auto ThreadId() const { return thread_id_; }
+
+    [[nodiscard]] auto ThreadName() const -> const std::string& { return thread_name_; }
+
+    auto SetThreadName(std::string_view name) { thread_name_ = name; }
+
+    /**
+     * @brief Discards every recorded event. The owning thread may be writing,
+     * so the events are only marked as discarded; the buffer reads as empty
+     * and the owner resets it before its next push.
+     */
+    auto Clear() {
+        const auto lock = std::scoped_lock(mutex_);
+        clear_pending_.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Locks the buffer for reading. The owning thread can't apply a
+     * pending clear, and so reuse the slots being read, while it's held.
+     *
+     * @return std::unique_lock<std::mutex>
+     */
+    [[nodiscard]] auto Lock() {
+        return std::unique_lock {mutex_};
+    }
+
+    /**
+     * @brief Marks the buffer as free once its owning thread exits.
+     */
+    auto Release() {
+        depth = 0;
+        released_.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Claims a released buffer for a new thread. Events recorded by
+     * the previous owner are kept, so short-lived threads that run one after
+     * another share a single track in the trace.
+     *
+     * @return bool True if the buffer was released and is now claimed.
+     */
+    auto TryAcquire() {
+        auto expected = true;
+        return released_.compare_exchange_strong(expected, false, std::memory_order_acq_rel);
+    }
+
+    /// @brief Nesting depth of the zones currently open on the owning thread.
+    uint32_t depth {0};
+
+private:
+    std::vector<ProfileEvent> events_;
+
+    std::mutex mutex_;
+
+    std::atomic<bool> released_ {false};
+
+    std::atomic<bool> clear_pending_ {false};
+
+    std::atomic<std::size_t> count_ {0};
+
+    std::atomic<std::size_t> dropped_ {0};
+
+    std::string thread_name_;
+
+    uint32_t thread_id_ {0};
+
+    auto ApplyClear() -> void {
+        const auto lock = std::scoped_lock(mutex_);
+        count_.store(0, std::memory_order_relaxed);
+        dropped_.store(0, std::memory_order_relaxed);
+        clear_pending_.store(false, std::memory_order_relaxed);
+    }
+};
+
+class Profiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Number of events each thread can record before events are dropped.
+    static constexpr std::size_t kEventsPerThread = 1 << 18;
+
+    Profiler(const Profiler&) = delete;
+    auto operator=(const Profiler&) -> Profiler& = delete;
+
+    /**
+     * @brief Returns the process-wide profiler.
+     *
+     * @return Profiler&
+     */
+    static auto Get() -> Profiler&;
+
+    /**
+     * @brief Turns recording on or off. Zones opened while recording is off
+     * are not recorded, even if it's turned on before they close.
+     *
+     * @param enabled Recording state.
+     */
+    auto SetEnabled(bool enabled) {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns whether the profiler is recording.
+     *
+     * @return bool
+     */
+    [[nodiscard]] auto IsEnabled() const {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the current time in nanoseconds since the profiler was created.
+     *
+     * @return uint64_t
+     */
+    [[nodiscard]] auto Now() const -> uint64_t {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch_).count();
+    }
+
+    /**
+     * @brief Returns the calling thread's buffer, creating it on first use.
+     *
+     * @return ProfileBuffer&
+     */
+    auto ThreadBuffer() -> ProfileBuffer&;
+
+    /**
+     * @brief Names the calling thread in exported traces.
+     *
+     * @param name Thread name.
+     */
+    auto SetThreadName(std::string_view name) -> void;
+
+    /**
+     * @brief Records the start of a new frame.
+     */
+    auto MarkFrame() -> void;
+
+    /**
+     * @brief Records a sample of a named counter.
+     *
+     * @param name Counter name.
+     * @param value Counter value.
+     */
+    auto Counter(const char* name, double value) -> void;
+
+    /**
+     * @brief Discards every recorded event. Safe to call while other threads
+     * are recording; events they push concurrently may be discarded as well.
+     */
+    auto Clear() -> void;
+
+    /**
+     * @brief Returns the total number of recorded events across all threads.
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]] auto EventCount() -> std::size_t;
+
+    /**
+     * @brief Writes the recorded events in the Chrome trace event format,
+     * which can be opened in chrome://tracing or ui.perfetto.dev.
+     *
+     * @param stream Output stream.
+     */
+    auto WriteChromeTrace(std::ostream& stream) -> void;
+
+    /**
+     * @brief Writes the recorded events to a Chrome trace JSON file.
+     *
+     * @param path Output file path.
+     * @return bool True if the file was written.
+     */
+    auto ExportChromeTrace(const fs::path& path) -> bool;
+
+private:
+    std::vector<std::unique_ptr<ProfileBuffer>> buffers_;
+
+    std::mutex buffers_mutex_;
+
+    std::atomic<bool> enabled_ {false};
+
+    std::atomic<uint64_t> frame_ {0};
+
+    Clock::time_point epoch_ {Clock::now()};
+
+    Profiler() = default;
+};
+
+class ProfileZone {
+public:
+    /**
+     * @brief Opens a zone on the calling thread.
+     *
+     * @param name Zone name with static storage duration.
+     */
+    explicit ProfileZone(const char* name) {
+        auto& profiler = Profiler::Get();
+        if (!profiler.IsEnabled()) return;
+
+        buffer_ = &profiler.ThreadBuffer();
+        name_ = name;
+        depth_ = buffer_->depth++;
+        start_ = profiler.Now();
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    auto operator=(const ProfileZone&) -> ProfileZone& = delete;
+
+    /**
+     * @brief Closes the zone and records it.
+     */
+    ~ProfileZone() {
+        if (buffer_ == nullptr) return;
+
+        buffer_->depth--;
+        buffer_->Push({
+            .name = name_,
+            .start = start_,
+            .end = Profiler::Get().Now(),
+            .depth = depth_,
+            .type = ProfileEventType::Zone
+        });
+    }
+
+private:
+    ProfileBuffer* buffer_ {nullptr};
+
+    const char* name_ {nullptr};
+
+    uint64_t start_ {0};
+
+    uint32_t depth_ {0};
+};
+
+}
\ No newline at end of file
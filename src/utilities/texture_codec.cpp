@@ -0,0 +1,703 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "utilities/texture_codec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace gleam {
+
+namespace {
+
+using Color = std::array<float, 4>;
+
+using Texels = std::array<Color, 16>;
+
+using Indices = std::array<uint8_t, 16>;
+
+constexpr auto kRefineIterations = 2;
+
+auto blocks_across(uint32_t size) { return (size + 3) / 4; }
+
+// Texels past the edge of the image repeat the last row and column.
+auto load_block(std::span<const uint8_t> rgba, uint32_t width, uint32_t height, uint32_t bx, uint32_t by) {
+    auto block = Texels {};
+    for (auto y = 0u; y < 4; ++y) {
+        const auto sy = std::min(by * 4 + y, height - 1);
+        for (auto x = 0u; x < 4; ++x) {
+            const auto sx = std::min(bx * 4 + x, width - 1);
+            const auto* texel = rgba.data() + (static_cast<std::size_t>(sy) * width + sx) * 4;
+            block[y * 4 + x] = {
+                static_cast<float>(texel[0]),
+                static_cast<float>(texel[1]),
+                static_cast<float>(texel[2]),
+                static_cast<float>(texel[3])
+            };
+        }
+    }
+    return block;
+}
+
+auto distance(const Color& a, const Color& b, int channels) {
+    auto sum = 0.0f;
+    for (auto c = 0; c < channels; ++c) {
+        const auto d = a[c] - b[c];
+        sum += d * d;
+    }
+    return sum;
+}
+
+auto bounding_box(const Texels& block, int channels) {
+    auto low = Color {255.0f, 255.0f, 255.0f, 255.0f};
+    auto high = Color {};
+    for (const auto& texel : block) {
+        for (auto c = 0; c < channels; ++c) {
+            low[c] = std::min(low[c], texel[c]);
+            high[c] = std::max(high[c], texel[c]);
+        }
+    }
+    return std::pair {low, high};
+}
+
+// Endpoints at the extremes of the block's projection onto its principal
+// axis, which power iteration finds from the covariance matrix.
+auto principal_endpoints(const Texels& block, int channels) {
+    auto mean = Color {};
+    for (const auto& texel : block) {
+        for (auto c = 0; c < channels; ++c) mean[c] += texel[c] / 16.0f;
+    }
+
+    auto covariance = std::array<std::array<float, 4>, 4> {};
+    for (const auto& texel : block) {
+        for (auto i = 0; i < channels; ++i) {
+            for (auto j = 0; j < channels; ++j) {
+                covariance[i][j] += (texel[i] - mean[i]) * (texel[j] - mean[j]);
+            }
+        }
+    }
+
+    auto axis = Color {};
+    for (auto c = 0; c < channels; ++c) axis[c] = 1.0f;
+    for (auto step = 0; step < 8; ++step) {
+        auto next = Color {};
+        for (auto i = 0; i < channels; ++i) {
+            for (auto j = 0; j < channels; ++j) next[i] += covariance[i][j] * axis[j];
+        }
+        const auto length = std::sqrt(distance(next, {}, channels));
+        if (length < 1e-6f) break;
+        for (auto c = 0; c < channels; ++c) axis[c] = next[c] / length;
+    }
+
+    auto low = std::numeric_limits<float>::max();
+    auto high = std::numeric_limits<float>::lowest();
+    for (const auto& texel : block) {
+        auto t = 0.0f;
+        for (auto c = 0; c < channels; ++c) t += (texel[c] - mean[c]) * axis[c];
+        low = std::min(low, t);
+        high = std::max(high, t);
+    }
+
+    auto start = mean;
+    auto end = mean;
+    for (auto c = 0; c < channels; ++c) {
+        start[c] = std::clamp(mean[c] + axis[c] * low, 0.0f, 255.0f);
+        end[c] = std::clamp(mean[c] + axis[c] * high, 0.0f, 255.0f);
+    }
+    return std::pair {start, end};
+}
+
+// Least squares endpoints for the current index assignment, where each texel
+// is approximated by `start + (end - start) * weights[index]`.
+template <std::size_t N>
+auto refine_endpoints(
+    const Texels& block,
+    const Indices& indices,
+    const std::array<float, N>& weights,
+    int channels,
+    Color& start,
+    Color& end
+) {
+    auto aa = 0.0f;
+    auto ab = 0.0f;
+    auto bb = 0.0f;
+    auto ax = Color {};
+    auto bx = Color {};
+    for (auto i = 0; i < 16; ++i) {
+        const auto w = weights[indices[i]];
+        const auto a = 1.0f - w;
+        aa += a * a;
+        ab += a * w;
+        bb += w * w;
+        for (auto c = 0; c < channels; ++c) {
+            ax[c] += a * block[i][c];
+            bx[c] += w * block[i][c];
+        }
+    }
+
+    const auto determinant = aa * bb - ab * ab;
+    if (std::abs(determinant) < 1e-6f) return false;
+    for (auto c = 0; c < channels; ++c) {
+        start[c] = std::clamp((bb * ax[c] - ab * bx[c]) / determinant, 0.0f, 255.0f);
+        end[c] = std::clamp((aa * bx[c] - ab * ax[c]) / determinant, 0.0f, 255.0f);
+    }
+    return true;
+}
+
+// Alternates between least squares endpoints and index assignment while the
+// error keeps dropping. `fit` quantizes a pair of endpoints and assigns
+// indices, returning the encoding with its indices and error.
+template <std::size_t N, class Fit>
+auto refine(
+    const Texels& block,
+    const std::array<float, N>& weights,
+    int channels,
+    Color start,
+    Color end,
+    const Fit& fit
+) {
+    auto best = fit(start, end);
+    for (auto i = 0; i < kRefineIterations && best.error > 0.0f; ++i) {
+        if (!refine_endpoints(block, best.indices, weights, channels, start, end)) break;
+        auto next = fit(start, end);
+        if (next.error >= best.error) break;
+        best = next;
+    }
+    return best;
+}
+
+template <std::size_t N>
+auto assign_indices(const Texels& block, const std::array<Color, N>& palette, int channels, Indices& indices) {
+    auto error = 0.0f;
+    for (auto i = 0; i < 16; ++i) {
+        auto best = std::numeric_limits<float>::max();
+        for (auto p = std::size_t {0}; p < N; ++p) {
+            const auto d = distance(block[i], palette[p], channels);
+            if (d < best) {
+                best = d;
+                indices[i] = static_cast<uint8_t>(p);
+            }
+        }
+        error += best;
+    }
+    return error;
+}
+
+auto write16(uint8_t* out, uint16_t value) {
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+auto read16(const uint8_t* in) -> uint16_t {
+    return static_cast<uint16_t>(in[0] | in[1] << 8);
+}
+
+#pragma region BC1
+
+auto to_565(const Color& color) -> uint16_t {
+    const auto r = static_cast<int>(std::lround(color[0] * 31.0f / 255.0f));
+    const auto g = static_cast<int>(std::lround(color[1] * 63.0f / 255.0f));
+    const auto b = static_cast<int>(std::lround(color[2] * 31.0f / 255.0f));
+    return static_cast<uint16_t>(r << 11 | g << 5 | b);
+}
+
+auto from_565(uint16_t value) {
+    const auto r = value >> 11 & 31;
+    const auto g = value >> 5 & 63;
+    const auto b = value & 31;
+    return std::array<int, 3> {r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2};
+}
+
+// Matches the integer interpolation of the decoder, so indices are chosen
+// against the colors the block actually decodes to.
+auto color_palette(uint16_t c0, uint16_t c1, bool four_colors) {
+    const auto a = from_565(c0);
+    const auto b = from_565(c1);
+    auto palette = std::array<std::array<int, 4>, 4> {};
+    for (auto c = 0; c < 3; ++c) {
+        palette[0][c] = a[c];
+        palette[1][c] = b[c];
+        if (four_colors) {
+            palette[2][c] = (2 * a[c] + b[c]) / 3;
+            palette[3][c] = (a[c] + 2 * b[c]) / 3;
+        } else {
+            palette[2][c] = (a[c] + b[c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+    palette[0][3] = palette[1][3] = palette[2][3] = 255;
+    palette[3][3] = four_colors ? 255 : 0;
+    return palette;
+}
+
+struct ColorFit {
+    uint16_t c0 {};
+    uint16_t c1 {};
+    Indices indices {};
+    float error {};
+};
+
+auto fit_color(const Texels& block, const Color& start, const Color& end) {
+    auto fit = ColorFit {to_565(start), to_565(end)};
+    const auto decoded = color_palette(fit.c0, fit.c1, true);
+    auto palette = std::array<Color, 4> {};
+    for (auto p = 0; p < 4; ++p) {
+        for (auto c = 0; c < 3; ++c) palette[p][c] = static_cast<float>(decoded[p][c]);
+    }
+    fit.error = assign_indices(block, palette, 3, fit.indices);
+    return fit;
+}
+
+auto pack_color_block(uint16_t c0, uint16_t c1, const Indices& indices, uint8_t* out) {
+    // Four-color mode requires c0 > c1. Swapping the endpoints exchanges
+    // indices 0 with 1 and 2 with 3.
+    auto bits = uint32_t {0};
+    const auto swap = c0 < c1;
+    for (auto i = 0; i < 16; ++i) {
+        const auto index = c0 == c1 ? 0u : (swap ? indices[i] ^ 1u : indices[i]);
+        bits |= index << (i * 2);
+    }
+    write16(out, swap ? c1 : c0);
+    write16(out + 2, swap ? c0 : c1);
+    for (auto i = 0; i < 4; ++i) out[4 + i] = static_cast<uint8_t>(bits >> (i * 8));
+}
+
+auto encode_color_block(const Texels& block, BlockQuality quality, uint8_t* out) {
+    // Palette order is c0, c1, 2/3 c0 + 1/3 c1, 1/3 c0 + 2/3 c1.
+    constexpr auto weights = std::array<float, 4> {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+    const auto [low, high] = quality == BlockQuality::Fast
+        ? bounding_box(block, 3)
+        : principal_endpoints(block, 3);
+    const auto fit = [&](const Color& start, const Color& end) { return fit_color(block, start, end); };
+    const auto best = quality == BlockQuality::Fast
+        ? fit(high, low)
+        : refine(block, weights, 3, high, low, fit);
+
+    pack_color_block(best.c0, best.c1, best.indices, out);
+}
+
+auto decode_color_block(const uint8_t* in, bool allow_three_colors, uint8_t* out, std::size_t stride) {
+    const auto c0 = read16(in);
+    const auto c1 = read16(in + 2);
+    const auto palette = color_palette(c0, c1, !allow_three_colors || c0 > c1);
+    for (auto i = 0; i < 16; ++i) {
+        const auto index = in[4 + i / 4] >> ((i % 4) * 2) & 3;
+        auto* texel = out + (i / 4) * stride + (i % 4) * 4;
+        for (auto c = 0; c < 4; ++c) texel[c] = static_cast<uint8_t>(palette[index][c]);
+    }
+}
+
+#pragma endregion
+
+#pragma region BC3 alpha
+
+auto alpha_palette(int a0, int a1) {
+    auto palette = std::array<int, 8> {a0, a1};
+    if (a0 > a1) {
+        for (auto i = 1; i < 7; ++i) palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+    } else {
+        for (auto i = 1; i < 5; ++i) palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+    return palette;
+}
+
+auto encode_alpha_block(const Texels& block, uint8_t* out) {
+    auto low = 255;
+    auto high = 0;
+    for (const auto& texel : block) {
+        low = std::min(low, static_cast<int>(texel[3]));
+        high = std::max(high, static_cast<int>(texel[3]));
+    }
+
+    // With a0 > a1 the block interpolates eight values between the extremes.
+    const auto palette = alpha_palette(high, low);
+    auto bits = uint64_t {0};
+    for (auto i = 0; i < 16; ++i) {
+        auto index = 0;
+        if (high != low) {
+            auto best = std::numeric_limits<int>::max();
+            for (auto p = 0; p < 8; ++p) {
+                const auto d = std::abs(palette[p] - static_cast<int>(block[i][3]));
+                if (d < best) {
+                    best = d;
+                    index = p;
+                }
+            }
+        }
+        bits |= static_cast<uint64_t>(index) << (i * 3);
+    }
+
+    out[0] = static_cast<uint8_t>(high);
+    out[1] = static_cast<uint8_t>(low);
+    for (auto i = 0; i < 6; ++i) out[2 + i] = static_cast<uint8_t>(bits >> (i * 8));
+}
+
+auto decode_alpha_block(const uint8_t* in, uint8_t* out, std::size_t stride) {
+    const auto palette = alpha_palette(in[0], in[1]);
+    auto bits = uint64_t {0};
+    for (auto i = 0; i < 6; ++i) bits |= static_cast<uint64_t>(in[2 + i]) << (i * 8);
+    for (auto i = 0; i < 16; ++i) {
+        out[(i / 4) * stride + (i % 4) * 4 + 3] = static_cast<uint8_t>(palette[bits >> (i * 3) & 7]);
+    }
+}
+
+#pragma endregion
+
+#pragma region BC7
+
+// Blocks are encoded with a single subset in one of two modes. Mode 6 stores
+// RGBA endpoints with 7 bits per channel and a shared low bit per endpoint,
+// followed by 4-bit indices. Mode 5 stores RGB endpoints with 7 bits and alpha
+// endpoints with 8 bits, each with their own 2-bit indices, which suits
+// blocks whose alpha doesn't follow their color. The first index of each set
+// is an anchor stored without its high bit, so it must select the first half
+// of the palette.
+//
+// Interpolation weights are out of 64.
+constexpr auto kWeights2 = std::array<int, 4> {0, 21, 43, 64};
+
+constexpr auto kWeights4 = std::array<int, 16> {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+template <std::size_t N>
+constexpr auto normalized(const std::array<int, N>& weights) {
+    auto result = std::array<float, N> {};
+    for (auto i = std::size_t {0}; i < N; ++i) result[i] = static_cast<float>(weights[i]) / 64.0f;
+    return result;
+}
+
+class BitWriter {
+public:
+    explicit BitWriter(uint8_t* out) : out_(out) { std::fill_n(out_, 16, 0); }
+
+    auto Write(uint32_t value, int count) {
+        for (auto i = 0; i < count; ++i, ++position_) {
+            if (value >> i & 1) out_[position_ / 8] |= static_cast<uint8_t>(1 << (position_ % 8));
+        }
+    }
+
+private:
+    uint8_t* out_;
+
+    int position_ {0};
+};
+
+class BitReader {
+public:
+    explicit BitReader(const uint8_t* in) : in_(in) {}
+
+    auto Read(int count) {
+        auto value = 0u;
+        for (auto i = 0; i < count; ++i, ++position_) {
+            value |= static_cast<unsigned>(in_[position_ / 8] >> (position_ % 8) & 1) << i;
+        }
+        return value;
+    }
+
+private:
+    const uint8_t* in_;
+
+    int position_ {0};
+};
+
+auto interpolate(int a, int b, int weight) {
+    return ((64 - weight) * a + weight * b + 32) >> 6;
+}
+
+auto quantize(float value, int levels) {
+    return std::clamp(static_cast<int>(std::lround(value * static_cast<float>(levels) / 255.0f)), 0, levels);
+}
+
+auto expand7(int value) { return value << 1 | value >> 6; }
+
+struct Mode6Fit {
+    std::array<std::array<int, 4>, 2> endpoints {};
+    std::array<int, 2> pbits {};
+    Indices indices {};
+    float error {std::numeric_limits<float>::max()};
+};
+
+auto mode6_palette(const Mode6Fit& fit) {
+    auto palette = std::array<Color, 16> {};
+    for (auto i = 0; i < 16; ++i) {
+        for (auto c = 0; c < 4; ++c) {
+            const auto a = fit.endpoints[0][c] << 1 | fit.pbits[0];
+            const auto b = fit.endpoints[1][c] << 1 | fit.pbits[1];
+            palette[i][c] = static_cast<float>(interpolate(a, b, kWeights4[i]));
+        }
+    }
+    return palette;
+}
+
+// Tries every combination of shared low bits and keeps the one with the
+// least error.
+auto fit_mode6(const Texels& block, const Color& start, const Color& end) {
+    auto best = Mode6Fit {};
+    for (auto p = 0; p < 4; ++p) {
+        auto fit = Mode6Fit {};
+        fit.pbits = {p & 1, p >> 1};
+        for (auto c = 0; c < 4; ++c) {
+            fit.endpoints[0][c] = std::clamp(static_cast<int>(std::lround((start[c] - static_cast<float>(fit.pbits[0])) / 2.0f)), 0, 127);
+            fit.endpoints[1][c] = std::clamp(static_cast<int>(std::lround((end[c] - static_cast<float>(fit.pbits[1])) / 2.0f)), 0, 127);
+        }
+        fit.error = assign_indices(block, mode6_palette(fit), 4, fit.indices);
+        if (fit.error < best.error) best = fit;
+    }
+    return best;
+}
+
+struct Mode5Fit {
+    std::array<std::array<int, 3>, 2> endpoints {};
+    Indices indices {};
+    float error {};
+};
+
+auto fit_mode5_color(const Texels& block, const Color& start, const Color& end) {
+    auto fit = Mode5Fit {};
+    auto palette = std::array<Color, 4> {};
+    for (auto c = 0; c < 3; ++c) {
+        fit.endpoints[0][c] = quantize(start[c], 127);
+        fit.endpoints[1][c] = quantize(end[c], 127);
+        for (auto i = 0; i < 4; ++i) {
+            palette[i][c] = static_cast<float>(interpolate(expand7(fit.endpoints[0][c]), expand7(fit.endpoints[1][c]), kWeights2[i]));
+        }
+    }
+    fit.error = assign_indices(block, palette, 3, fit.indices);
+    return fit;
+}
+
+// Alpha is fitted on its own, stored in the first channel of `alpha`.
+auto fit_mode5_alpha(const Texels& alpha, const Color& start, const Color& end) {
+    auto fit = Mode5Fit {};
+    auto palette = std::array<Color, 4> {};
+    fit.endpoints[0][0] = quantize(start[0], 255);
+    fit.endpoints[1][0] = quantize(end[0], 255);
+    for (auto i = 0; i < 4; ++i) {
+        palette[i][0] = static_cast<float>(interpolate(fit.endpoints[0][0], fit.endpoints[1][0], kWeights2[i]));
+    }
+    fit.error = assign_indices(alpha, palette, 1, fit.indices);
+    return fit;
+}
+
+template <class Fit>
+auto fix_anchor(Fit& fit, uint8_t high_bit) {
+    if ((fit.indices[0] & high_bit) == 0) return;
+    std::swap(fit.endpoints[0], fit.endpoints[1]);
+    if constexpr (requires { fit.pbits; }) std::swap(fit.pbits[0], fit.pbits[1]);
+    for (auto& index : fit.indices) index = static_cast<uint8_t>(high_bit * 2 - 1 - index);
+}
+
+auto write_mode6(Mode6Fit fit, uint8_t* out) {
+    fix_anchor(fit, 8);
+    auto writer = BitWriter {out};
+    writer.Write(1u << 6, 7);
+    for (auto c = 0; c < 4; ++c) {
+        writer.Write(static_cast<uint32_t>(fit.endpoints[0][c]), 7);
+        writer.Write(static_cast<uint32_t>(fit.endpoints[1][c]), 7);
+    }
+    writer.Write(static_cast<uint32_t>(fit.pbits[0]), 1);
+    writer.Write(static_cast<uint32_t>(fit.pbits[1]), 1);
+    writer.Write(fit.indices[0], 3);
+    for (auto i = 1; i < 16; ++i) writer.Write(fit.indices[i], 4);
+}
+
+auto write_mode5(Mode5Fit color, Mode5Fit alpha, uint8_t* out) {
+    fix_anchor(color, 2);
+    fix_anchor(alpha, 2);
+    auto writer = BitWriter {out};
+    writer.Write(1u << 5, 6);
+    writer.Write(0, 2); // No channel rotation.
+    for (auto c = 0; c < 3; ++c) {
+        writer.Write(static_cast<uint32_t>(color.endpoints[0][c]), 7);
+        writer.Write(static_cast<uint32_t>(color.endpoints[1][c]), 7);
+    }
+    writer.Write(static_cast<uint32_t>(alpha.endpoints[0][0]), 8);
+    writer.Write(static_cast<uint32_t>(alpha.endpoints[1][0]), 8);
+    for (const auto* fit : {&color, &alpha}) {
+        writer.Write(fit->indices[0], 1);
+        for (auto i = 1; i < 16; ++i) writer.Write(fit->indices[i], 2);
+    }
+}
+
+auto encode_bc7_block(const Texels& block, BlockQuality quality, uint8_t* out) {
+    constexpr auto weights4 = normalized(kWeights4);
+    constexpr auto weights2 = normalized(kWeights2);
+    const auto fast = quality == BlockQuality::Fast;
+
+    const auto [low, high] = fast ? bounding_box(block, 4) : principal_endpoints(block, 4);
+    const auto mode6 = [&](const Color& start, const Color& end) { return fit_mode6(block, start, end); };
+    const auto rgba = fast ? mode6(low, high) : refine(block, weights4, 4, low, high, mode6);
+
+    const auto [color_low, color_high] = fast ? bounding_box(block, 3) : principal_endpoints(block, 3);
+    const auto mode5 = [&](const Color& start, const Color& end) { return fit_mode5_color(block, start, end); };
+    const auto color = fast ? mode5(color_low, color_high) : refine(block, weights2, 3, color_low, color_high, mode5);
+
+    auto alpha_texels = Texels {};
+    for (auto i = 0; i < 16; ++i) alpha_texels[i][0] = block[i][3];
+    const auto [alpha_low, alpha_high] = bounding_box(alpha_texels, 1);
+    const auto mode5_alpha = [&](const Color& start, const Color& end) { return fit_mode5_alpha(alpha_texels, start, end); };
+    const auto alpha = fast
+        ? mode5_alpha(alpha_low, alpha_high)
+        : refine(alpha_texels, weights2, 1, alpha_low, alpha_high, mode5_alpha);
+
+    if (rgba.error <= color.error + alpha.error) {
+        write_mode6(rgba, out);
+    } else {
+        write_mode5(color, alpha, out);
+    }
+}
+
+auto decode_mode6(BitReader& reader, uint8_t* out, std::size_t stride) {
+    auto fit = Mode6Fit {};
+    for (auto c = 0; c < 4; ++c) {
+        fit.endpoints[0][c] = static_cast<int>(reader.Read(7));
+        fit.endpoints[1][c] = static_cast<int>(reader.Read(7));
+    }
+    fit.pbits[0] = static_cast<int>(reader.Read(1));
+    fit.pbits[1] = static_cast<int>(reader.Read(1));
+
+    const auto palette = mode6_palette(fit);
+    for (auto i = 0; i < 16; ++i) {
+        const auto index = reader.Read(i == 0 ? 3 : 4);
+        auto* texel = out + (i / 4) * stride + (i % 4) * 4;
+        for (auto c = 0; c < 4; ++c) texel[c] = static_cast<uint8_t>(palette[index][c]);
+    }
+}
+
+auto decode_mode5(BitReader& reader, uint8_t* out, std::size_t stride) {
+    const auto rotation = reader.Read(2);
+    auto endpoints = std::array<std::array<int, 4>, 2> {};
+    for (auto c = 0; c < 3; ++c) {
+        endpoints[0][c] = expand7(static_cast<int>(reader.Read(7)));
+        endpoints[1][c] = expand7(static_cast<int>(reader.Read(7)));
+    }
+    endpoints[0][3] = static_cast<int>(reader.Read(8));
+    endpoints[1][3] = static_cast<int>(reader.Read(8));
+
+    for (auto pass = 0; pass < 2; ++pass) {
+        for (auto i = 0; i < 16; ++i) {
+            const auto weight = kWeights2[reader.Read(i == 0 ? 1 : 2)];
+            auto* texel = out + (i / 4) * stride + (i % 4) * 4;
+            if (pass == 0) {
+                for (auto c = 0; c < 3; ++c) {
+                    texel[c] = static_cast<uint8_t>(interpolate(endpoints[0][c], endpoints[1][c], weight));
+                }
+            } else {
+                texel[3] = static_cast<uint8_t>(interpolate(endpoints[0][3], endpoints[1][3], weight));
+            }
+        }
+    }
+
+    // Rotation swaps alpha with one of the color channels.
+    if (rotation == 0) return;
+    for (auto i = 0; i < 16; ++i) {
+        auto* texel = out + (i / 4) * stride + (i % 4) * 4;
+        std::swap(texel[3], texel[rotation - 1]);
+    }
+}
+
+auto decode_bc7_block(const uint8_t* in, uint8_t* out, std::size_t stride) {
+    auto reader = BitReader {in};
+    auto mode = 0;
+    while (mode < 8 && reader.Read(1) == 0) ++mode;
+
+    if (mode == 6) {
+        decode_mode6(reader, out, stride);
+    } else if (mode == 5) {
+        decode_mode5(reader, out, stride);
+    } else {
+        for (auto y = 0; y < 4; ++y) std::fill_n(out + y * stride, 16, uint8_t {0});
+    }
+}
+
+#pragma endregion
+
+} // unnamed namespace
+
+auto block_size(BlockFormat format) -> std::size_t {
+    return format == BlockFormat::BC1 ? 8 : 16;
+}
+
+auto encode_blocks(
+    std::span<const uint8_t> rgba,
+    uint32_t width,
+    uint32_t height,
+    BlockFormat format,
+    BlockQuality quality
+) -> std::vector<uint8_t> {
+    if (width == 0 || height == 0 || rgba.size() < static_cast<std::size_t>(width) * height * 4) return {};
+
+    const auto size = block_size(format);
+    auto output = std::vector<uint8_t>(static_cast<std::size_t>(blocks_across(width)) * blocks_across(height) * size);
+    auto* out = output.data();
+    for (auto by = 0u; by < blocks_across(height); ++by) {
+        for (auto bx = 0u; bx < blocks_across(width); ++bx, out += size) {
+            const auto block = load_block(rgba, width, height, bx, by);
+            switch (format) {
+                case BlockFormat::BC1:
+                    encode_color_block(block, quality, out);
+                    break;
+                case BlockFormat::BC3:
+                    encode_alpha_block(block, out);
+                    encode_color_block(block, quality, out + 8);
+                    break;
+                case BlockFormat::BC7:
+                    encode_bc7_block(block, quality, out);
+                    break;
+            }
+        }
+    }
+    return output;
+}
+
+auto decode_blocks(
+    std::span<const uint8_t> blocks,
+    uint32_t width,
+    uint32_t height,
+    BlockFormat format
+) -> std::vector<uint8_t> {
+    const auto size = block_size(format);
+    const auto across = blocks_across(width);
+    const auto down = blocks_across(height);
+    if (width == 0 || height == 0 || blocks.size() < static_cast<std::size_t>(across) * down * size) return {};
+
+    // Blocks decode into a scratch area so partial blocks at the edges don't
+    // need bounds checks per texel.
+    auto scratch = std::array<uint8_t, 64> {};
+    auto output = std::vector<uint8_t>(static_cast<std::size_t>(width) * height * 4);
+    const auto* in = blocks.data();
+    for (auto by = 0u; by < down; ++by) {
+        for (auto bx = 0u; bx < across; ++bx, in += size) {
+            switch (format) {
+                case BlockFormat::BC1:
+                    decode_color_block(in, true, scratch.data(), 16);
+                    break;
+                case BlockFormat::BC3:
+                    decode_color_block(in + 8, false, scratch.data(), 16);
+                    decode_alpha_block(in, scratch.data(), 16);
+                    break;
+                case BlockFormat::BC7:
+                    decode_bc7_block(in, scratch.data(), 16);
+                    break;
+            }
+
+            const auto columns = std::min(4u, width - bx * 4);
+            const auto rows = std::min(4u, height - by * 4);
+            for (auto y = 0u; y < rows; ++y) {
+                const auto offset = ((static_cast<std::size_t>(by) * 4 + y) * width + bx * 4) * 4;
+                std::copy_n(scratch.data() + y * 16, columns * 4, output.data() + offset);
+            }
+        }
+    }
+    return output;
+}
+
+}
\ No newline at end of file
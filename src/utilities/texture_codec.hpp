@@ -0,0 +1,84 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace gleam {
+
+/**
+ * @brief Block-compressed texture formats. Every format encodes 4x4 texel
+ * blocks at a fixed size.
+ */
+enum class BlockFormat {
+    BC1, ///< 8-byte blocks, opaque RGB.
+    BC3, ///< 16-byte blocks, BC1 color with a separately encoded alpha channel.
+    BC7  ///< 16-byte blocks, RGBA with higher color precision.
+};
+
+/**
+ * @brief Trade-off between encoding speed and quality.
+ */
+enum class BlockQuality {
+    Fast, ///< Endpoints from the bounding box of each block.
+    High  ///< Endpoints along the principal axis of each block, refined by least squares.
+};
+
+/**
+ * @brief Returns the size of a single block.
+ *
+ * @param format Block format.
+ * @return std::size_t Size in bytes.
+ */
+[[nodiscard]] auto block_size(BlockFormat format) -> std::size_t;
+
+/**
+ * @brief Compresses RGBA8 texels into blocks.
+ *
+ * Images whose dimensions aren't multiples of 4 are padded by repeating the
+ * last row and column. BC7 blocks are encoded in mode 6, or in mode 5 when
+ * their alpha varies independently of their color.
+ *
+ * @param rgba Texels, 4 bytes each, row by row.
+ * @param width Width in texels.
+ * @param height Height in texels.
+ * @param format Block format to encode.
+ * @param quality Trade-off between speed and quality.
+ * @return std::vector<uint8_t> Blocks, row by row.
+ */
+[[nodiscard]] auto encode_blocks(
+    std::span<const uint8_t> rgba,
+    uint32_t width,
+    uint32_t height,
+    BlockFormat format,
+    BlockQuality quality
+) -> std::vector<uint8_t>;
+
+/**
+ * @brief Decompresses blocks into RGBA8 texels.
+ *
+ * Used when the graphics driver can't sample a block format. BC7 blocks in
+ * modes other than 5 and 6 decode as transparent black.
+ *
+ * @param blocks Blocks, row by row.
+ * @param width Width in texels.
+ * @param height Height in texels.
+ * @param format Block format.
+ * @return std::vector<uint8_t> Texels, or an empty vector if there aren't enough blocks.
+ */
+[[nodiscard]] auto decode_blocks(
+    std::span<const uint8_t> blocks,
+    uint32_t width,
+    uint32_t height,
+    BlockFormat format
+) -> std::vector<uint8_t>;
+
+}
\ No newline at end of file
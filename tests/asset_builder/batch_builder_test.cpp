@@ -0,0 +1,252 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "batch_builder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#pragma region Helpers
+
+auto WriteFile(const fs::path& path, const std::string& content = "") {
+    fs::create_directories(path.parent_path());
+    auto file = std::ofstream {path, std::ios::binary};
+    file << content;
+}
+
+auto AcceptAssets(const fs::path& path) {
+    return path.extension() == ".png" || path.extension() == ".obj";
+}
+
+class BatchBuilderTest : public ::testing::Test {
+protected:
+    fs::path directory;
+
+    auto SetUp() -> void override {
+        const auto name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        directory = fs::temp_directory_path() / (std::string {"gleam_batch_builder_"} + name);
+        fs::remove_all(directory);
+
+        WriteFile(directory / "a.png");
+        WriteFile(directory / "notes.txt");
+        WriteFile(directory / "sub" / "b.png");
+        WriteFile(directory / "sub" / "c.obj");
+        WriteFile(directory / "sub" / "deep" / "d.png");
+    }
+
+    auto TearDown() -> void override {
+        fs::remove_all(directory);
+    }
+
+    auto Collect(const std::string& input, const fs::path& output_dir = {}) {
+        auto jobs = collect_jobs(input, output_dir, AcceptAssets);
+        EXPECT_TRUE(jobs);
+        auto relative = std::vector<std::string> {};
+        for (const auto& job : jobs.value_or(std::vector<BatchJob> {})) {
+            relative.emplace_back(job.input.lexically_relative(directory).generic_string());
+        }
+        return relative;
+    }
+};
+
+#pragma endregion
+
+#pragma region Glob Match
+
+TEST(BatchBuilder, GlobMatchesStarWithinSegment) {
+    EXPECT_TRUE(glob_match("*.png", "a.png"));
+    EXPECT_TRUE(glob_match("*.png", ".png"));
+    EXPECT_TRUE(glob_match("sub/*.png", "sub/b.png"));
+    EXPECT_FALSE(glob_match("*.png", "sub/b.png"));
+    EXPECT_FALSE(glob_match("*.png", "a.jpg"));
+    EXPECT_FALSE(glob_match("*.png", "a.png.bak"));
+}
+
+TEST(BatchBuilder, GlobMatchesQuestionMarkAsOneCharacter) {
+    EXPECT_TRUE(glob_match("a?.png", "ab.png"));
+    EXPECT_FALSE(glob_match("a?.png", "a.png"));
+    EXPECT_FALSE(glob_match("a?.png", "abc.png"));
+    EXPECT_FALSE(glob_match("a?b.png", "a/b.png"));
+}
+
+TEST(BatchBuilder, GlobMatchesDoubleStarAcrossSegments) {
+    EXPECT_TRUE(glob_match("**/*.png", "a.png"));
+    EXPECT_TRUE(glob_match("**/*.png", "sub/deep/d.png"));
+    EXPECT_TRUE(glob_match("sub/**/d.png", "sub/d.png"));
+    EXPECT_TRUE(glob_match("sub/**/d.png", "sub/deep/d.png"));
+    EXPECT_TRUE(glob_match("**", "sub/deep/d.png"));
+    EXPECT_FALSE(glob_match("sub/**/d.png", "other/deep/d.png"));
+    EXPECT_FALSE(glob_match("**/*.png", "sub/c.obj"));
+}
+
+TEST(BatchBuilder, GlobMatchesEmptyAndTrailingSeparators) {
+    EXPECT_TRUE(glob_match("", ""));
+    EXPECT_TRUE(glob_match("**/", ""));
+    EXPECT_TRUE(glob_match("sub/", "sub/"));
+    EXPECT_TRUE(glob_match("sub/*", "sub/"));
+    EXPECT_FALSE(glob_match("", "a.png"));
+    EXPECT_FALSE(glob_match("*.png", ""));
+    EXPECT_FALSE(glob_match("sub/*", "sub"));
+    EXPECT_FALSE(glob_match("*", "sub/"));
+}
+
+#pragma endregion
+
+#pragma region Collect Jobs
+
+TEST_F(BatchBuilderTest, CollectsDirectoriesRecursively) {
+    EXPECT_EQ(Collect(directory.string()), (std::vector<std::string> {
+        "a.png", "sub/b.png", "sub/c.obj", "sub/deep/d.png"
+    }));
+}
+
+TEST_F(BatchBuilderTest, CollectsPatternMatches) {
+    EXPECT_EQ(Collect((directory / "*.png").string()), (std::vector<std::string> {"a.png"}));
+    EXPECT_EQ(Collect((directory / "sub" / "?.obj").string()), (std::vector<std::string> {"sub/c.obj"}));
+    EXPECT_EQ(Collect((directory / "**" / "*.png").string()), (std::vector<std::string> {
+        "a.png", "sub/b.png", "sub/deep/d.png"
+    }));
+    EXPECT_TRUE(Collect((directory / "*.jpg").string()).empty());
+}
+
+TEST_F(BatchBuilderTest, CollectsOutputsUnderOutputDirectory) {
+    const auto output_dir = directory / "out";
+    const auto jobs = collect_jobs((directory / "sub").string(), output_dir, AcceptAssets);
+    ASSERT_TRUE(jobs);
+    ASSERT_EQ(jobs->size(), 3);
+    EXPECT_EQ(jobs->at(0).output, output_dir / "b.png");
+    EXPECT_EQ(jobs->at(2).output, output_dir / "deep" / "d.png");
+
+    const auto next_to_inputs = collect_jobs((directory / "a.png").string(), {}, AcceptAssets);
+    ASSERT_TRUE(next_to_inputs);
+    ASSERT_EQ(next_to_inputs->size(), 1);
+    EXPECT_EQ(next_to_inputs->at(0).output, directory / "a.png");
+}
+
+TEST_F(BatchBuilderTest, ReportsMissingInputs) {
+    EXPECT_FALSE(collect_jobs((directory / "missing").string(), {}, AcceptAssets));
+    EXPECT_FALSE(collect_jobs((directory / "missing" / "*.png").string(), {}, AcceptAssets));
+}
+
+TEST_F(BatchBuilderTest, RemovesDuplicatesOfOverlappingPatterns) {
+    auto jobs = std::vector<BatchJob> {};
+    for (const auto& input : {
+        (directory / "**" / "*.png").string(),
+        (directory / "sub" / "*.png").string(),
+        (directory / "sub" / "." / "b.png").string(),
+        directory.string()
+    }) {
+        auto collected = collect_jobs(input, {}, AcceptAssets);
+        ASSERT_TRUE(collected);
+        jobs.insert(jobs.end(), collected->begin(), collected->end());
+    }
+
+    remove_duplicate_jobs(jobs);
+    auto inputs = std::vector<std::string> {};
+    for (const auto& job : jobs) inputs.emplace_back(job.input.lexically_relative(directory).generic_string());
+    EXPECT_EQ(inputs, (std::vector<std::string> {"a.png", "sub/b.png", "sub/deep/d.png", "sub/c.obj"}));
+}
+
+#pragma endregion
+
+#pragma region Manifest
+
+TEST_F(BatchBuilderTest, ReadsManifestEntries) {
+    const auto manifest = directory / "assets.manifest";
+    WriteFile(manifest,
+        "# Textures\n"
+        "\n"
+        "a.png\n"
+        "   \n"
+        "\"sub/b.png\" \"out/with space.png\"\n"
+        "sub/c.obj out/c.obj # converted separately\n"
+        "sub/deep/d.png # no output\n"
+    );
+
+    const auto jobs = read_manifest(manifest);
+    ASSERT_TRUE(jobs);
+    ASSERT_EQ(jobs->size(), 4);
+    EXPECT_EQ(jobs->at(0).input, directory / "a.png");
+    EXPECT_EQ(jobs->at(0).output, directory / "a.png");
+    EXPECT_EQ(jobs->at(1).output, directory / "out/with space.png");
+    EXPECT_EQ(jobs->at(2).output, directory / "out/c.obj");
+    EXPECT_EQ(jobs->at(3).output, directory / "sub/deep/d.png");
+}
+
+TEST_F(BatchBuilderTest, ReportsMalformedManifestLines) {
+    const auto manifest = directory / "assets.manifest";
+    WriteFile(manifest, "# Textures\na.png\na.png b.png c.png\n");
+
+    const auto jobs = read_manifest(manifest);
+    ASSERT_FALSE(jobs);
+    EXPECT_EQ(jobs.error(), "Invalid manifest entry on line 3: a.png b.png c.png");
+    EXPECT_FALSE(read_manifest(directory / "missing.manifest"));
+}
+
+#pragma endregion
+
+#pragma region Run Batch
+
+TEST(BatchBuilder, ClampsWorkerCount) {
+    const auto cores = std::max(std::thread::hardware_concurrency(), 1u);
+    EXPECT_EQ(batch_worker_count(0, 1000), std::min(cores, 1000u));
+    EXPECT_EQ(batch_worker_count(0, 1), 1);
+    EXPECT_EQ(batch_worker_count(1, 8), 1);
+    EXPECT_EQ(batch_worker_count(4, 8), 4);
+    EXPECT_EQ(batch_worker_count(64, 3), 3);
+    EXPECT_EQ(batch_worker_count(4, 0), 1);
+}
+
+TEST(BatchBuilder, RunsEveryJobOnceInOrder) {
+    auto jobs = std::vector<BatchJob> {};
+    for (auto i = 0; i < 8; ++i) {
+        jobs.push_back({std::to_string(i) + ".png", std::to_string(i) + ".tex"});
+    }
+
+    for (auto workers : {0u, 1u, 64u}) {
+        SCOPED_TRACE(workers);
+        auto mutex = std::mutex {};
+        auto threads = std::set<std::thread::id> {};
+        auto converted = std::vector<std::atomic<int>>(jobs.size());
+        const auto results = run_batch(jobs, workers, [&](const BatchJob& job) -> std::expected<void, std::string> {
+            ++converted[std::stoul(job.input.stem().string())];
+            const auto lock = std::scoped_lock(mutex);
+            threads.insert(std::this_thread::get_id());
+            if (job.input == "3.png") return std::unexpected("failed");
+            return {};
+        });
+
+        ASSERT_EQ(results.size(), jobs.size());
+        for (auto i = std::size_t {0}; i < jobs.size(); ++i) {
+            EXPECT_EQ(converted[i], 1);
+            EXPECT_EQ(results[i].job.input, jobs[i].input);
+            EXPECT_EQ(results[i].result.has_value(), i != 3);
+        }
+        EXPECT_LE(threads.size(), batch_worker_count(workers, jobs.size()));
+        if (workers == 1) EXPECT_EQ(threads, (std::set {std::this_thread::get_id()}));
+    }
+}
+
+TEST(BatchBuilder, RunsEmptyBatches) {
+    const auto results = run_batch({}, 4, [](const BatchJob&) -> std::expected<void, std::string> {
+        return {};
+    });
+    EXPECT_TRUE(results.empty());
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,137 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "build_cache.hpp"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#pragma region Helpers
+
+auto WriteFile(const fs::path& path, const std::string& content) {
+    auto file = std::ofstream {path, std::ios::binary};
+    file << content;
+}
+
+class BuildCacheTest : public ::testing::Test {
+protected:
+    fs::path directory;
+    fs::path input;
+    fs::path source;
+    fs::path output;
+    std::size_t builds {0};
+
+    auto SetUp() -> void override {
+        const auto name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        directory = fs::temp_directory_path() / (std::string {"gleam_build_cache_"} + name);
+        fs::remove_all(directory);
+        fs::create_directories(directory);
+
+        input = directory / "input.obj";
+        source = directory / "input.mtl";
+        output = directory / "output.msh";
+        WriteFile(input, "v 0 0 0");
+        WriteFile(source, "newmtl red");
+        BuildCache::Get().Open(directory / ".asset_cache", false);
+    }
+
+    auto TearDown() -> void override {
+        fs::remove_all(directory);
+    }
+
+    // Converts the input, reporting the source as a dependency.
+    auto Build(const std::string& options = "v1") {
+        const auto result = BuildCache::Get().Build(input, output, options, [this](auto& dependencies) {
+            ++builds;
+            WriteFile(output, "converted");
+            dependencies.sources.push_back(source);
+            return std::expected<void, std::string> {};
+        });
+        EXPECT_TRUE(result);
+    }
+};
+
+#pragma endregion
+
+#pragma region Build
+
+TEST_F(BuildCacheTest, SkipsUnchangedInputs) {
+    Build();
+    const auto skipped = BuildCache::Get().SkippedCount();
+    Build();
+
+    EXPECT_EQ(builds, 1);
+    EXPECT_EQ(BuildCache::Get().SkippedCount(), skipped + 1);
+}
+
+TEST_F(BuildCacheTest, SkipsUnchangedInputsAfterReopening) {
+    Build();
+    ASSERT_TRUE(BuildCache::Get().Save());
+    BuildCache::Get().Open(directory / ".asset_cache", false);
+    Build();
+
+    EXPECT_EQ(builds, 1);
+}
+
+TEST_F(BuildCacheTest, RebuildsWhenInputChanges) {
+    Build();
+    WriteFile(input, "v 1 1 1 1");
+    Build();
+
+    EXPECT_EQ(builds, 2);
+}
+
+TEST_F(BuildCacheTest, RebuildsWhenDependencyChanges) {
+    Build();
+    WriteFile(source, "newmtl green");
+    Build();
+
+    EXPECT_EQ(builds, 2);
+}
+
+TEST_F(BuildCacheTest, RebuildsWhenOptionsChange) {
+    Build("v1");
+    Build("v2");
+
+    EXPECT_EQ(builds, 2);
+}
+
+TEST_F(BuildCacheTest, RebuildsWhenOutputIsDeleted) {
+    Build();
+    fs::remove(output);
+    Build();
+
+    EXPECT_EQ(builds, 2);
+    EXPECT_TRUE(fs::exists(output));
+}
+
+TEST_F(BuildCacheTest, RebuildsWhenInputChangesDuringConversion) {
+    static_cast<void>(BuildCache::Get().Build(input, output, "v1", [this](auto&) {
+        ++builds;
+        WriteFile(output, "converted");
+        WriteFile(input, "v 1 1 1 1");
+        return std::expected<void, std::string> {};
+    }));
+    Build();
+
+    EXPECT_EQ(builds, 2);
+}
+
+TEST_F(BuildCacheTest, RebuildsEverythingWhenForced) {
+    Build();
+    BuildCache::Get().Open(directory / ".asset_cache", true);
+    Build();
+
+    EXPECT_EQ(builds, 2);
+}
+
+#pragma endregion
\ No newline at end of file
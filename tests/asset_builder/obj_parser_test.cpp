@@ -0,0 +1,232 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "obj_parser.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#pragma region Helpers
+
+const auto materials_library = std::string {
+    "newmtl red\nKd 1 0 0\n"
+    "newmtl green\nKd 0 1 0\n"
+    "newmtl blue\nKd 0 0 1\n"
+};
+
+const auto quads = std::string {
+    "mtllib scene.mtl\n"
+    "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+    "v 0 0 1\nv 1 0 1\nv 1 1 1\nv 0 1 1\n"
+    "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+    "vn 0 0 -1\nvn 0 0 1\n"
+    "usemtl red\n"
+    "f 1/1/1 2/2/1 3/3/1 4/4/1\n"
+    "f 5/1/2 6/2/2 7/3/2 8/4/2\n"
+    "f 1//1 5//2 8//2 4//1\n"
+    "f 2/2 6/3 7/4 3/1\n"
+    "f 1 2 6 5\n"
+};
+
+const auto polygons = std::string {
+    "v 0 0 0\nv 2 0 0\nv 3 1 0\nv 2 2 0\nv 0 2 0\nv 1 1 0\n"
+    "v 0 0 1\nv 1 0 1\nv 2 0.5 1\nv 2 1.5 1\nv 1 2 1\nv 0 2 1\nv -1 1 1\n"
+    "vn 0 0 1\n"
+    "f 1//1 2//1 3//1 4//1 5//1\n"
+    "f 1 2 3 4 6\n"
+    "f 7 8 9 10 11 12 13\n"
+    "f 1 2 3\n"
+};
+
+const auto relative_indices = std::string {
+    "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+    "vt 0 0\nvt 1 0\nvt 1 1\n"
+    "vn 0 0 1\n"
+    "f -4/-3/-1 -3/-2/-1 -2/-1/-1\n"
+    "v 2 0 0\nv 2 1 0\n"
+    "f -4 -2 -1 -3\n"
+    "f 1/0 2/0 3/0\n"
+    "f 2//0 3//0 4//0\n"
+};
+
+const auto groups = std::string {
+    "mtllib scene.mtl\n"
+    "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+    "o first\n"
+    "usemtl green\n"
+    "f 1 2 3\n"
+    "usemtl blue\n"
+    "f 1 3 4\n"
+    "g second\n"
+    "f 1 2 4\n"
+    "usemtl missing\n"
+    "f 2 3 4\n"
+    "g\n"
+    "usemtl red\n"
+    "f 1 2 3 4\n"
+    "o\n"
+    "g third fourth\n"
+    "f 4 3 2\n"
+    "l 1 2 3\n"
+    "p 4\n"
+    "usemtl green\n"
+};
+
+// Rows of quads with groups and materials changing along the way, large
+// enough to be split into many chunks.
+auto MakeGrid(int rows, int columns) {
+    constexpr const char* materials[] = {"red", "green", "blue"};
+    auto obj = std::string {"mtllib scene.mtl\n"};
+    for (auto y = 0; y <= rows; ++y) {
+        for (auto x = 0; x <= columns; ++x) {
+            obj += std::format("v {} {:.3f} {}e-1\n", x, y * 0.37f, x * y);
+            obj += std::format("vt {:.4f} {:.4f}\n", x / float(columns), y / float(rows));
+        }
+    }
+    obj += "vn 0 0 1\n";
+
+    for (auto y = 0; y < rows; ++y) {
+        if (y % 3 == 0) obj += std::format("g row{}\n", y);
+        obj += std::format("usemtl {}\n", materials[y % 3]);
+        for (auto x = 0; x < columns; ++x) {
+            const auto a = y * (columns + 1) + x + 1;
+            const auto b = a + columns + 1;
+            if (x % 4 == 3) {
+                // Relative to the last vertex of the grid.
+                const auto last = (rows + 1) * (columns + 1);
+                obj += std::format("f {} {} {}\n", a - last - 1, a - last, b - last);
+            } else {
+                obj += std::format("f {}/{}/1 {}/{}/1 {}/{}/1 {}/{}/1\n", a, a, a + 1, a + 1, b + 1, b + 1, b, b);
+            }
+        }
+    }
+    return obj;
+}
+
+auto ReplaceLineEndings(const std::string& obj, const std::string& ending) {
+    auto output = std::string {};
+    for (auto c : obj) {
+        if (c == '\n') output += ending;
+        else output += c;
+    }
+    return output;
+}
+
+auto Indices(const tinyobj::mesh_t& mesh) {
+    auto output = std::vector<std::tuple<int, int, int>> {};
+    for (const auto& index : mesh.indices) {
+        output.emplace_back(index.vertex_index, index.normal_index, index.texcoord_index);
+    }
+    return output;
+}
+
+auto ExpectMatchesTinyObj(const std::string& obj) {
+    const auto path = std::filesystem::path {"assets/obj_parser_test.obj"};
+    {
+        auto file = std::ofstream {path, std::ios::binary};
+        file << obj;
+    }
+
+    auto expected_attrib = tinyobj::attrib_t {};
+    auto expected_shapes = std::vector<tinyobj::shape_t> {};
+    auto expected_materials = std::vector<tinyobj::material_t> {};
+    auto warning = std::string {};
+    auto error = std::string {};
+    auto library = std::istringstream {materials_library};
+    auto expected_reader = tinyobj::MaterialStreamReader {library};
+    auto stream = std::ifstream {path, std::ios::binary};
+    const auto loaded = tinyobj::LoadObj(
+        &expected_attrib,
+        &expected_shapes,
+        &expected_materials,
+        &warning,
+        &error,
+        &stream,
+        &expected_reader
+    );
+    stream.close();
+
+    // Chunk sizes down to a few bytes put chunk boundaries on every line.
+    for (auto workers : {1u, 2u, 8u}) {
+        for (auto min_chunk_size : {std::size_t {1} << 20, std::size_t {64}, std::size_t {1}}) {
+            SCOPED_TRACE(std::format("workers {}, min chunk size {}", workers, min_chunk_size));
+            auto library = std::istringstream {materials_library};
+            auto reader = tinyobj::MaterialStreamReader {library};
+            const auto parsed = parse_obj(path, reader, workers, min_chunk_size);
+
+            ASSERT_EQ(parsed.has_value(), loaded);
+            if (!loaded) continue;
+
+            EXPECT_EQ(parsed->attrib.vertices, expected_attrib.vertices);
+            EXPECT_EQ(parsed->attrib.normals, expected_attrib.normals);
+            EXPECT_EQ(parsed->attrib.texcoords, expected_attrib.texcoords);
+
+            ASSERT_EQ(parsed->shapes.size(), expected_shapes.size());
+            for (auto i = std::size_t {0}; i < expected_shapes.size(); ++i) {
+                EXPECT_EQ(parsed->shapes[i].name, expected_shapes[i].name);
+                EXPECT_EQ(Indices(parsed->shapes[i].mesh), Indices(expected_shapes[i].mesh));
+                EXPECT_EQ(parsed->shapes[i].mesh.material_ids, expected_shapes[i].mesh.material_ids);
+            }
+
+            ASSERT_EQ(parsed->materials.size(), expected_materials.size());
+            for (auto i = std::size_t {0}; i < expected_materials.size(); ++i) {
+                EXPECT_EQ(parsed->materials[i].name, expected_materials[i].name);
+            }
+        }
+    }
+
+    std::filesystem::remove(path);
+}
+
+#pragma endregion
+
+#pragma region Parse
+
+TEST(ObjParser, ParsesQuads) {
+    ExpectMatchesTinyObj(quads);
+}
+
+TEST(ObjParser, ParsesPolygons) {
+    ExpectMatchesTinyObj(polygons);
+}
+
+TEST(ObjParser, ParsesRelativeAndZeroIndices) {
+    ExpectMatchesTinyObj(relative_indices);
+}
+
+TEST(ObjParser, ParsesGroupsAndMaterials) {
+    ExpectMatchesTinyObj(groups);
+}
+
+TEST(ObjParser, ParsesCrlfLineEndings) {
+    ExpectMatchesTinyObj(ReplaceLineEndings(groups, "\r\n"));
+    ExpectMatchesTinyObj(ReplaceLineEndings(MakeGrid(12, 10), "\r\n"));
+}
+
+TEST(ObjParser, ParsesCrLineEndings) {
+    ExpectMatchesTinyObj(ReplaceLineEndings(groups, "\r"));
+    ExpectMatchesTinyObj(ReplaceLineEndings(quads, "\r"));
+}
+
+TEST(ObjParser, ParsesLargeFilesInChunks) {
+    ExpectMatchesTinyObj(MakeGrid(40, 30));
+}
+
+TEST(ObjParser, ReportsInvalidIndices) {
+    ExpectMatchesTinyObj("v 0 0 0\nv 1 0 0\nv 1 1 0\nf -1 -2 -5\n");
+    ExpectMatchesTinyObj("v 0 0 0\nv 1 0 0\nv 1 1 0\nf 0 1 2\n");
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,113 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "texture_converter.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#pragma region Helpers
+
+struct ConvertedTexture {
+    TextureHeader header {};
+    std::vector<uint8_t> pixels;
+};
+
+class TextureConverterTest : public ::testing::Test {
+protected:
+    fs::path directory;
+
+    auto SetUp() -> void override {
+        const auto name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        directory = fs::temp_directory_path() / (std::string {"gleam_texture_converter_"} + name);
+        fs::remove_all(directory);
+        fs::create_directories(directory);
+    }
+
+    auto TearDown() -> void override {
+        fs::remove_all(directory);
+    }
+
+    // Writes RGB pixels as a binary PPM, which the converter decodes like any
+    // other image, and converts it to RGBA8.
+    auto Convert(uint32_t width, uint32_t height, const std::vector<uint8_t>& rgb) {
+        const auto input = directory / "input.ppm";
+        const auto output = directory / "output.tex";
+        {
+            auto file = std::ofstream {input, std::ios::binary};
+            file << "P6\n" << width << ' ' << height << "\n255\n";
+            file.write(reinterpret_cast<const char*>(rgb.data()), rgb.size());
+        }
+
+        auto converted = ConvertedTexture {};
+        EXPECT_TRUE(convert_texture(input, output));
+        auto file = std::ifstream {output, std::ios::binary};
+        file.read(reinterpret_cast<char*>(&converted.header), sizeof(converted.header));
+        converted.pixels.resize(converted.header.pixel_data_size);
+        file.read(reinterpret_cast<char*>(converted.pixels.data()), converted.pixels.size());
+        return converted;
+    }
+};
+
+#pragma endregion
+
+#pragma region Mip Levels
+
+TEST_F(TextureConverterTest, HalvesNonPowerOfTwoLevels) {
+    auto rgb = std::vector<uint8_t> {};
+    for (auto i = 0; i < 5 * 3; ++i) rgb.insert(rgb.end(), {200, 100, 50});
+    const auto texture = Convert(5, 3, rgb);
+
+    // 5x3, 2x1 and 1x1.
+    EXPECT_EQ(texture.header.mip_levels, 3);
+    ASSERT_EQ(texture.pixels.size(), (15 + 2 + 1) * 4);
+
+    // Filter weights add up to one, so a flat color stays flat on every level.
+    for (auto i = std::size_t {0}; i < texture.pixels.size(); i += 4) {
+        EXPECT_NEAR(texture.pixels[i + 0], 200, 1);
+        EXPECT_NEAR(texture.pixels[i + 1], 100, 1);
+        EXPECT_NEAR(texture.pixels[i + 2], 50, 1);
+        EXPECT_EQ(texture.pixels[i + 3], 255);
+    }
+}
+
+TEST_F(TextureConverterTest, KeepsOddEdgesInMipLevels) {
+    // The last column doesn't fit in a pair, but still contributes a third.
+    const auto texture = Convert(3, 1, {0, 0, 0, 0, 0, 0, 255, 255, 255});
+    EXPECT_EQ(texture.header.mip_levels, 2);
+    ASSERT_EQ(texture.pixels.size(), (3 + 1) * 4);
+
+    // A third of linear white is 156 in sRGB.
+    const auto level = &texture.pixels[3 * 4];
+    EXPECT_NEAR(level[0], 156, 1);
+    EXPECT_NEAR(level[1], 156, 1);
+    EXPECT_NEAR(level[2], 156, 1);
+}
+
+TEST_F(TextureConverterTest, FiltersOddEdgesSymmetrically) {
+    auto first = std::vector<uint8_t>(5 * 3, 0);
+    auto last = std::vector<uint8_t>(5 * 3, 0);
+    std::memset(first.data(), 255, 3);
+    std::memset(last.data() + 4 * 3, 255, 3);
+
+    // 5x1 filters into 2x1, the edge texels weigh the same on either side.
+    const auto a = Convert(5, 1, first);
+    const auto b = Convert(5, 1, last);
+    ASSERT_EQ(a.pixels.size(), (5 + 2 + 1) * 4);
+    ASSERT_EQ(b.pixels.size(), a.pixels.size());
+    EXPECT_EQ(a.pixels[5 * 4], b.pixels[6 * 4]);
+    EXPECT_EQ(a.pixels[6 * 4], b.pixels[5 * 4]);
+    EXPECT_GT(a.pixels[5 * 4], a.pixels[6 * 4]);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,51 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "core/frame_thread.hpp"
+
+#include <set>
+#include <thread>
+
+TEST(FrameThread, ReturnsTheResultOfEachTask) {
+    auto frame_thread = gleam::FrameThread {};
+
+    frame_thread.Run([] { return true; });
+    EXPECT_TRUE(frame_thread.Wait());
+
+    frame_thread.Run([] { return false; });
+    EXPECT_FALSE(frame_thread.Wait());
+}
+
+TEST(FrameThread, RunsEveryTaskOnTheSameThread) {
+    auto frame_thread = gleam::FrameThread {};
+    auto threads = std::set<std::thread::id> {};
+
+    for (auto i = 0; i < 10; ++i) {
+        frame_thread.Run([&] {
+            threads.insert(std::this_thread::get_id());
+            return true;
+        });
+        frame_thread.Wait();
+    }
+
+    EXPECT_EQ(threads.size(), 1);
+    EXPECT_FALSE(threads.contains(std::this_thread::get_id()));
+}
+
+TEST(FrameThread, FinishesPendingTaskWhenDestroyed) {
+    auto ran = false;
+    {
+        auto frame_thread = gleam::FrameThread {};
+        frame_thread.Run([&] {
+            ran = true;
+            return true;
+        });
+    }
+    EXPECT_TRUE(ran);
+}
\ No newline at end of file
@@ -9,6 +9,8 @@
 
 #include <gleam/core/geometry.hpp>
 
+#include <cmath>
+#include <memory>
 #include <vector>
 
 using enum gleam::GeometryAttributeType;
@@ -125,6 +127,89 @@ TEST(Geometry, VertexCount) {
 
 #pragma endregion
 
+#pragma region External Data
+
+TEST(Geometry, ViewsExternalDataWithoutCopying) {
+    auto storage = std::make_shared<std::vector<float>>(std::vector<float> {
+        -1.0f, 0.0f, 0.0f,
+         1.0f, 0.0f, 0.0f,
+         0.0f, 1.0f, 0.0f
+    });
+    const auto indices = std::vector<unsigned int> {0, 1, 2};
+    auto geometry = gleam::Geometry::Create(*storage, indices, storage);
+    geometry->SetAttribute({.type = Position, .item_size = 3});
+
+    EXPECT_TRUE(geometry->IsExternal());
+    EXPECT_EQ(geometry->VertexData().data(), storage->data());
+    EXPECT_EQ(geometry->VertexCount(), 3);
+    EXPECT_EQ(geometry->IndexCount(), 3);
+}
+
+TEST(Geometry, ReleaseExternalDataDropsStorage) {
+    auto storage = std::make_shared<std::vector<float>>(std::vector<float> {
+        -1.0f, 0.0f, 0.0f,
+         1.0f, 0.0f, 0.0f,
+         0.0f, 1.0f, 0.0f
+    });
+    const auto indices = std::vector<unsigned int> {0, 1, 2};
+    auto geometry = gleam::Geometry::Create(*storage, indices, storage);
+    geometry->SetAttribute({.type = Position, .item_size = 3});
+    const auto weak_storage = std::weak_ptr {storage};
+    storage.reset();
+
+    geometry->ReleaseData();
+
+    EXPECT_TRUE(weak_storage.expired());
+    EXPECT_TRUE(geometry->VertexData().empty());
+    EXPECT_TRUE(geometry->IndexData().empty());
+    EXPECT_EQ(geometry->VertexCount(), 3);
+    EXPECT_EQ(geometry->IndexCount(), 3);
+    EXPECT_FLOAT_EQ(geometry->BoundingSphere().radius, std::sqrt(1.25f));
+}
+
+#pragma endregion
+
+#pragma region Residency
+
+TEST(Geometry, ReleaseDataKeepsCountsAndBounds) {
+    auto geometry = gleam::Geometry::Create({
+        -1.0f, 0.0f, 0.0f,
+         1.0f, 0.0f, 0.0f,
+         0.0f, 1.0f, 0.0f
+    }, {0, 1, 2});
+    geometry->SetAttribute({.type = Position, .item_size = 3});
+    const auto bounds = geometry->BoundingSphere();
+
+    geometry->ReleaseData();
+
+    EXPECT_TRUE(geometry->IsReleased());
+    EXPECT_TRUE(geometry->VertexData().empty());
+    EXPECT_EQ(geometry->VertexCount(), 3);
+    EXPECT_EQ(geometry->IndexCount(), 3);
+    EXPECT_FLOAT_EQ(geometry->BoundingSphere().radius, bounds.radius);
+    EXPECT_FALSE(geometry->Reload());
+}
+
+TEST(Geometry, ReloadRestoresReleasedData) {
+    const auto vertex_data = std::vector<float> {
+        -1.0f, 0.0f, 0.0f,
+         1.0f, 0.0f, 0.0f,
+         0.0f, 1.0f, 0.0f
+    };
+    auto geometry = gleam::Geometry::Create(vertex_data, {0, 1, 2});
+    geometry->SetAttribute({.type = Position, .item_size = 3});
+    geometry->SetReloader([&]() { return gleam::Geometry::Create(vertex_data, {0, 1, 2}); });
+
+    geometry->ReleaseData();
+
+    EXPECT_TRUE(geometry->Reload());
+    EXPECT_FALSE(geometry->IsReleased());
+    EXPECT_EQ(geometry->VertexData().size(), 9);
+    EXPECT_EQ(geometry->IndexData().size(), 3);
+}
+
+#pragma endregion
+
 #pragma region Edge Cases
 
 TEST(Geometry, AddAttributeWithZeroItemSize) {
@@ -64,4 +64,20 @@ TEST(Logger, StringFormatting) {
     );
 }
 
+#pragma endregion
+
+#pragma region Identity formatting
+
+TEST(Logger, UUIDFormatting) {
+    testing::internal::CaptureStdout();
+
+    auto uuid = gleam::math::UUID {0x0123456789AB4CDEULL, 0x8123456789ABCDEFULL};
+    gleam::Logger::Log(gleam::LogLevel::Info, "id {}", uuid);
+
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_THAT(output, ::testing::HasSubstr(
+        "\x1B[1;34m[Info]\x1B[0m: id 01234567-89ab-4cde-8123-456789abcdef")
+    );
+}
+
 #pragma endregion
\ No newline at end of file
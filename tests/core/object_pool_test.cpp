@@ -0,0 +1,99 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <gleam/core/object_pool.hpp>
+#include <gleam/materials/flat_material.hpp>
+#include <gleam/nodes/mesh.hpp>
+#include <gleam/nodes/node.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#pragma region Helpers
+
+auto FindPool(std::string_view name) {
+    const auto stats = gleam::ObjectPools::Statistics();
+    const auto it = std::ranges::find(stats, name, &gleam::PoolStatistics::name);
+    return it != stats.end() ? *it : gleam::PoolStatistics {};
+}
+
+#pragma endregion
+
+#pragma region Slab Pool
+
+TEST(ObjectPool, AllocateAndReuseBlocks) {
+    auto pool = gleam::SlabPool {"SlabPoolTest", 24, 8};
+
+    auto a = pool.Allocate();
+    auto b = pool.Allocate();
+    EXPECT_NE(a, b);
+    EXPECT_EQ(pool.Statistics().in_use, 2);
+
+    pool.Deallocate(a);
+    EXPECT_EQ(pool.Statistics().in_use, 1);
+    EXPECT_EQ(pool.Allocate(), a);
+
+    pool.Deallocate(a);
+    pool.Deallocate(b);
+
+    const auto stats = pool.Statistics();
+    EXPECT_EQ(stats.in_use, 0);
+    EXPECT_EQ(stats.peak_in_use, 2);
+    EXPECT_EQ(stats.slab_count, 1);
+    EXPECT_EQ(stats.capacity, gleam::SlabPool::kBlocksPerSlab);
+}
+
+TEST(ObjectPool, AllocateAdditionalSlabs) {
+    auto pool = gleam::SlabPool {"SlabPoolGrowthTest", 16, 16};
+    auto blocks = std::vector<void*> {};
+    for (auto i = 0; i < gleam::SlabPool::kBlocksPerSlab + 1; ++i) {
+        blocks.emplace_back(pool.Allocate());
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(blocks.back()) % 16, 0);
+    }
+
+    EXPECT_EQ(pool.Statistics().slab_count, 2);
+
+    for (auto block : blocks) pool.Deallocate(block);
+    EXPECT_EQ(pool.Statistics().in_use, 0);
+}
+
+#pragma endregion
+
+#pragma region Pooled Factories
+
+TEST(ObjectPool, CreatePooledObjects) {
+    gleam::ObjectPools::SetEnabled(true);
+
+    auto root = gleam::Node::Create();
+    auto mesh = gleam::Mesh::Create(nullptr, gleam::FlatMaterial::Create());
+    root->Add(mesh);
+
+    gleam::ObjectPools::SetEnabled(false);
+
+    EXPECT_EQ(FindPool("gleam::Node").in_use, 1);
+    EXPECT_EQ(FindPool("gleam::Mesh").in_use, 1);
+    EXPECT_EQ(FindPool("gleam::FlatMaterial").in_use, 1);
+
+    root.reset();
+    mesh.reset();
+
+    EXPECT_EQ(FindPool("gleam::Node").in_use, 0);
+    EXPECT_EQ(FindPool("gleam::Mesh").in_use, 0);
+    EXPECT_EQ(FindPool("gleam::FlatMaterial").in_use, 0);
+}
+
+TEST(ObjectPool, CreateUnpooledObjectsByDefault) {
+    const auto before = FindPool("gleam::Node").in_use;
+    auto node = gleam::Node::Create();
+    EXPECT_EQ(FindPool("gleam::Node").in_use, before);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,163 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "utilities/profiler.hpp"
+
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+auto count_occurrences(const std::string& str, const std::string& pattern) {
+    auto count = 0;
+    for (auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+auto export_trace() {
+    auto stream = std::stringstream {};
+    gleam::Profiler::Get().WriteChromeTrace(stream);
+    return stream.str();
+}
+
+} // unnamed namespace
+
+class ProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        gleam::Profiler::Get().Clear();
+        gleam::Profiler::Get().SetEnabled(true);
+    }
+
+    void TearDown() override {
+        gleam::Profiler::Get().SetEnabled(false);
+        gleam::Profiler::Get().Clear();
+    }
+};
+
+#pragma region Zones
+
+TEST_F(ProfilerTest, RecordNestedZones) {
+    {
+        auto outer = gleam::ProfileZone {"Outer"};
+        auto inner = gleam::ProfileZone {"Inner"};
+    }
+
+    const auto& buffer = gleam::Profiler::Get().ThreadBuffer();
+    ASSERT_EQ(buffer.Count(), 2);
+
+    // Zones are recorded when they close, so the inner one comes first.
+    EXPECT_STREQ(buffer.At(0).name, "Inner");
+    EXPECT_EQ(buffer.At(0).depth, 1);
+    EXPECT_STREQ(buffer.At(1).name, "Outer");
+    EXPECT_EQ(buffer.At(1).depth, 0);
+    EXPECT_LE(buffer.At(1).start, buffer.At(0).start);
+    EXPECT_GE(buffer.At(1).end, buffer.At(0).end);
+}
+
+TEST_F(ProfilerTest, IgnoreZonesWhileDisabled) {
+    gleam::Profiler::Get().SetEnabled(false);
+    {
+        auto zone = gleam::ProfileZone {"Zone"};
+    }
+    gleam::Profiler::Get().Counter("Counter", 1.0);
+    gleam::Profiler::Get().MarkFrame();
+
+    EXPECT_EQ(gleam::Profiler::Get().EventCount(), 0);
+}
+
+TEST_F(ProfilerTest, RecordZonesPerThread) {
+    {
+        auto zone = gleam::ProfileZone {"Main"};
+    }
+    auto thread = std::thread([] {
+        gleam::Profiler::Get().SetThreadName("Helper");
+        auto zone = gleam::ProfileZone {"Helper zone"};
+    });
+    thread.join();
+
+    EXPECT_EQ(gleam::Profiler::Get().EventCount(), 2);
+
+    const auto trace = export_trace();
+    EXPECT_NE(trace.find(R"("args": {"name": "Helper"})"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name": "Helper zone")"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, ClearWhileThreadsRecord) {
+    auto running = std::atomic<bool> {true};
+    auto threads = std::vector<std::thread> {};
+    for (auto i = 0; i < 4; ++i) {
+        threads.emplace_back([&running] {
+            while (running.load(std::memory_order_relaxed)) {
+                auto zone = gleam::ProfileZone {"Worker"};
+            }
+        });
+    }
+
+    for (auto i = 0; i < 200; ++i) {
+        gleam::Profiler::Get().Clear();
+        EXPECT_FALSE(export_trace().empty());
+    }
+    running = false;
+    for (auto& thread : threads) thread.join();
+
+    gleam::Profiler::Get().Clear();
+    EXPECT_EQ(gleam::Profiler::Get().EventCount(), 0);
+    {
+        auto zone = gleam::ProfileZone {"Main"};
+    }
+    EXPECT_EQ(gleam::Profiler::Get().EventCount(), 1);
+}
+
+TEST(ProfileBuffer, DropEventsPastCapacity) {
+    auto buffer = gleam::ProfileBuffer {1, 2};
+    for (auto i = 0; i < 5; ++i) {
+        buffer.Push({.name = "Zone"});
+    }
+
+    EXPECT_EQ(buffer.Count(), 2);
+    EXPECT_EQ(buffer.Dropped(), 3);
+
+    buffer.Clear();
+    EXPECT_EQ(buffer.Count(), 0);
+    EXPECT_EQ(buffer.Dropped(), 0);
+
+    buffer.Push({.name = "After clear"});
+    ASSERT_EQ(buffer.Count(), 1);
+    EXPECT_STREQ(buffer.At(0).name, "After clear");
+}
+
+#pragma endregion
+
+#pragma region Chrome Trace
+
+TEST_F(ProfilerTest, WriteChromeTraceEvents) {
+    gleam::Profiler::Get().MarkFrame();
+    {
+        auto zone = gleam::ProfileZone {"Render \"scene\""};
+    }
+    gleam::Profiler::Get().Counter("Draw calls", 42.0);
+
+    const auto trace = export_trace();
+    EXPECT_EQ(trace.rfind(R"({"displayTimeUnit": "ms", "traceEvents": [)", 0), 0);
+    EXPECT_EQ(count_occurrences(trace, R"("ph": "X")"), 1);
+    EXPECT_EQ(count_occurrences(trace, R"("ph": "i")"), 1);
+    EXPECT_EQ(count_occurrences(trace, R"("ph": "C")"), 1);
+    EXPECT_NE(trace.find(R"("name": "Render \"scene\"")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("args": {"value": 42})"), std::string::npos);
+    EXPECT_NE(trace.find(R"("args": {"frame": 0})"), std::string::npos);
+    EXPECT_NE(trace.find("]}"), std::string::npos);
+}
+
+#pragma endregion
\ No newline at end of file
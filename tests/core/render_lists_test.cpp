@@ -0,0 +1,207 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+#include <test_helpers.hpp>
+
+#include <gleam/geometries/box_geometry.hpp>
+#include <gleam/lights/point_light.hpp>
+#include <gleam/materials/flat_material.hpp>
+#include <gleam/nodes/mesh.hpp>
+#include <gleam/nodes/scene.hpp>
+
+#include "core/render_lists.hpp"
+
+#pragma region Process Scene
+
+TEST(RenderLists, SeparateOpaqueAndTransparentMeshes) {
+    auto scene = gleam::Scene::Create();
+    auto geometry = gleam::BoxGeometry::Create();
+    auto opaque = gleam::FlatMaterial::Create();
+    auto transparent = gleam::FlatMaterial::Create();
+    transparent->transparent = true;
+
+    scene->Add(gleam::Mesh::Create(geometry, opaque));
+    scene->Add(gleam::Mesh::Create(geometry, opaque));
+    scene->Add(gleam::Mesh::Create(geometry, transparent));
+    scene->Add(gleam::PointLight::Create({0xFFFFFF, 1.0f}));
+
+    auto render_lists = gleam::RenderLists {};
+    render_lists.ProcessScene(scene.get());
+
+    EXPECT_EQ(render_lists.Opaque().size(), 2);
+    EXPECT_EQ(render_lists.Transparent().size(), 1);
+    EXPECT_EQ(render_lists.Lights().size(), 1);
+    EXPECT_TRUE(render_lists.Transparent()[0].flags & gleam::RenderProxy::Transparent);
+}
+
+TEST(RenderLists, ShareGeometryAndMaterialEntries) {
+    auto scene = gleam::Scene::Create();
+    auto geometry = gleam::BoxGeometry::Create();
+    auto material = gleam::FlatMaterial::Create();
+
+    scene->Add(gleam::Mesh::Create(geometry, material));
+    scene->Add(gleam::Mesh::Create(geometry, material));
+    scene->Add(gleam::Mesh::Create(gleam::BoxGeometry::Create(), gleam::FlatMaterial::Create()));
+
+    auto render_lists = gleam::RenderLists {};
+    render_lists.ProcessScene(scene.get());
+
+    const auto proxies = render_lists.Opaque();
+    ASSERT_EQ(proxies.size(), 3);
+
+    auto shared = 0;
+    for (const auto& proxy : proxies) {
+        if (render_lists.GetGeometry(proxy.geometry_index) == geometry) {
+            EXPECT_EQ(render_lists.GetMaterial(proxy.material_index), material.get());
+            shared++;
+        } else {
+            EXPECT_NE(render_lists.GetMaterial(proxy.material_index), material.get());
+        }
+    }
+    EXPECT_EQ(shared, 2);
+}
+
+#pragma endregion
+
+#pragma region Update
+
+TEST(RenderLists, UpdateWorldTransformAndBounds) {
+    auto scene = gleam::Scene::Create();
+    auto mesh = gleam::Mesh::Create(gleam::BoxGeometry::Create(), gleam::FlatMaterial::Create());
+    mesh->transform.Translate({1.0f, 2.0f, 3.0f});
+    scene->Add(mesh);
+
+    auto render_lists = gleam::RenderLists {};
+    render_lists.ProcessScene(scene.get());
+    scene->UpdateTransformHierarchy();
+    render_lists.Update(scene.get(), {});
+
+    const auto& proxy = render_lists.Opaque()[0];
+    EXPECT_TRUE(proxy.flags & gleam::RenderProxy::Valid);
+    EXPECT_TRUE(proxy.flags & gleam::RenderProxy::Indexed);
+    EXPECT_VEC3_NEAR(proxy.world_bounds.center, {1.0f, 2.0f, 3.0f}, 0.0001f);
+    EXPECT_EQ(proxy.count, mesh->geometry->IndexData().size());
+    EXPECT_EQ(proxy.program_key, render_lists.GetProgramAttributes(proxy.material_index).key);
+
+    mesh->transform.Translate({1.0f, 0.0f, 0.0f});
+    scene->UpdateTransformHierarchy();
+    render_lists.Update(scene.get(), {});
+
+    EXPECT_VEC3_NEAR(render_lists.Opaque()[0].world_bounds.center, {2.0f, 2.0f, 3.0f}, 0.0001f);
+}
+
+TEST(RenderLists, UpdateWithWorkerPool) {
+    auto scene = gleam::Scene::Create();
+    auto geometry = gleam::BoxGeometry::Create();
+    auto material = gleam::FlatMaterial::Create();
+    for (auto i = 0; i < 2000; ++i) {
+        auto mesh = gleam::Mesh::Create(geometry, material);
+        mesh->transform.Translate({static_cast<float>(i), 0.0f, 0.0f});
+        scene->Add(mesh);
+    }
+
+    auto render_lists = gleam::RenderLists {};
+    auto workers = gleam::WorkerPool {3};
+    render_lists.ProcessScene(scene.get());
+    scene->UpdateTransformHierarchy();
+    render_lists.Update(scene.get(), {}, &workers);
+
+    for (const auto& proxy : render_lists.Opaque()) {
+        EXPECT_TRUE(proxy.flags & gleam::RenderProxy::Valid);
+        EXPECT_FLOAT_EQ(proxy.world_bounds.center.x, proxy.world[3].x);
+    }
+}
+
+TEST(RenderLists, UpdateSkipsInvalidGeometry) {
+    auto scene = gleam::Scene::Create();
+    scene->Add(gleam::Mesh::Create(gleam::Geometry::Create(), gleam::FlatMaterial::Create()));
+
+    auto render_lists = gleam::RenderLists {};
+    render_lists.ProcessScene(scene.get());
+    render_lists.Update(scene.get(), {});
+
+    EXPECT_FALSE(render_lists.Opaque()[0].flags & gleam::RenderProxy::Valid);
+}
+
+TEST(RenderLists, UpdateRebuildsWhenMaterialBecomesTransparent) {
+    auto scene = gleam::Scene::Create();
+    auto material = gleam::FlatMaterial::Create();
+    scene->Add(gleam::Mesh::Create(gleam::BoxGeometry::Create(), material));
+
+    auto render_lists = gleam::RenderLists {};
+    render_lists.ProcessScene(scene.get());
+    EXPECT_EQ(render_lists.Opaque().size(), 1);
+
+    material->transparent = true;
+    render_lists.Update(scene.get(), {});
+
+    EXPECT_EQ(render_lists.Opaque().size(), 0);
+    EXPECT_EQ(render_lists.Transparent().size(), 1);
+}
+
+TEST(RenderLists, UpdateRebuildsWhenGeometryIsReplaced) {
+    auto scene = gleam::Scene::Create();
+    auto mesh = gleam::Mesh::Create(gleam::BoxGeometry::Create(), gleam::FlatMaterial::Create());
+    scene->Add(mesh);
+
+    auto render_lists = gleam::RenderLists {};
+    render_lists.ProcessScene(scene.get());
+
+    auto geometry = gleam::BoxGeometry::Create();
+    mesh->geometry = geometry;
+    render_lists.Update(scene.get(), {});
+
+    const auto& proxy = render_lists.Opaque()[0];
+    EXPECT_EQ(render_lists.GetGeometry(proxy.geometry_index), geometry);
+}
+
+TEST(RenderLists, UpdateRebuildsWhenMaterialIsReplaced) {
+    auto scene = gleam::Scene::Create();
+    auto mesh = gleam::Mesh::Create(gleam::BoxGeometry::Create(), gleam::FlatMaterial::Create());
+    scene->Add(mesh);
+
+    auto render_lists = gleam::RenderLists {};
+    render_lists.ProcessScene(scene.get());
+    render_lists.Update(scene.get(), {});
+
+    // The previous material is released by the mesh as it's replaced.
+    auto material = gleam::FlatMaterial::Create();
+    material->transparent = true;
+    mesh->material = material;
+    render_lists.Update(scene.get(), {});
+
+    ASSERT_EQ(render_lists.Transparent().size(), 1);
+    const auto& proxy = render_lists.Transparent()[0];
+    EXPECT_EQ(render_lists.GetMaterial(proxy.material_index), material.get());
+}
+
+TEST(RenderLists, UpdateRecomputesProgramAttributesWhenInputsChange) {
+    auto scene = gleam::Scene::Create();
+    auto material = gleam::FlatMaterial::Create();
+    scene->Add(gleam::Mesh::Create(gleam::BoxGeometry::Create(), material));
+
+    auto render_lists = gleam::RenderLists {};
+    render_lists.ProcessScene(scene.get());
+    render_lists.Update(scene.get(), {});
+    const auto key = render_lists.GetProgramAttributes(0).key;
+
+    render_lists.Update(scene.get(), {});
+    EXPECT_EQ(render_lists.GetProgramAttributes(0).key, key);
+
+    material->flat_shaded = true;
+    render_lists.Update(scene.get(), {});
+    const auto flat_key = render_lists.GetProgramAttributes(0).key;
+    EXPECT_NE(flat_key, key);
+    EXPECT_TRUE(render_lists.GetProgramAttributes(0).flat_shaded);
+
+    render_lists.Update(scene.get(), {.point = 1});
+    EXPECT_NE(render_lists.GetProgramAttributes(0).key, flat_key);
+    EXPECT_EQ(render_lists.GetProgramAttributes(0).num_lights, 1);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,50 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "core/render_statistics_history.hpp"
+
+#pragma region Average
+
+TEST(RenderStatisticsHistory, AverageOfEmptyHistoryIsZero) {
+    auto history = gleam::RenderStatisticsHistory {};
+
+    const auto average = history.Average();
+
+    EXPECT_EQ(history.Count(), 0);
+    EXPECT_EQ(average.draw_calls, 0);
+    EXPECT_DOUBLE_EQ(average.culling_ms, 0.0);
+}
+
+TEST(RenderStatisticsHistory, AverageRoundsCounters) {
+    auto history = gleam::RenderStatisticsHistory {};
+
+    history.Add({.culling_ms = 1.0, .draw_calls = 10, .texture_memory_bytes = 100});
+    history.Add({.culling_ms = 2.0, .draw_calls = 11, .texture_memory_bytes = 100});
+
+    const auto average = history.Average();
+
+    EXPECT_EQ(history.Count(), 2);
+    EXPECT_DOUBLE_EQ(average.culling_ms, 1.5);
+    EXPECT_EQ(average.draw_calls, 11);
+    EXPECT_EQ(average.texture_memory_bytes, 100);
+}
+
+TEST(RenderStatisticsHistory, AverageDropsOldestFrames) {
+    auto history = gleam::RenderStatisticsHistory {};
+
+    history.Add({.draw_calls = 1000});
+    for (auto i = std::size_t {0}; i < gleam::RenderStatisticsHistory::kFrames; ++i) {
+        history.Add({.draw_calls = 5});
+    }
+
+    EXPECT_EQ(history.Count(), gleam::RenderStatisticsHistory::kFrames);
+    EXPECT_EQ(history.Average().draw_calls, 5);
+}
+
+#pragma endregion
\ No newline at end of file
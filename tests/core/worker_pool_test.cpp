@@ -0,0 +1,103 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "core/worker_pool.hpp"
+
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+#pragma region Parallel For
+
+TEST(WorkerPool, ParallelForVisitsEveryIndexOnce) {
+    auto pool = gleam::WorkerPool {3};
+    auto visits = std::vector<std::atomic<int>>(10'000);
+
+    pool.ParallelFor(visits.size(), 64, [&](auto begin, auto end) {
+        for (auto i = begin; i < end; ++i) visits[i]++;
+    });
+
+    for (const auto& count : visits) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST(WorkerPool, ParallelForWithoutWorkersRunsOnCaller) {
+    auto pool = gleam::WorkerPool {0};
+    const auto caller = std::this_thread::get_id();
+    auto chunks = 0;
+
+    pool.ParallelFor(100, 10, [&](auto begin, auto end) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, 100);
+        chunks++;
+    });
+
+    EXPECT_EQ(pool.ThreadCount(), 0);
+    EXPECT_EQ(chunks, 1);
+}
+
+TEST(WorkerPool, ParallelForEmptyRange) {
+    auto pool = gleam::WorkerPool {2};
+    auto calls = 0;
+
+    pool.ParallelFor(0, 10, [&](auto, auto) { calls++; });
+
+    EXPECT_EQ(calls, 0);
+}
+
+TEST(WorkerPool, ParallelForRepeatedCalls) {
+    auto pool = gleam::WorkerPool {2};
+    auto total = std::atomic<std::size_t> {0};
+
+    for (auto i = 0; i < 100; ++i) {
+        pool.ParallelFor(1000, 16, [&](auto begin, auto end) {
+            total += end - begin;
+        });
+    }
+
+    EXPECT_EQ(total.load(), 100'000);
+}
+
+#pragma endregion
+
+#pragma region Submit
+
+TEST(WorkerPool, SubmitRunsHigherPriorityTasksFirst) {
+    auto pool = gleam::WorkerPool {1};
+    auto order = std::vector<int> {};
+    auto gate = std::promise<void> {};
+    auto done = std::promise<void> {};
+
+    // Occupy the only worker so the remaining tasks queue up behind it.
+    pool.Submit([future = gate.get_future().share()] { future.wait(); });
+    pool.Submit([&] { order.push_back(0); }, 0);
+    pool.Submit([&] { order.push_back(2); }, 2);
+    pool.Submit([&] { order.push_back(1); }, 1);
+    pool.Submit([&] { order.push_back(3); }, 1);
+    pool.Submit([&] { done.set_value(); }, -1);
+
+    gate.set_value();
+    done.get_future().wait();
+
+    EXPECT_EQ(order, (std::vector<int> {2, 1, 3, 0}));
+}
+
+TEST(WorkerPool, SubmitWithoutWorkersRunsOnCaller) {
+    auto pool = gleam::WorkerPool {0};
+    auto ran = false;
+
+    pool.Submit([&] { ran = true; });
+
+    EXPECT_TRUE(ran);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,190 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <gleam/core/geometry.hpp>
+#include <gleam/loaders/archive.hpp>
+#include <gleam/loaders/mesh_loader.hpp>
+#include <gleam/loaders/texture_loader.hpp>
+#include <gleam/materials/phong_material.hpp>
+#include <gleam/nodes/mesh.hpp>
+
+#include "asset_builder/include/types.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#pragma region Helpers
+
+using Bytes = std::vector<char>;
+
+auto ReadFile(const std::filesystem::path& path) {
+    auto file = std::ifstream {path, std::ios::binary};
+    return Bytes {std::istreambuf_iterator<char> {file}, {}};
+}
+
+template <class T>
+auto Append(Bytes& bytes, const T& value) {
+    const auto data = reinterpret_cast<const char*>(&value);
+    bytes.insert(bytes.end(), data, data + sizeof(T));
+}
+
+auto TexturedMesh() {
+    auto bytes = Bytes {};
+    auto header = MeshHeader {};
+    std::memcpy(header.magic, "MES0", 4);
+    header.version = 1;
+    header.header_size = sizeof(MeshHeader);
+    header.material_count = 1;
+    header.mesh_count = 1;
+    Append(bytes, header);
+
+    auto material = MaterialEntryHeader {};
+    std::strcpy(material.texture, "texture.tex");
+    Append(bytes, material);
+
+    auto entry = MeshEntryHeader {};
+    entry.vertex_count = 3;
+    entry.index_count = 3;
+    entry.vertex_stride = 8;
+    entry.material_index = 0;
+    entry.vertex_data_size = 3 * 8 * sizeof(float);
+    entry.index_data_size = 3 * sizeof(unsigned int);
+    entry.vertex_flags = Positions | Normals | UVs;
+    Append(bytes, entry);
+
+    for (auto i = 0; i < 3 * 8; ++i) Append(bytes, 0.0f);
+    for (auto i = 0u; i < 3; ++i) Append(bytes, i);
+    return bytes;
+}
+
+auto WriteArchive(const std::filesystem::path& path, std::vector<std::pair<std::string, Bytes>> files) {
+    std::ranges::sort(files, {}, [](const auto& file) { return archive_hash(file.first); });
+
+    auto header = ArchiveHeader {};
+    std::memcpy(header.magic, "PAK0", 4);
+    header.version = 1;
+    header.header_size = sizeof(ArchiveHeader);
+    header.entry_count = static_cast<uint32_t>(files.size());
+    header.alignment = 16;
+    header.toc_offset = sizeof(ArchiveHeader);
+    header.names_offset = header.toc_offset + files.size() * sizeof(ArchiveEntry);
+
+    auto names = std::string {};
+    for (const auto& [name, data] : files) names += name;
+    header.names_size = names.size();
+
+    auto toc = Bytes {};
+    auto data = Bytes {};
+    const auto data_offset = (header.names_offset + names.size() + 15) & ~uint64_t {15};
+    auto name_offset = uint32_t {0};
+    for (const auto& [name, contents] : files) {
+        auto entry = ArchiveEntry {};
+        entry.hash = archive_hash(name);
+        entry.offset = data_offset + data.size();
+        entry.size = contents.size();
+        entry.name_offset = name_offset;
+        entry.name_size = static_cast<uint32_t>(name.size());
+        Append(toc, entry);
+        name_offset += entry.name_size;
+
+        data.insert(data.end(), contents.begin(), contents.end());
+        data.resize((data.size() + 15) & ~std::size_t {15});
+    }
+
+    auto file = std::ofstream {path, std::ios::binary};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(toc.data(), toc.size());
+    file.write(names.data(), names.size());
+    const auto padding = Bytes(data_offset - header.names_offset - names.size());
+    file.write(padding.data(), padding.size());
+    file.write(data.data(), data.size());
+}
+
+#pragma endregion
+
+#pragma region Mounting
+
+TEST(Archive, MountResolvesEntries) {
+    WriteArchive("assets/archive.pak", {
+        {"plane.msh", ReadFile("assets/plane.msh")},
+        {"textures/texture.tex", ReadFile("assets/texture.tex")}
+    });
+
+    ASSERT_TRUE(gleam::Archive::Mount("assets/archive.pak", "packed"));
+    EXPECT_TRUE(gleam::Archive::Contains("packed/plane.msh"));
+    EXPECT_TRUE(gleam::Archive::Contains("./packed/textures/../plane.msh"));
+    EXPECT_TRUE(gleam::Archive::Contains("packed/textures/texture.tex"));
+    EXPECT_FALSE(gleam::Archive::Contains("plane.msh"));
+    EXPECT_FALSE(gleam::Archive::Contains("packed/missing.msh"));
+    EXPECT_FALSE(gleam::Archive::Contains("packedplane.msh"));
+
+    EXPECT_TRUE(gleam::Archive::Unmount("assets/archive.pak"));
+    EXPECT_FALSE(gleam::Archive::Contains("packed/plane.msh"));
+    EXPECT_FALSE(gleam::Archive::Unmount("assets/archive.pak"));
+
+    std::filesystem::remove("assets/archive.pak");
+}
+
+TEST(Archive, MountRejectsInvalidArchives) {
+    auto missing = gleam::Archive::Mount("assets/missing.pak");
+    ASSERT_FALSE(missing);
+    EXPECT_EQ(missing.error(), "Unable to open archive 'assets/missing.pak'");
+
+    auto invalid = gleam::Archive::Mount("assets/plane.msh");
+    ASSERT_FALSE(invalid);
+    EXPECT_EQ(invalid.error(), "Invalid archive file 'assets/plane.msh'");
+
+    EXPECT_EQ(gleam::Archive::MountCount(), 0);
+}
+
+#pragma endregion
+
+#pragma region Loading
+
+TEST(Archive, LoadersReadFromMountedArchive) {
+    WriteArchive("assets/archive.pak", {
+        {"plane.msh", ReadFile("assets/plane.msh")},
+        {"textured.msh", TexturedMesh()},
+        {"texture.tex", ReadFile("assets/texture.tex")}
+    });
+    ASSERT_TRUE(gleam::Archive::Mount("assets/archive.pak", "packed"));
+
+    auto texture = gleam::TextureLoader::Create()->Load("packed/texture.tex");
+    ASSERT_TRUE(texture);
+    EXPECT_EQ(texture.value()->width, 5);
+
+    auto mesh_loader = gleam::MeshLoader::Create();
+    auto plane = mesh_loader->Load("packed/plane.msh");
+    ASSERT_TRUE(plane);
+    auto mesh = static_cast<gleam::Mesh*>(plane.value()->Children()[0].get());
+    EXPECT_TRUE(mesh->geometry->IsExternal());
+    EXPECT_EQ(mesh->geometry->VertexCount(), 4);
+    EXPECT_EQ(mesh->geometry->IndexCount(), 6);
+
+    // Textures referenced by a mesh resolve next to it, inside the archive.
+    auto textured = mesh_loader->Load("packed/textured.msh");
+    ASSERT_TRUE(textured);
+    mesh = static_cast<gleam::Mesh*>(textured.value()->Children()[0].get());
+    auto material = static_cast<gleam::PhongMaterial*>(mesh->material.get());
+    ASSERT_NE(material->texture_map, nullptr);
+    EXPECT_EQ(material->texture_map->width, 5);
+
+    EXPECT_TRUE(gleam::Archive::Unmount("assets/archive.pak"));
+    EXPECT_FALSE(mesh_loader->Load("packed/plane.msh"));
+
+    std::filesystem::remove("assets/archive.pak");
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,122 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "utilities/mesh_codec.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#pragma region Helpers
+
+auto MakeVertices(std::size_t count) {
+    auto vertices = std::vector<float> {};
+    for (auto i = std::size_t {0}; i < count; ++i) {
+        const auto t = static_cast<float>(i) * 0.01f;
+        vertices.insert(vertices.end(), {
+            std::cos(t), std::sin(t), t,
+            0.0f, 0.0f, 1.0f,
+            t, 1.0f - t
+        });
+    }
+    return vertices;
+}
+
+template <class T>
+auto RoundTrip(const std::vector<T>& data, uint32_t stride) {
+    const auto encoded = gleam::encode_mesh_stream(std::as_bytes(std::span {data}), stride);
+    auto decoded = std::vector<T>(data.size());
+    EXPECT_TRUE(gleam::decode_mesh_stream(encoded, std::as_writable_bytes(std::span {decoded}), stride));
+    return std::pair {encoded, decoded};
+}
+
+#pragma endregion
+
+#pragma region Round Trip
+
+TEST(MeshCodec, RoundTripsVertices) {
+    const auto vertices = MakeVertices(4096);
+    const auto [encoded, decoded] = RoundTrip(vertices, 8);
+
+    EXPECT_EQ(decoded, vertices);
+    EXPECT_LT(encoded.size(), vertices.size() * sizeof(float));
+}
+
+TEST(MeshCodec, RoundTripsIndices) {
+    auto indices = std::vector<uint32_t> {};
+    for (auto i = 0u; i < 10000; ++i) indices.insert(indices.end(), {i, i + 1, i + 2});
+    const auto [encoded, decoded] = RoundTrip(indices, 1);
+
+    EXPECT_EQ(decoded, indices);
+    EXPECT_LT(encoded.size(), indices.size() * sizeof(uint32_t) / 4);
+}
+
+TEST(MeshCodec, RoundTripsIncompressibleData) {
+    auto data = std::vector<uint32_t>(4096);
+    auto state = uint32_t {2463534242};
+    for (auto& word : data) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        word = state;
+    }
+
+    EXPECT_EQ(RoundTrip(data, 4).second, data);
+}
+
+TEST(MeshCodec, RoundTripsSmallStreams) {
+    EXPECT_EQ(RoundTrip(std::vector<uint32_t> {}, 1).second, std::vector<uint32_t> {});
+    EXPECT_EQ(RoundTrip(std::vector<uint32_t> {42}, 1).second, std::vector<uint32_t> {42});
+    EXPECT_EQ(RoundTrip(MakeVertices(1), 8).second, MakeVertices(1));
+}
+
+#pragma endregion
+
+#pragma region Validation
+
+TEST(MeshCodec, RejectsTruncatedStream) {
+    const auto vertices = MakeVertices(256);
+    auto encoded = gleam::encode_mesh_stream(std::as_bytes(std::span {vertices}), 8);
+    encoded.resize(encoded.size() / 2);
+
+    auto decoded = std::vector<float>(vertices.size());
+    EXPECT_FALSE(gleam::decode_mesh_stream(encoded, std::as_writable_bytes(std::span {decoded}), 8));
+}
+
+TEST(MeshCodec, RejectsCorruptStream) {
+    const auto vertices = MakeVertices(256);
+    const auto encoded = gleam::encode_mesh_stream(std::as_bytes(std::span {vertices}), 8);
+    auto decoded = std::vector<float>(vertices.size());
+
+    // Every single-byte corruption is either rejected or decodes in bounds.
+    for (auto i = std::size_t {0}; i < encoded.size(); ++i) {
+        auto corrupt = encoded;
+        corrupt[i] ^= std::byte {0xFF};
+        static_cast<void>(gleam::decode_mesh_stream(corrupt, std::as_writable_bytes(std::span {decoded}), 8));
+    }
+
+    auto garbage = std::vector<std::byte>(64, std::byte {0xFF});
+    EXPECT_FALSE(gleam::decode_mesh_stream(garbage, std::as_writable_bytes(std::span {decoded}), 8));
+}
+
+TEST(MeshCodec, RejectsMismatchedSize) {
+    const auto vertices = MakeVertices(16);
+    const auto encoded = gleam::encode_mesh_stream(std::as_bytes(std::span {vertices}), 8);
+
+    auto larger = std::vector<float>(vertices.size() + 8);
+    auto partial = std::vector<float>(vertices.size() + 1);
+    auto decoded = std::vector<float>(vertices.size());
+    EXPECT_FALSE(gleam::decode_mesh_stream(encoded, std::as_writable_bytes(std::span {larger}), 8));
+    EXPECT_FALSE(gleam::decode_mesh_stream(encoded, std::as_writable_bytes(std::span {partial}), 8));
+    EXPECT_FALSE(gleam::decode_mesh_stream(encoded, std::as_writable_bytes(std::span {decoded}), 0));
+}
+
+#pragma endregion
\ No newline at end of file
@@ -9,10 +9,23 @@
 
 #include <gleam/core/geometry.hpp>
 #include <gleam/loaders/mesh_loader.hpp>
+#include <gleam/materials/phong_material.hpp>
 #include <gleam/nodes/mesh.hpp>
 
+#include "asset_builder/include/types.hpp"
+#include "utilities/mesh_codec.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <future>
+#include <span>
+#include <string>
 #include <thread>
+#include <vector>
 
 const auto mesh_loader = gleam::MeshLoader::Create();
 
@@ -45,6 +58,114 @@ auto VerifyMesh(std::shared_ptr<gleam::Node> root) {
     }
 }
 
+auto WriteTexturedMesh(const std::filesystem::path& path, uint32_t mesh_count) {
+    auto file = std::ofstream {path, std::ios::binary};
+    auto header = MeshHeader {};
+    std::memcpy(header.magic, "MES0", 4);
+    header.version = 1;
+    header.header_size = sizeof(MeshHeader);
+    header.material_count = mesh_count;
+    header.mesh_count = mesh_count;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (auto i = uint32_t {0}; i < mesh_count; ++i) {
+        auto material = MaterialEntryHeader {};
+        std::strcpy(material.texture, "texture.tex");
+        file.write(reinterpret_cast<const char*>(&material), sizeof(material));
+    }
+
+    const auto indices = std::vector<unsigned int> {0, 1, 2};
+    for (auto i = uint32_t {0}; i < mesh_count; ++i) {
+        const auto vertices = std::vector<float>(3 * 8, static_cast<float>(i));
+        auto entry = MeshEntryHeader {};
+        entry.vertex_count = 3;
+        entry.index_count = 3;
+        entry.vertex_stride = 8;
+        entry.material_index = i;
+        entry.vertex_data_size = vertices.size() * sizeof(float);
+        entry.index_data_size = indices.size() * sizeof(unsigned int);
+        entry.vertex_flags = Positions | Normals | UVs;
+        file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+        file.write(reinterpret_cast<const char*>(vertices.data()), entry.vertex_data_size);
+        file.write(reinterpret_cast<const char*>(indices.data()), entry.index_data_size);
+    }
+}
+
+auto WriteCompressedMesh(
+    const std::filesystem::path& path,
+    const std::vector<float>& vertices,
+    const std::vector<unsigned int>& indices
+) {
+    auto file = std::ofstream {path, std::ios::binary};
+    auto header = MeshHeader {};
+    std::memcpy(header.magic, "MES0", 4);
+    header.version = 2;
+    header.header_size = sizeof(MeshHeader);
+    header.material_count = 0;
+    header.mesh_count = 1;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    auto entry = MeshEntryHeader {};
+    entry.vertex_count = static_cast<uint32_t>(vertices.size() / 8);
+    entry.index_count = static_cast<uint32_t>(indices.size());
+    entry.vertex_stride = 8;
+    entry.material_index = -1;
+    entry.vertex_data_size = vertices.size() * sizeof(float);
+    entry.index_data_size = indices.size() * sizeof(unsigned int);
+    entry.vertex_flags = Positions | Normals | UVs;
+    file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+
+    const auto vertex_stream = gleam::encode_mesh_stream(std::as_bytes(std::span {vertices}), 8);
+    const auto index_stream = gleam::encode_mesh_stream(std::as_bytes(std::span {indices}), 1);
+    auto streams = MeshStreamHeader {};
+    streams.codec = DeltaPlaneLZ;
+    streams.vertex_stream_size = vertex_stream.size();
+    streams.index_stream_size = index_stream.size();
+    file.write(reinterpret_cast<const char*>(&streams), sizeof(streams));
+    file.write(reinterpret_cast<const char*>(vertex_stream.data()), vertex_stream.size());
+    file.write(reinterpret_cast<const char*>(index_stream.data()), index_stream.size());
+}
+
+template <typename Predicate>
+auto DispatchUntil(
+    Predicate predicate,
+    std::chrono::milliseconds timeout,
+    std::size_t max_per_dispatch = SIZE_MAX
+) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+        EXPECT_LE(gleam::LoadQueue::Get().DispatchCallbacks(), max_per_dispatch);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return predicate();
+}
+
+auto TextureOf(const std::shared_ptr<gleam::Node>& root, std::size_t child) {
+    auto mesh = static_cast<gleam::Mesh*>(root->Children()[child].get());
+    return static_cast<gleam::PhongMaterial*>(mesh->material.get())->texture_map;
+}
+
+// Streamed files are written to a directory of their own, with the texture
+// they reference, so tests running in parallel don't share them.
+class MeshLoaderStreamingTest : public ::testing::Test {
+protected:
+    std::filesystem::path directory;
+    std::filesystem::path path;
+
+    auto SetUp() -> void override {
+        const auto name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        directory = std::filesystem::temp_directory_path() / (std::string {"gleam_mesh_loader_"} + name);
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        std::filesystem::copy_file("assets/texture.tex", directory / "texture.tex");
+        path = directory / "streamed.msh";
+    }
+
+    auto TearDown() -> void override {
+        std::filesystem::remove_all(directory);
+    }
+};
+
 #pragma endregion
 
 #pragma region Load Mesh Synchronously
@@ -54,6 +175,94 @@ TEST(MeshLoader, LoadMeshSynchronous) {
     VerifyMesh(result.value());
 }
 
+TEST(MeshLoader, LoadMeshViewsMappedFile) {
+    auto result = mesh_loader->Load("assets/plane.msh");
+    ASSERT_TRUE(result);
+
+    auto mesh = static_cast<gleam::Mesh*>(result.value()->Children()[0].get());
+    auto& geometry = mesh->geometry;
+    EXPECT_TRUE(geometry->IsExternal());
+    EXPECT_EQ(geometry->VertexData().size(), geometry->VertexCount() * geometry->Stride());
+
+    const auto bounds = geometry->BoundingSphere();
+    geometry->ReleaseData();
+
+    EXPECT_TRUE(geometry->VertexData().empty());
+    EXPECT_EQ(geometry->VertexCount(), 4);
+    EXPECT_EQ(geometry->IndexCount(), 6);
+    EXPECT_FLOAT_EQ(geometry->BoundingSphere().radius, bounds.radius);
+
+    EXPECT_EQ(geometry->residency, gleam::ResidencyPolicy::Keep);
+    EXPECT_TRUE(geometry->Reload());
+    EXPECT_EQ(geometry->VertexData().size(), geometry->VertexCount() * geometry->Stride());
+    EXPECT_EQ(geometry->IndexData().size(), 6);
+}
+
+TEST(MeshLoader, LoadMeshReloadsEntriesOnDemand) {
+    WriteTexturedMesh("assets/reloaded.msh", 3);
+    const auto loader = gleam::MeshLoader::Create({.residency = gleam::ResidencyPolicy::ReloadOnDemand});
+    auto result = loader->Load("assets/reloaded.msh");
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result.value()->Children().size(), 3);
+
+    for (auto i = std::size_t {0}; i < 3; ++i) {
+        auto mesh = static_cast<gleam::Mesh*>(result.value()->Children()[i].get());
+        auto& geometry = mesh->geometry;
+        EXPECT_EQ(geometry->residency, gleam::ResidencyPolicy::ReloadOnDemand);
+
+        geometry->ReleaseData();
+        EXPECT_TRUE(geometry->Reload());
+        EXPECT_EQ(geometry->VertexData().size(), 3 * 8);
+        EXPECT_EQ(geometry->VertexData()[0], static_cast<float>(i));
+    }
+
+    std::filesystem::remove("assets/reloaded.msh");
+}
+
+TEST(MeshLoader, LoadMeshSharesTextures) {
+    WriteTexturedMesh("assets/textured_a.msh", 2);
+    WriteTexturedMesh("assets/textured_b.msh", 1);
+
+    auto a = mesh_loader->Load("assets/textured_a.msh");
+    auto b = mesh_loader->Load("assets/textured_b.msh");
+    ASSERT_TRUE(a);
+    ASSERT_TRUE(b);
+
+    const auto texture = TextureOf(a.value(), 0);
+    ASSERT_NE(texture, nullptr);
+    EXPECT_EQ(texture->width, 5);
+    EXPECT_EQ(TextureOf(a.value(), 1), texture);
+    EXPECT_EQ(TextureOf(b.value(), 0), texture);
+
+    std::filesystem::remove("assets/textured_a.msh");
+    std::filesystem::remove("assets/textured_b.msh");
+}
+
+TEST(MeshLoader, LoadMeshDecodesCompressedStreams) {
+    auto vertices = std::vector<float> {};
+    auto indices = std::vector<unsigned int> {};
+    for (auto i = 0; i < 64; ++i) {
+        const auto x = static_cast<float>(i);
+        vertices.insert(vertices.end(), {x, 0.0f, x * 0.5f, 0.0f, 1.0f, 0.0f, x / 64.0f, 0.0f});
+        indices.insert(indices.end(), {0u, static_cast<unsigned>(i), static_cast<unsigned>((i + 1) % 64)});
+    }
+    WriteCompressedMesh("assets/compressed.msh", vertices, indices);
+
+    auto result = mesh_loader->Load("assets/compressed.msh");
+    ASSERT_TRUE(result);
+
+    auto mesh = static_cast<gleam::Mesh*>(result.value()->Children()[0].get());
+    auto& geometry = mesh->geometry;
+    EXPECT_TRUE(std::ranges::equal(geometry->VertexData(), vertices));
+    EXPECT_TRUE(std::ranges::equal(geometry->IndexData(), indices));
+
+    geometry->ReleaseData();
+    EXPECT_TRUE(geometry->Reload());
+    EXPECT_TRUE(std::ranges::equal(geometry->VertexData(), vertices));
+
+    std::filesystem::remove("assets/compressed.msh");
+}
+
 TEST(MeshLoader, LoadMeshSynchronousInvalidFileType) {
     auto result = mesh_loader->Load("assets/plane.obj");
     EXPECT_FALSE(result);
@@ -85,4 +294,75 @@ TEST(MeshLoader, LoadMeshAsynchronousInvalidFileType) {
     });
 }
 
+#pragma endregion
+
+#pragma region Load Mesh Streaming
+
+TEST_F(MeshLoaderStreamingTest, LoadMeshStreamingAttachesEntries) {
+    WriteTexturedMesh(path, 6);
+
+    auto progress = std::vector<std::size_t> {};
+    auto completed = false;
+    auto result = mesh_loader->LoadStreaming(path, {
+        .max_in_flight = 2,
+        .on_progress = [&](const auto& p) {
+            EXPECT_EQ(p.total, 6);
+            EXPECT_NE(p.mesh, nullptr);
+            progress.push_back(p.loaded);
+        },
+        .on_complete = [&]() { completed = true; }
+    });
+    ASSERT_TRUE(result);
+
+    // Entries are only attached on the main thread.
+    const auto root = result.value();
+    EXPECT_TRUE(root->Children().empty());
+
+    // At most two entries and the texture are waiting in each dispatch.
+    EXPECT_TRUE(DispatchUntil([&]() { return completed; }, std::chrono::seconds(2), 3));
+    EXPECT_EQ(progress, (std::vector<std::size_t> {1, 2, 3, 4, 5, 6}));
+    ASSERT_EQ(root->Children().size(), 6);
+    EXPECT_NE(TextureOf(root, 0), nullptr);
+    EXPECT_EQ(TextureOf(root, 5), TextureOf(root, 0));
+}
+
+TEST_F(MeshLoaderStreamingTest, LoadMeshStreamingCompletesEmptyFile) {
+    WriteTexturedMesh(path, 0);
+
+    auto completed = false;
+    auto result = mesh_loader->LoadStreaming(path, {
+        .on_complete = [&]() { completed = true; }
+    });
+    ASSERT_TRUE(result);
+
+    EXPECT_TRUE(DispatchUntil([&]() { return completed; }, std::chrono::seconds(1)));
+    EXPECT_TRUE(result.value()->Children().empty());
+}
+
+TEST_F(MeshLoaderStreamingTest, LoadMeshStreamingCancelled) {
+    WriteTexturedMesh(path, 4);
+
+    auto token = gleam::CancellationToken {};
+    auto attached = std::size_t {0};
+    auto result = mesh_loader->LoadStreaming(path, {
+        .token = token,
+        .on_progress = [&](const auto&) { ++attached; }
+    });
+    ASSERT_TRUE(result);
+    token.Cancel();
+
+    EXPECT_FALSE(DispatchUntil([&]() { return attached > 0; }, std::chrono::milliseconds(100)));
+    EXPECT_TRUE(result.value()->Children().empty());
+}
+
+TEST(MeshLoader, LoadMeshStreamingInvalidFile) {
+    auto missing = mesh_loader->LoadStreaming("assets/invalid_plane.msh");
+    ASSERT_FALSE(missing);
+    EXPECT_EQ(missing.error(), "File not found 'assets/invalid_plane.msh'");
+
+    auto invalid = mesh_loader->LoadStreaming("assets/plane.obj");
+    ASSERT_FALSE(invalid);
+    EXPECT_EQ(invalid.error(), "Invalid mesh file 'assets/plane.obj'");
+}
+
 #pragma endregion
\ No newline at end of file
@@ -0,0 +1,61 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "loaders/texture_cache.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#pragma region Requests
+
+TEST(TextureCache, RequestLoadsTexture) {
+    auto texture = gleam::TextureCache::Get().Request("assets/texture.tex")->Get();
+
+    ASSERT_NE(texture, nullptr);
+    EXPECT_EQ(texture->width, 5);
+    EXPECT_EQ(texture->height, 5);
+}
+
+TEST(TextureCache, RequestMissingTextureReturnsNull) {
+    EXPECT_EQ(gleam::TextureCache::Get().Request("assets/missing.tex")->Get(), nullptr);
+}
+
+TEST(TextureCache, RequestsShareLiveTextures) {
+    auto& cache = gleam::TextureCache::Get();
+    auto texture = cache.Request("assets/texture.tex")->Get();
+
+    EXPECT_EQ(cache.Request("assets/texture.tex")->Get(), texture);
+    EXPECT_EQ(cache.Request("assets/../assets/texture.tex")->Get(), texture);
+}
+
+TEST(TextureCache, TryGetReturnsCachedTexture) {
+    auto& cache = gleam::TextureCache::Get();
+    auto texture = cache.Request("assets/texture.tex")->Get();
+
+    EXPECT_EQ(cache.Request("assets/texture.tex")->TryGet(), texture);
+}
+
+TEST(TextureCache, ConcurrentRequestsShareLoad) {
+    auto& cache = gleam::TextureCache::Get();
+    auto textures = std::vector<std::shared_ptr<gleam::Texture2D>>(8);
+    auto threads = std::vector<std::thread> {};
+
+    for (auto i = 0; i < textures.size(); ++i) {
+        threads.emplace_back([&, i] {
+            textures[i] = cache.Request("assets/texture.tex")->Get();
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    ASSERT_NE(textures[0], nullptr);
+    for (const auto& texture : textures) EXPECT_EQ(texture, textures[0]);
+}
+
+#pragma endregion
\ No newline at end of file
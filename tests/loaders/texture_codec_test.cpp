@@ -0,0 +1,147 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include "utilities/texture_codec.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using gleam::BlockFormat;
+using gleam::BlockQuality;
+
+#pragma region Helpers
+
+// Smooth gradients with a sharper pattern on top, and alpha that varies
+// independently of the color.
+auto MakeImage(uint32_t width, uint32_t height) {
+    auto rgba = std::vector<uint8_t> {};
+    for (auto y = 0u; y < height; ++y) {
+        for (auto x = 0u; x < width; ++x) {
+            const auto u = static_cast<float>(x) / static_cast<float>(width);
+            const auto v = static_cast<float>(y) / static_cast<float>(height);
+            const auto ripple = 0.5f + 0.5f * std::sin((u + v) * 20.0f);
+            rgba.insert(rgba.end(), {
+                static_cast<uint8_t>(255.0f * u),
+                static_cast<uint8_t>(255.0f * (0.3f + 0.7f * ripple * v)),
+                static_cast<uint8_t>(255.0f * (1.0f - u) * (1.0f - v)),
+                static_cast<uint8_t>(255.0f * (0.5f + 0.5f * std::cos(v * 9.0f)))
+            });
+        }
+    }
+    return rgba;
+}
+
+auto Psnr(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, int channels) {
+    auto sum = 0.0;
+    auto count = std::size_t {0};
+    for (auto i = std::size_t {0}; i < a.size(); i += 4) {
+        for (auto c = 0; c < channels; ++c, ++count) {
+            const auto d = static_cast<double>(a[i + c]) - static_cast<double>(b[i + c]);
+            sum += d * d;
+        }
+    }
+    const auto mse = sum / static_cast<double>(count);
+    return mse == 0.0 ? 100.0 : 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+auto RoundTripPsnr(BlockFormat format, BlockQuality quality, int channels) {
+    const auto image = MakeImage(64, 64);
+    const auto blocks = gleam::encode_blocks(image, 64, 64, format, quality);
+    EXPECT_EQ(blocks.size(), 16 * 16 * gleam::block_size(format));
+
+    const auto decoded = gleam::decode_blocks(blocks, 64, 64, format);
+    EXPECT_EQ(decoded.size(), image.size());
+    return Psnr(image, decoded, channels);
+}
+
+#pragma endregion
+
+#pragma region Quality
+
+TEST(TextureCodec, BC1MatchesSourceColor) {
+    const auto fast = RoundTripPsnr(BlockFormat::BC1, BlockQuality::Fast, 3);
+    const auto high = RoundTripPsnr(BlockFormat::BC1, BlockQuality::High, 3);
+
+    EXPECT_GT(fast, 31.0);
+    EXPECT_GT(high, 34.0);
+    EXPECT_GE(high, fast);
+}
+
+TEST(TextureCodec, BC3MatchesSourceColorAndAlpha) {
+    const auto fast = RoundTripPsnr(BlockFormat::BC3, BlockQuality::Fast, 4);
+    const auto high = RoundTripPsnr(BlockFormat::BC3, BlockQuality::High, 4);
+
+    EXPECT_GT(fast, 32.0);
+    EXPECT_GT(high, 35.0);
+    EXPECT_GE(high, fast);
+}
+
+TEST(TextureCodec, BC7MatchesSourceColorAndAlpha) {
+    const auto fast = RoundTripPsnr(BlockFormat::BC7, BlockQuality::Fast, 4);
+    const auto high = RoundTripPsnr(BlockFormat::BC7, BlockQuality::High, 4);
+    const auto bc3 = RoundTripPsnr(BlockFormat::BC3, BlockQuality::High, 4);
+
+    EXPECT_GT(fast, 33.0);
+    EXPECT_GT(high, 37.0);
+    EXPECT_GT(high, bc3);
+}
+
+#pragma endregion
+
+#pragma region Layout
+
+TEST(TextureCodec, EncodesSolidBlocksExactly) {
+    const auto image = std::vector<uint8_t>(4 * 4 * 4, 0);
+    for (const auto format : {BlockFormat::BC1, BlockFormat::BC3, BlockFormat::BC7}) {
+        const auto blocks = gleam::encode_blocks(image, 4, 4, format, BlockQuality::High);
+        auto expected = image;
+        if (format == BlockFormat::BC1) {
+            // BC1 has no alpha channel and decodes as opaque.
+            for (auto i = std::size_t {3}; i < expected.size(); i += 4) expected[i] = 255;
+        }
+        EXPECT_EQ(gleam::decode_blocks(blocks, 4, 4, format), expected);
+    }
+}
+
+TEST(TextureCodec, PadsPartialBlocks) {
+    const auto image = MakeImage(5, 3);
+
+    // The same texels with the last row and column repeated out to whole blocks.
+    auto padded = std::vector<uint8_t> {};
+    for (auto y = 0u; y < 4; ++y) {
+        for (auto x = 0u; x < 8; ++x) {
+            const auto offset = (std::min(y, 2u) * 5 + std::min(x, 4u)) * 4;
+            padded.insert(padded.end(), image.begin() + offset, image.begin() + offset + 4);
+        }
+    }
+
+    const auto blocks = gleam::encode_blocks(image, 5, 3, BlockFormat::BC7, BlockQuality::High);
+    EXPECT_EQ(blocks, gleam::encode_blocks(padded, 8, 4, BlockFormat::BC7, BlockQuality::High));
+
+    const auto decoded = gleam::decode_blocks(blocks, 5, 3, BlockFormat::BC7);
+    const auto decoded_padded = gleam::decode_blocks(blocks, 8, 4, BlockFormat::BC7);
+    ASSERT_EQ(decoded.size(), image.size());
+    for (auto y = 0u; y < 3; ++y) {
+        for (auto i = 0u; i < 5 * 4; ++i) {
+            EXPECT_EQ(decoded[y * 5 * 4 + i], decoded_padded[y * 8 * 4 + i]);
+        }
+    }
+}
+
+TEST(TextureCodec, RejectsTruncatedBlocks) {
+    const auto blocks = std::vector<uint8_t>(15, 0);
+
+    EXPECT_TRUE(gleam::decode_blocks(blocks, 4, 4, BlockFormat::BC7).empty());
+    EXPECT_TRUE(gleam::decode_blocks(blocks, 8, 4, BlockFormat::BC1).empty());
+}
+
+#pragma endregion
\ No newline at end of file
@@ -9,8 +9,14 @@
 
 #include <gleam/loaders/texture_loader.hpp>
 
+#include "asset_builder/include/types.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <future>
 #include <thread>
+#include <vector>
 
 const auto texture_loader = gleam::TextureLoader::Create();
 
@@ -37,6 +43,29 @@ auto VerifyImage(const auto& texture, const std::string& filename) {
     EXPECT_EQ(texture->height, 5);
 }
 
+auto WriteTexture(
+    const std::filesystem::path& path,
+    uint32_t mip_levels,
+    uint64_t pixel_data_size,
+    uint32_t format = TextureFormat::RGBA8
+) {
+    auto header = TextureHeader {};
+    std::memcpy(header.magic, "TEX0", 4);
+    header.version = 1;
+    header.header_size = sizeof(TextureHeader);
+    header.width = 4;
+    header.height = 2;
+    header.format = format;
+    header.mip_levels = mip_levels;
+    header.pixel_data_size = pixel_data_size;
+
+    auto pixels = std::vector<char>(pixel_data_size);
+    for (auto i = std::size_t {0}; i < pixels.size(); ++i) pixels[i] = static_cast<char>(i);
+    auto file = std::ofstream {path, std::ios::binary};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(pixels.data(), pixels.size());
+}
+
 #pragma endregion
 
 #pragma region Load Image Synchronously
@@ -46,6 +75,87 @@ TEST(TextureLoader, LoadTextureSynchronous) {
     VerifyImage(result.value(), "texture.tex");
 }
 
+TEST(TextureLoader, ReloadTextureAfterRelease) {
+    auto texture = texture_loader->Load("assets/texture.tex").value();
+    const auto pixels = texture->data;
+
+    texture->ReleaseData();
+    EXPECT_TRUE(texture->IsReleased());
+    EXPECT_TRUE(texture->data.empty());
+    EXPECT_EQ(texture->width, 5);
+
+    EXPECT_TRUE(texture->Reload());
+    EXPECT_FALSE(texture->IsReleased());
+    EXPECT_EQ(texture->data, pixels);
+}
+
+TEST(TextureLoader, LoadTextureMipChain) {
+    // 4x2, 2x1 and 1x1 levels.
+    WriteTexture("assets/mipmapped.tex", 3, (8 + 2 + 1) * 4);
+
+    auto result = texture_loader->Load("assets/mipmapped.tex");
+    ASSERT_TRUE(result);
+    auto texture = result.value();
+    EXPECT_EQ(texture->mip_levels, 3);
+    EXPECT_EQ(texture->LevelWidth(1), 2);
+    EXPECT_EQ(texture->LevelHeight(1), 1);
+    EXPECT_EQ(texture->LevelWidth(2), 1);
+    EXPECT_EQ(texture->data.size(), 44);
+    EXPECT_EQ(texture->DataSize(), 44);
+    EXPECT_EQ(texture->data.back(), 43);
+
+    texture->ReleaseData();
+    EXPECT_TRUE(texture->Reload());
+    EXPECT_EQ(texture->data.size(), 44);
+
+    std::filesystem::remove("assets/mipmapped.tex");
+}
+
+TEST(TextureLoader, LoadTextureInvalidMipChain) {
+    WriteTexture("assets/mipmapped.tex", 3, 8 * 4);
+    auto result = texture_loader->Load("assets/mipmapped.tex");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), "Texture has inconsistent data size in file 'assets/mipmapped.tex'");
+
+    WriteTexture("assets/mipmapped.tex", 4, (8 + 2 + 1 + 1) * 4);
+    result = texture_loader->Load("assets/mipmapped.tex");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), "Invalid mip levels in texture file 'assets/mipmapped.tex'");
+
+    std::filesystem::remove("assets/mipmapped.tex");
+}
+
+TEST(TextureLoader, LoadBlockCompressedTexture) {
+    // Every level of a 4x2 texture fits in a single 4x4 block.
+    WriteTexture("assets/compressed.tex", 3, 3 * 8, TextureFormat::BC1);
+
+    auto result = texture_loader->Load("assets/compressed.tex");
+    ASSERT_TRUE(result);
+    auto texture = result.value();
+    EXPECT_EQ(texture->format, gleam::TextureFormat::BC1);
+    EXPECT_EQ(texture->LevelSize(0), 8);
+    EXPECT_EQ(texture->DataSize(), 24);
+    EXPECT_EQ(texture->data.size(), 24);
+
+    WriteTexture("assets/compressed.tex", 3, 3 * 16, TextureFormat::BC7);
+    result = texture_loader->Load("assets/compressed.tex");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.value()->format, gleam::TextureFormat::BC7);
+    EXPECT_EQ(result.value()->DataSize(), 48);
+
+    WriteTexture("assets/compressed.tex", 1, 8 * 4, TextureFormat::BC3);
+    result = texture_loader->Load("assets/compressed.tex");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), "Texture has inconsistent data size in file 'assets/compressed.tex'");
+
+    WriteTexture("assets/compressed.tex", 1, 8 * 4, 42);
+    result = texture_loader->Load("assets/compressed.tex");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), "Unsupported texture format in file 'assets/compressed.tex'");
+
+    std::filesystem::remove("assets/compressed.tex");
+}
+
 TEST(TextureLoader, LoadTextureSynchronousInvalidFileType) {
     auto result = texture_loader->Load("assets/texture.png");
     EXPECT_FALSE(result);
@@ -77,4 +187,79 @@ TEST(TextureLoader, LoadTextureAsynchronousInvalidFileType) {
     });
 }
 
+#pragma endregion
+
+#pragma region Load Options
+
+TEST(TextureLoader, LoadTextureAsynchronousHandle) {
+    auto handle = texture_loader->LoadAsync("assets/texture.tex", {.priority = gleam::LoadPriority::High});
+
+    ASSERT_TRUE(handle.IsValid());
+    const auto& result = handle.Get();
+    ASSERT_TRUE(result);
+    VerifyImage(result.value(), "texture.tex");
+    EXPECT_TRUE(handle.IsReady());
+}
+
+TEST(TextureLoader, LoadTextureAsynchronousFileNotFound) {
+    auto handle = texture_loader->LoadAsync("assets/missing.tex");
+
+    const auto& result = handle.Get();
+    EXPECT_FALSE(result);
+    EXPECT_EQ(result.error(), "File not found 'assets/missing.tex'");
+}
+
+TEST(TextureLoader, LoadTextureAsynchronousCancelled) {
+    auto token = gleam::CancellationToken {};
+    auto called = false;
+    token.Cancel();
+
+    auto handle = texture_loader->LoadAsync(
+        "assets/texture.tex",
+        [&](const auto&) { called = true; },
+        {.token = token}
+    );
+
+    const auto& result = handle.Get();
+    EXPECT_TRUE(handle.IsCancelled());
+    EXPECT_FALSE(result);
+    EXPECT_EQ(result.error(), "Load cancelled 'assets/texture.tex'");
+    EXPECT_FALSE(called);
+}
+
+TEST(TextureLoader, LoadTextureAsynchronousOnMainThread) {
+    auto main_thread_id = std::this_thread::get_id();
+    auto callback_thread_id = std::thread::id {};
+    auto handle = texture_loader->LoadAsync(
+        "assets/texture.tex",
+        [&](const auto& result) {
+            VerifyImage(result.value(), "texture.tex");
+            callback_thread_id = std::this_thread::get_id();
+        },
+        {.deliver_on_main_thread = true}
+    );
+
+    handle.Wait();
+    EXPECT_EQ(callback_thread_id, std::thread::id {});
+
+    EXPECT_EQ(gleam::LoadQueue::Get().DispatchCallbacks(), 1);
+    EXPECT_EQ(callback_thread_id, main_thread_id);
+}
+
+TEST(TextureLoader, LoadTextureAsynchronousCancelledBeforeDispatch) {
+    auto called = false;
+    auto handle = texture_loader->LoadAsync(
+        "assets/texture.tex",
+        [&](const auto&) { called = true; },
+        {.deliver_on_main_thread = true}
+    );
+
+    handle.Wait();
+    handle.Cancel();
+    EXPECT_TRUE(handle.Get());
+
+    gleam::LoadQueue::Get().DispatchCallbacks();
+    EXPECT_FALSE(called);
+}
+
 #pragma endregion
\ No newline at end of file
@@ -9,6 +9,8 @@
 
 #include <cassert>
 #include <regex>
+#include <set>
+#include <unordered_set>
 
 #include <gleam/math/utilities.hpp>
 
@@ -91,4 +93,21 @@ TEST(MathUtilities, UUIDUniqueness) {
     }
 }
 
+TEST(MathUtilities, UUIDToStringFormat) {
+    static const std::regex e("^[0-9a-f]{8}-[0-9a-f]{4}-4[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}$");
+    EXPECT_TRUE(std::regex_match(math::UUID::Generate().ToString(), e));
+}
+
+TEST(MathUtilities, UUIDToStringLeadingZeros) {
+    const auto uuid = math::UUID {0x0000000100024003ULL, 0x8004000000000005ULL};
+    EXPECT_EQ(uuid.ToString(), "00000001-0002-4003-8004-000000000005");
+}
+
+TEST(MathUtilities, UUIDAsHashKey) {
+    std::unordered_set<math::UUID> uuids;
+    for (auto i = 0; i < 1000; i++) {
+        EXPECT_TRUE(uuids.emplace(math::UUID::Generate()).second);
+    }
+}
+
 #pragma endregion
\ No newline at end of file
@@ -0,0 +1,376 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <gleam/cameras/perspective_camera.hpp>
+#include <gleam/core/renderer.hpp>
+#include <gleam/core/geometry.hpp>
+#include <gleam/geometries/box_geometry.hpp>
+#include <gleam/materials/flat_material.hpp>
+#include <gleam/math/utilities.hpp>
+#include <gleam/nodes/mesh.hpp>
+#include <gleam/nodes/scene.hpp>
+#include <gleam/textures/texture_2d.hpp>
+
+#include "core/headless_context.hpp"
+#include "utilities/texture_codec.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr auto kWidth = 64;
+constexpr auto kHeight = 48;
+
+auto pixel_at(const std::vector<uint8_t>& pixels, int x, int y) {
+    const auto offset = (static_cast<std::size_t>(y) * kWidth + x) * 4;
+    return std::vector<uint8_t>(pixels.begin() + offset, pixels.begin() + offset + 4);
+}
+
+}
+
+class HeadlessRendererTest : public ::testing::Test {
+protected:
+    gleam::HeadlessContext context;
+    std::unique_ptr<gleam::Renderer> renderer;
+    std::shared_ptr<gleam::Scene> scene;
+    std::shared_ptr<gleam::PerspectiveCamera> camera;
+
+    auto SetUp() -> void override {
+        if (!context.IsValid()) GTEST_SKIP() << "No headless OpenGL context available";
+
+        renderer = std::make_unique<gleam::Renderer>(gleam::Renderer::Parameters {
+            .width = kWidth,
+            .height = kHeight,
+            .offscreen = true
+        });
+        scene = gleam::Scene::Create();
+        camera = gleam::PerspectiveCamera::Create({
+            .fov = gleam::math::DegToRad(60.0f),
+            .aspect = static_cast<float>(kWidth) / kHeight,
+            .near = 0.1f,
+            .far = 100.0f
+        });
+        camera->transform.Translate({0.0f, 0.0f, 3.0f});
+    }
+};
+
+#pragma region Offscreen Rendering
+
+TEST_F(HeadlessRendererTest, ReadPixelsReturnsClearColor) {
+    renderer->SetClearColor(0x00FF00);
+    renderer->Render(scene.get(), camera.get());
+
+    const auto pixels = renderer->ReadPixels();
+    ASSERT_EQ(pixels.size(), kWidth * kHeight * 4);
+    EXPECT_EQ(pixel_at(pixels, 0, 0), (std::vector<uint8_t> {0, 255, 0, 255}));
+    EXPECT_EQ(pixel_at(pixels, kWidth - 1, kHeight - 1), (std::vector<uint8_t> {0, 255, 0, 255}));
+}
+
+TEST_F(HeadlessRendererTest, RendersMeshIntoOffscreenFramebuffer) {
+    scene->Add(gleam::Mesh::Create(gleam::BoxGeometry::Create(), gleam::FlatMaterial::Create(0xFF0000)));
+
+    renderer->SetClearColor(0x0000FF);
+    renderer->Render(scene.get(), camera.get());
+
+    const auto pixels = renderer->ReadPixels();
+    EXPECT_EQ(renderer->RenderedObjectsPerFrame(), 1);
+    EXPECT_EQ(pixel_at(pixels, kWidth / 2, kHeight / 2), (std::vector<uint8_t> {255, 0, 0, 255}));
+    EXPECT_EQ(pixel_at(pixels, 0, 0), (std::vector<uint8_t> {0, 0, 255, 255}));
+}
+
+#pragma endregion
+
+#pragma region Pipelining
+
+TEST_F(HeadlessRendererTest, SubmitsMaterialsAsTheyWereWhenPrepared) {
+    auto material = gleam::FlatMaterial::Create(0xFF0000);
+    scene->Add(gleam::Mesh::Create(gleam::BoxGeometry::Create(), material));
+
+    renderer->Prepare(scene.get(), camera.get());
+    renderer->SwapSnapshots();
+    material->color = 0x00FF00;
+    renderer->Submit();
+    EXPECT_EQ(pixel_at(renderer->ReadPixels(), kWidth / 2, kHeight / 2), (std::vector<uint8_t> {255, 0, 0, 255}));
+
+    renderer->Prepare(scene.get(), camera.get());
+    renderer->SwapSnapshots();
+    renderer->Submit();
+    EXPECT_EQ(pixel_at(renderer->ReadPixels(), kWidth / 2, kHeight / 2), (std::vector<uint8_t> {0, 255, 0, 255}));
+}
+
+TEST_F(HeadlessRendererTest, AssignsUploadedResourcesWhenSnapshotsAreSwapped) {
+    auto geometry = gleam::BoxGeometry::Create();
+    auto material = gleam::FlatMaterial::Create(0xFFFFFF);
+    material->texture_map = gleam::Texture2D::Create({
+        .width = 1,
+        .height = 1,
+        .data = {255, 0, 0, 255}
+    });
+    scene->Add(gleam::Mesh::Create(geometry, material));
+
+    // The next frame may be prepared while this one is submitted, so the
+    // submission doesn't touch the resources it uploads.
+    renderer->Prepare(scene.get(), camera.get());
+    renderer->SwapSnapshots();
+    renderer->Submit();
+    EXPECT_EQ(renderer->Statistics().draw_calls, 1);
+    EXPECT_EQ(geometry->renderer_id, 0);
+    EXPECT_EQ(material->texture_map->renderer_id, 0);
+    EXPECT_EQ(pixel_at(renderer->ReadPixels(), kWidth / 2, kHeight / 2), (std::vector<uint8_t> {255, 0, 0, 255}));
+
+    renderer->Prepare(scene.get(), camera.get());
+    renderer->SwapSnapshots();
+    EXPECT_NE(geometry->renderer_id, 0);
+    EXPECT_NE(material->texture_map->renderer_id, 0);
+
+    renderer->Submit();
+    EXPECT_EQ(renderer->Statistics().buffer_bytes_uploaded, 0);
+    EXPECT_EQ(renderer->Statistics().texture_bytes_uploaded, 0);
+    EXPECT_EQ(pixel_at(renderer->ReadPixels(), kWidth / 2, kHeight / 2), (std::vector<uint8_t> {255, 0, 0, 255}));
+}
+
+#pragma endregion
+
+#pragma region GPU Timings
+
+TEST_F(HeadlessRendererTest, ReportsGPUTimingsAfterQueryLatency) {
+    scene->Add(gleam::Mesh::Create(gleam::BoxGeometry::Create(), gleam::FlatMaterial::Create(0xFF0000)));
+
+    renderer->Render(scene.get(), camera.get());
+    EXPECT_EQ(renderer->Statistics().gpu_frame_ms, 0.0);
+
+    // Reading pixels waits for the GPU, so the queries of every submitted
+    // frame are available by the time they're collected.
+    for (auto i = 0; i < 8; ++i) {
+        renderer->Render(scene.get(), camera.get());
+        static_cast<void>(renderer->ReadPixels());
+    }
+
+    const auto& statistics = renderer->Statistics();
+    EXPECT_GT(statistics.gpu_frame_ms, 0.0);
+    EXPECT_GE(
+        statistics.gpu_frame_ms + 1e-6,
+        statistics.gpu_clear_ms + statistics.gpu_opaque_ms + statistics.gpu_transparent_ms
+    );
+}
+
+#pragma endregion
+
+#pragma region Statistics
+
+TEST_F(HeadlessRendererTest, ReportsFrameCounters) {
+    auto geometry = gleam::BoxGeometry::Create();
+    auto material = gleam::FlatMaterial::Create(0xFF0000);
+    auto behind = gleam::Mesh::Create(geometry, material);
+    behind->transform.Translate({0.0f, 0.0f, 10.0f});
+    scene->Add(gleam::Mesh::Create(geometry, material));
+    scene->Add(behind);
+    scene->Add(gleam::Mesh::Create(gleam::Geometry::Create(), material));
+
+    renderer->Render(scene.get(), camera.get());
+
+    const auto geometry_bytes =
+        geometry->VertexData().size() * sizeof(float) +
+        geometry->IndexData().size() * sizeof(unsigned int);
+
+    auto statistics = renderer->Statistics();
+    EXPECT_EQ(statistics.draw_calls, 1);
+    EXPECT_EQ(statistics.instanced_draws, 0);
+    EXPECT_EQ(statistics.program_switches, 1);
+    EXPECT_EQ(statistics.vao_binds, 1);
+    EXPECT_GT(statistics.uniform_uploads, 0);
+    EXPECT_GT(statistics.ubo_bytes_uploaded, 0);
+    EXPECT_EQ(statistics.buffer_bytes_uploaded, geometry_bytes);
+    EXPECT_EQ(statistics.buffer_memory_bytes, geometry_bytes);
+    EXPECT_EQ(statistics.culled_frustum, 1);
+    EXPECT_EQ(statistics.culled_invalid_geometry, 1);
+    EXPECT_EQ(statistics.culled_invalid_program, 0);
+
+    // Nothing changed, so buffers and camera data aren't uploaded again.
+    renderer->Render(scene.get(), camera.get());
+
+    statistics = renderer->Statistics();
+    EXPECT_EQ(statistics.draw_calls, 1);
+    EXPECT_EQ(statistics.ubo_bytes_uploaded, 0);
+    EXPECT_EQ(statistics.buffer_bytes_uploaded, 0);
+    EXPECT_EQ(statistics.buffer_memory_bytes, geometry_bytes);
+
+    const auto average = renderer->AverageStatistics();
+    EXPECT_EQ(average.draw_calls, 1);
+    EXPECT_EQ(average.buffer_bytes_uploaded, (geometry_bytes + 1) / 2);
+}
+
+#pragma endregion
+
+#pragma region Residency
+
+TEST_F(HeadlessRendererTest, ReleasesDataAfterUploadByResidencyPolicy) {
+    auto kept = gleam::BoxGeometry::Create();
+    auto released = gleam::BoxGeometry::Create();
+    released->residency = gleam::ResidencyPolicy::ReleaseAfterUpload;
+    scene->Add(gleam::Mesh::Create(kept, gleam::FlatMaterial::Create(0xFF0000)));
+    scene->Add(gleam::Mesh::Create(released, gleam::FlatMaterial::Create(0xFF0000)));
+
+    const auto geometry_bytes =
+        kept->VertexData().size() * sizeof(float) +
+        kept->IndexData().size() * sizeof(unsigned int);
+
+    // Data uploaded by a frame is released when the next frame is swapped in.
+    renderer->Render(scene.get(), camera.get());
+    EXPECT_EQ(renderer->Statistics().geometry_cpu_memory_bytes, geometry_bytes * 2);
+    renderer->Render(scene.get(), camera.get());
+
+    EXPECT_FALSE(kept->IsReleased());
+    EXPECT_TRUE(released->IsReleased());
+    EXPECT_TRUE(released->VertexData().empty());
+    EXPECT_EQ(renderer->Statistics().draw_calls, 2);
+    EXPECT_EQ(renderer->Statistics().buffer_memory_bytes, geometry_bytes * 2);
+    EXPECT_EQ(renderer->Statistics().geometry_cpu_memory_bytes, geometry_bytes);
+}
+
+TEST_F(HeadlessRendererTest, ReloadsReleasedDataBeforeUpload) {
+    auto geometry = gleam::BoxGeometry::Create();
+    geometry->residency = gleam::ResidencyPolicy::ReloadOnDemand;
+    geometry->SetReloader([] { return gleam::BoxGeometry::Create(); });
+    geometry->ReleaseData();
+    scene->Add(gleam::Mesh::Create(geometry, gleam::FlatMaterial::Create(0xFF0000)));
+
+    // Data is reloaded when the snapshot is swapped in, before the submission.
+    renderer->Prepare(scene.get(), camera.get());
+    renderer->SwapSnapshots();
+    EXPECT_FALSE(geometry->IsReleased());
+
+    renderer->Submit();
+    EXPECT_EQ(renderer->Statistics().draw_calls, 1);
+    EXPECT_EQ(pixel_at(renderer->ReadPixels(), kWidth / 2, kHeight / 2), (std::vector<uint8_t> {255, 0, 0, 255}));
+}
+
+#pragma endregion
+
+#pragma region Uploads
+
+TEST_F(HeadlessRendererTest, UploadsResourcesWithinBudget) {
+    renderer = std::make_unique<gleam::Renderer>(gleam::Renderer::Parameters {
+        .width = kWidth,
+        .height = kHeight,
+        .upload_budget_bytes = 1,
+        .offscreen = true
+    });
+    camera->transform.SetPosition({0.0f, 0.0f, 5.0f});
+
+    auto near = gleam::BoxGeometry::Create();
+    auto far = gleam::BoxGeometry::Create();
+    auto culled = gleam::BoxGeometry::Create();
+    auto material = gleam::FlatMaterial::Create(0xFF0000);
+    auto far_mesh = gleam::Mesh::Create(far, material);
+    auto culled_mesh = gleam::Mesh::Create(culled, material);
+    far_mesh->transform.Translate({0.0f, 0.0f, -5.0f});
+    culled_mesh->transform.Translate({0.0f, 0.0f, 10.0f});
+    scene->Add(culled_mesh);
+    scene->Add(far_mesh);
+    scene->Add(gleam::Mesh::Create(near, material));
+
+    // The budget only fits a single upload per frame, nearest visible first.
+    renderer->Render(scene.get(), camera.get());
+    auto statistics = renderer->Statistics();
+    EXPECT_NE(near->renderer_id, 0);
+    EXPECT_EQ(far->renderer_id, 0);
+    EXPECT_EQ(statistics.draw_calls, 1);
+    EXPECT_EQ(statistics.culled_not_resident, 1);
+    EXPECT_EQ(statistics.uploads_deferred, 2);
+
+    renderer->Render(scene.get(), camera.get());
+    statistics = renderer->Statistics();
+    EXPECT_NE(far->renderer_id, 0);
+    EXPECT_EQ(culled->renderer_id, 0);
+    EXPECT_EQ(statistics.draw_calls, 2);
+    EXPECT_EQ(statistics.culled_not_resident, 0);
+    EXPECT_EQ(statistics.uploads_deferred, 1);
+
+    // Culled meshes are uploaded ahead of time once the visible ones are done.
+    renderer->Render(scene.get(), camera.get());
+    statistics = renderer->Statistics();
+    EXPECT_NE(culled->renderer_id, 0);
+    EXPECT_EQ(statistics.uploads_deferred, 0);
+}
+
+TEST_F(HeadlessRendererTest, SkipsUploadsOfInvalidGeometries) {
+    auto disposed = gleam::BoxGeometry::Create();
+    auto material = gleam::FlatMaterial::Create(0xFF0000);
+    scene->Add(gleam::Mesh::Create(disposed, material));
+    scene->Add(gleam::Mesh::Create(gleam::Geometry::Create(), material));
+    disposed->Dispose();
+
+    renderer->Render(scene.get(), camera.get());
+    const auto& statistics = renderer->Statistics();
+    EXPECT_EQ(disposed->renderer_id, 0);
+    EXPECT_EQ(statistics.culled_invalid_geometry, 2);
+    EXPECT_EQ(statistics.draw_calls, 0);
+    EXPECT_EQ(statistics.buffer_bytes_uploaded, 0);
+    EXPECT_EQ(statistics.buffer_memory_bytes, 0);
+    EXPECT_EQ(statistics.uploads_deferred, 0);
+}
+
+TEST_F(HeadlessRendererTest, UploadsEveryMipLevel) {
+    // 4x4, 2x2 and 1x1 levels.
+    auto texture = gleam::Texture2D::Create({
+        .width = 4,
+        .height = 4,
+        .data = std::vector<uint8_t>((16 + 4 + 1) * 4, 0xFF),
+        .mip_levels = 3
+    });
+    auto material = gleam::FlatMaterial::Create(0xFFFFFF);
+    material->texture_map = texture;
+    scene->Add(gleam::Mesh::Create(gleam::BoxGeometry::Create(), material));
+
+    renderer->Render(scene.get(), camera.get());
+    EXPECT_NE(texture->renderer_id, 0);
+    EXPECT_EQ(renderer->Statistics().texture_memory_bytes, texture->DataSize());
+    EXPECT_EQ(renderer->Statistics().texture_memory_bytes, 84);
+
+    const auto pixels = renderer->ReadPixels();
+    EXPECT_EQ(pixel_at(pixels, kWidth / 2, kHeight / 2), (std::vector<uint8_t> {255, 255, 255, 255}));
+}
+
+TEST_F(HeadlessRendererTest, UploadsBlockCompressedTexture) {
+    // 8x8, 4x4, 2x2 and 1x1 levels of white texels.
+    auto data = std::vector<uint8_t> {};
+    for (auto size = 8u; size > 0; size /= 2) {
+        const auto texels = std::vector<uint8_t>(size * size * 4, 0xFF);
+        const auto blocks = gleam::encode_blocks(texels, size, size, gleam::BlockFormat::BC7, gleam::BlockQuality::Fast);
+        data.insert(data.end(), blocks.begin(), blocks.end());
+    }
+    auto texture = gleam::Texture2D::Create({
+        .width = 8,
+        .height = 8,
+        .data = std::move(data),
+        .mip_levels = 4,
+        .format = gleam::TextureFormat::BC7
+    });
+    EXPECT_EQ(texture->DataSize(), (4 + 1 + 1 + 1) * 16);
+
+    auto material = gleam::FlatMaterial::Create(0xFFFFFF);
+    material->texture_map = texture;
+    scene->Add(gleam::Mesh::Create(gleam::BoxGeometry::Create(), material));
+
+    renderer->Render(scene.get(), camera.get());
+    EXPECT_NE(texture->renderer_id, 0);
+
+    // Drivers without BPTC support get the texture decompressed to RGBA8.
+    const auto memory = renderer->Statistics().texture_memory_bytes;
+    EXPECT_TRUE(memory == texture->DataSize() || memory == (64 + 16 + 4 + 1) * 4) << memory;
+
+    const auto pixels = renderer->ReadPixels();
+    EXPECT_EQ(pixel_at(pixels, kWidth / 2, kHeight / 2), (std::vector<uint8_t> {255, 255, 255, 255}));
+}
+
+#pragma endregion
\ No newline at end of file
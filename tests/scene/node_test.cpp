@@ -11,6 +11,18 @@
 #include <gleam/cameras/perspective_camera.hpp>
 #include <gleam/nodes/mesh.hpp>
 #include <gleam/nodes/node.hpp>
+#include <gleam/nodes/scene.hpp>
+
+#pragma region Helpers
+
+class AttachCounter : public gleam::Node {
+public:
+    int attached {0};
+
+    auto OnAttached() -> void override { attached++; }
+};
+
+#pragma endregion
 
 #pragma region Node Operations
 
@@ -46,6 +58,108 @@ TEST(Node, RemoveAllChildren) {
     EXPECT_TRUE(parent->Children().empty());
 }
 
+TEST(Node, AddChildren) {
+    auto parent = gleam::Node::Create();
+    auto child1 = gleam::Node::Create();
+    auto child2 = gleam::Node::Create();
+
+    parent->AddChildren({child1, child2});
+
+    EXPECT_EQ(parent->Children().size(), 2);
+    EXPECT_EQ(parent->Children()[0], child1);
+    EXPECT_EQ(parent->Children()[1], child2);
+    EXPECT_EQ(child1->Parent(), parent.get());
+    EXPECT_EQ(child2->Parent(), parent.get());
+}
+
+TEST(Node, AddChildrenWithExistingParent) {
+    auto parent1 = gleam::Node::Create();
+    auto parent2 = gleam::Node::Create();
+    auto child1 = gleam::Node::Create();
+    auto child2 = gleam::Node::Create();
+
+    parent1->AddChildren({child1, child2});
+    parent2->AddChildren({child1});
+
+    EXPECT_EQ(parent1->Children().size(), 1);
+    EXPECT_EQ(parent2->Children().size(), 1);
+    EXPECT_EQ(child1->Parent(), parent2.get());
+    EXPECT_EQ(child2->Parent(), parent1.get());
+}
+
+#pragma endregion
+
+#pragma region Scene Membership
+
+TEST(Node, AttachedWhenAddedToScene) {
+    auto scene = gleam::Scene::Create();
+    auto parent = std::make_shared<AttachCounter>();
+    auto child = std::make_shared<AttachCounter>();
+
+    parent->Add(child);
+    EXPECT_EQ(child->attached, 0);
+
+    scene->Add(parent);
+    EXPECT_EQ(parent->attached, 1);
+    EXPECT_EQ(child->attached, 1);
+
+    auto grandchild = std::make_shared<AttachCounter>();
+    child->Add(grandchild);
+    EXPECT_EQ(grandchild->attached, 1);
+}
+
+TEST(Node, AttachedOnceWhenAddedToSceneInBatch) {
+    auto scene = gleam::Scene::Create();
+    auto group = gleam::Node::Create();
+    scene->Add(group);
+
+    auto nodes = std::vector<std::shared_ptr<gleam::Node>> {};
+    for (auto i = 0; i < 3; ++i) {
+        auto node = std::make_shared<AttachCounter>();
+        node->Add(std::make_shared<AttachCounter>());
+        nodes.emplace_back(node);
+    }
+
+    group->AddChildren(nodes);
+
+    for (const auto& node : nodes) {
+        EXPECT_EQ(static_cast<AttachCounter*>(node.get())->attached, 1);
+        auto child = node->Children()[0].get();
+        EXPECT_EQ(static_cast<AttachCounter*>(child)->attached, 1);
+    }
+}
+
+TEST(Node, ReattachedWhenMovedBetweenScenes) {
+    auto scene1 = gleam::Scene::Create();
+    auto scene2 = gleam::Scene::Create();
+    auto node = std::make_shared<AttachCounter>();
+
+    scene1->Add(node);
+    EXPECT_EQ(node->attached, 1);
+
+    auto child = std::make_shared<AttachCounter>();
+    scene2->Add(child);
+    node->Add(child);
+
+    // Attached once by scene2, then once more when moved into scene1.
+    EXPECT_EQ(child->attached, 2);
+}
+
+TEST(Node, DetachedWhenSceneIsDestroyed) {
+    auto node = std::make_shared<AttachCounter>();
+    auto scene = gleam::Scene::Create();
+    scene->Add(node);
+    EXPECT_EQ(node->attached, 1);
+
+    // The next scene is likely to reuse the address of the destroyed one.
+    scene.reset();
+    scene = gleam::Scene::Create();
+
+    auto child = std::make_shared<AttachCounter>();
+    node->Add(child);
+    EXPECT_EQ(child->attached, 0);
+}
+
 #pragma endregion
 
 #pragma region Hierarchy Queries
@@ -8,9 +8,13 @@
 #pragma once
 
 #include <cstdint>
+#include <string_view>
 
 enum TextureFormat : uint32_t {
-    RGBA8 = 0
+    RGBA8 = 0,
+    BC1 = 1,
+    BC3 = 2,
+    BC7 = 3
 };
 
 enum VertexAttributeFlags : uint32_t {
@@ -19,6 +23,11 @@ enum VertexAttributeFlags : uint32_t {
     UVs = 1 << 2,
 };
 
+enum MeshCodec : uint32_t {
+    Uncompressed = 0,
+    DeltaPlaneLZ = 1
+};
+
 #pragma pack(push, 1)
 struct TextureHeader {
     char magic[4];
@@ -64,4 +73,45 @@ struct MeshEntryHeader {
     uint64_t index_data_size;
     uint32_t vertex_flags;
 };
-#pragma pack(pop)
\ No newline at end of file
+#pragma pack(pop)
+
+#pragma pack(push, 1)
+struct MeshStreamHeader {
+    uint32_t codec;
+    uint64_t vertex_stream_size;
+    uint64_t index_stream_size;
+};
+#pragma pack(pop)
+
+#pragma pack(push, 1)
+struct ArchiveHeader {
+    char magic[4] = {};
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t entry_count;
+    uint32_t alignment;
+    uint64_t toc_offset;
+    uint64_t names_offset;
+    uint64_t names_size;
+};
+#pragma pack(pop)
+
+#pragma pack(push, 1)
+struct ArchiveEntry {
+    uint64_t hash;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t name_offset;
+    uint32_t name_size;
+};
+#pragma pack(pop)
+
+// FNV-1a hash of an entry name, the table of contents is sorted by it.
+constexpr auto archive_hash(std::string_view name) -> uint64_t {
+    auto hash = uint64_t {14695981039346656037ull};
+    for (const auto c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
\ No newline at end of file
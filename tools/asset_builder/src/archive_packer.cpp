@@ -0,0 +1,133 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "archive_packer.hpp"
+#include "types.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "utilities/profiler.hpp"
+
+namespace {
+
+// Entries start on this boundary, so the runtime can view vertex and index
+// data in place.
+constexpr auto archive_alignment = uint64_t {16};
+
+struct PackedFile {
+    fs::path path;
+    std::string name;
+    ArchiveEntry entry;
+};
+
+auto align(uint64_t offset) {
+    return (offset + archive_alignment - 1) & ~(archive_alignment - 1);
+}
+
+auto collect_files(const fs::path& input_dir) {
+    GLEAM_PROFILE_ZONE("collect_files");
+    auto output = std::vector<PackedFile> {};
+    for (const auto& item : fs::recursive_directory_iterator(input_dir)) {
+        const auto& path = item.path();
+        if (!item.is_regular_file()) continue;
+        if (path.extension() != ".msh" && path.extension() != ".tex") continue;
+
+        auto file = PackedFile {path, fs::relative(path, input_dir).generic_string(), {}};
+        file.entry.hash = archive_hash(file.name);
+        file.entry.size = static_cast<uint64_t>(item.file_size());
+        output.emplace_back(std::move(file));
+    }
+
+    // The runtime binary searches the table of contents by hash.
+    std::ranges::sort(output, [](const auto& a, const auto& b) {
+        const auto a_hash = static_cast<uint64_t>(a.entry.hash);
+        const auto b_hash = static_cast<uint64_t>(b.entry.hash);
+        return a_hash != b_hash ? a_hash < b_hash : a.name < b.name;
+    });
+    return output;
+}
+
+auto write_padding(std::ofstream& out_stream, uint64_t offset) {
+    static constexpr char zeros[archive_alignment] = {};
+    const auto padding = align(offset) - offset;
+    out_stream.write(zeros, static_cast<std::streamsize>(padding));
+    return offset + padding;
+}
+
+} // unnamed namespace
+
+auto pack_archive(
+    const fs::path& input_dir,
+    const fs::path& output_path
+) -> std::expected<void, std::string> {
+    GLEAM_PROFILE_FUNCTION();
+    if (!fs::is_directory(input_dir)) {
+        return std::unexpected("Error: " + input_dir.string() + " is not a directory");
+    }
+
+    auto files = collect_files(input_dir);
+    if (files.empty()) {
+        return std::unexpected("Error: no .msh or .tex files found in " + input_dir.string());
+    }
+
+    auto header = ArchiveHeader {};
+    std::memcpy(header.magic, "PAK0", 4);
+    header.version = 1;
+    header.header_size = sizeof(ArchiveHeader);
+    header.entry_count = static_cast<uint32_t>(files.size());
+    header.alignment = static_cast<uint32_t>(archive_alignment);
+    header.toc_offset = sizeof(ArchiveHeader);
+    header.names_offset = header.toc_offset + files.size() * sizeof(ArchiveEntry);
+
+    auto names = std::string {};
+    for (auto& [path, name, entry] : files) {
+        entry.name_offset = static_cast<uint32_t>(names.size());
+        entry.name_size = static_cast<uint32_t>(name.size());
+        names += name;
+    }
+    header.names_size = names.size();
+
+    auto offset = align(header.names_offset + header.names_size);
+    for (auto& [path, name, entry] : files) {
+        entry.offset = offset;
+        offset = align(offset + entry.size);
+    }
+
+    auto out_stream = std::ofstream {output_path, std::ios::binary};
+    if (!out_stream) {
+        return std::unexpected("Error: Failed to open output file " + output_path.string());
+    }
+
+    out_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& file : files) {
+        out_stream.write(reinterpret_cast<const char*>(&file.entry), sizeof(ArchiveEntry));
+    }
+    out_stream.write(names.data(), static_cast<std::streamsize>(names.size()));
+    offset = write_padding(out_stream, header.names_offset + header.names_size);
+
+    for (const auto& [path, name, entry] : files) {
+        GLEAM_PROFILE_ZONE("pack_file");
+        auto in_stream = std::ifstream {path, std::ios::binary};
+        if (!in_stream) {
+            return std::unexpected("Error: Failed to open input file " + path.string());
+        }
+        if (entry.size > 0) out_stream << in_stream.rdbuf();
+        offset = write_padding(out_stream, offset + entry.size);
+        std::cout << "Packed " << name << '\n';
+    }
+
+    if (!out_stream) {
+        return std::unexpected("Error: Failed to write archive " + output_path.string());
+    }
+
+    return {};
+}
\ No newline at end of file
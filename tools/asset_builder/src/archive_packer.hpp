@@ -0,0 +1,18 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <expected>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+auto pack_archive(
+    const fs::path& input_dir,
+    const fs::path& output_path
+) -> std::expected<void, std::string>;
\ No newline at end of file
@@ -0,0 +1,236 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "batch_builder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <span>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "utilities/profiler.hpp"
+
+namespace {
+
+constexpr auto slowest_count = std::size_t {10};
+
+auto output_for(const fs::path& input, const fs::path& relative, const fs::path& output_dir) {
+    return output_dir.empty() ? input : output_dir / relative;
+}
+
+template <class Iterator>
+auto collect_matches(
+    const fs::path& base,
+    const std::string& pattern,
+    const fs::path& output_dir,
+    const BatchFilter& accept,
+    std::vector<BatchJob>& jobs
+) {
+    auto error = std::error_code {};
+    auto it = Iterator {base, fs::directory_options::skip_permission_denied, error};
+    for (; !error && it != Iterator {}; it.increment(error)) {
+        const auto& path = it->path();
+        if (!it->is_regular_file(error) || !accept(path)) continue;
+
+        const auto relative = path.lexically_relative(base);
+        if (!pattern.empty() && !glob_match(pattern, relative.generic_string())) continue;
+        jobs.emplace_back(path, output_for(path, relative, output_dir));
+    }
+}
+
+} // unnamed namespace
+
+auto glob_match(std::string_view pattern, std::string_view text) -> bool {
+    if (pattern.empty()) return text.empty();
+
+    if (pattern.starts_with("**")) {
+        const auto rest = pattern.substr(2);
+        if (rest.starts_with('/') && glob_match(rest.substr(1), text)) return true;
+        for (auto i = std::size_t {0}; i <= text.size(); ++i) {
+            if (glob_match(rest, text.substr(i))) return true;
+        }
+        return false;
+    }
+
+    if (pattern[0] == '*') {
+        for (auto i = std::size_t {0}; i <= text.size(); ++i) {
+            if (glob_match(pattern.substr(1), text.substr(i))) return true;
+            if (i < text.size() && text[i] == '/') break;
+        }
+        return false;
+    }
+
+    if (text.empty()) return false;
+    const auto matches = pattern[0] == '?' ? text[0] != '/' : pattern[0] == text[0];
+    return matches && glob_match(pattern.substr(1), text.substr(1));
+}
+
+auto collect_jobs(
+    const std::string& input,
+    const fs::path& output_dir,
+    const BatchFilter& accept
+) -> std::expected<std::vector<BatchJob>, std::string> {
+    GLEAM_PROFILE_FUNCTION();
+    auto jobs = std::vector<BatchJob> {};
+    auto base = fs::path {input};
+    auto pattern = std::string {};
+
+    if (const auto wildcard = input.find_first_of("*?"); wildcard != std::string::npos) {
+        const auto separator = input.find_last_of("/\\", wildcard);
+        base = separator == std::string::npos ? fs::path {"."} : fs::path {input.substr(0, separator)};
+        pattern = input.substr(separator == std::string::npos ? 0 : separator + 1);
+    } else if (fs::is_regular_file(base)) {
+        if (accept(base)) jobs.emplace_back(base, output_for(base, base.filename(), output_dir));
+        return jobs;
+    }
+
+    if (!fs::is_directory(base)) {
+        return std::unexpected("Input does not exist: " + base.string());
+    }
+
+    // Patterns within a single directory don't need to search below it.
+    if (pattern.empty() || pattern.contains('/') || pattern.contains("**")) {
+        collect_matches<fs::recursive_directory_iterator>(base, pattern, output_dir, accept, jobs);
+    } else {
+        collect_matches<fs::directory_iterator>(base, pattern, output_dir, accept, jobs);
+    }
+
+    std::ranges::sort(jobs, {}, &BatchJob::input);
+    return jobs;
+}
+
+auto read_manifest(const fs::path& manifest_path) -> std::expected<std::vector<BatchJob>, std::string> {
+    auto file = std::ifstream {manifest_path};
+    if (!file) {
+        return std::unexpected("Failed to open manifest: " + manifest_path.string());
+    }
+
+    const auto directory = manifest_path.parent_path();
+    auto jobs = std::vector<BatchJob> {};
+    auto line = std::string {};
+    for (auto number = 1; std::getline(file, line); ++number) {
+        auto stream = std::istringstream {line};
+        auto input = std::string {};
+        auto output = std::string {};
+        if (!(stream >> std::quoted(input)) || input.starts_with('#')) continue;
+
+        // Anything after a comment is ignored, including a comment that
+        // takes the place of the output.
+        stream >> std::quoted(output);
+        if (output.starts_with('#')) {
+            output.clear();
+        } else if (auto extra = std::string {}; stream >> extra && !extra.starts_with('#')) {
+            return std::unexpected(std::format("Invalid manifest entry on line {}: {}", number, line));
+        }
+
+        const auto input_path = directory / input;
+        jobs.emplace_back(input_path, output.empty() ? input_path : directory / output);
+    }
+    return jobs;
+}
+
+auto remove_duplicate_jobs(std::vector<BatchJob>& jobs) -> void {
+    // Paths are compared in absolute form, since patterns with a different
+    // base name the same file differently.
+    const auto key = [](const BatchJob& job) {
+        return std::pair {
+            fs::absolute(job.input).lexically_normal(),
+            fs::absolute(job.output).lexically_normal()
+        };
+    };
+
+    auto seen = std::set<std::pair<fs::path, fs::path>> {};
+    std::erase_if(jobs, [&](const BatchJob& job) { return !seen.insert(key(job)).second; });
+}
+
+auto batch_worker_count(unsigned requested, std::size_t job_count) -> unsigned {
+    const auto workers = requested > 0 ? requested : std::thread::hardware_concurrency();
+    return std::clamp(workers, 1u, static_cast<unsigned>(std::max<std::size_t>(job_count, 1)));
+}
+
+auto run_batch(
+    const std::vector<BatchJob>& jobs,
+    unsigned workers,
+    const BatchConverter& convert
+) -> std::vector<BatchResult> {
+    GLEAM_PROFILE_FUNCTION();
+    auto results = std::vector<BatchResult>(jobs.size());
+    auto next = std::atomic<std::size_t> {0};
+
+    // Workers claim jobs one at a time, so a few large assets don't leave
+    // the other threads idle.
+    const auto work = [&] {
+        for (auto i = next++; i < jobs.size(); i = next++) {
+            GLEAM_PROFILE_ZONE("convert_asset");
+            const auto start = std::chrono::steady_clock::now();
+            auto result = std::expected<void, std::string> {};
+            try {
+                result = convert(jobs[i]);
+            } catch (const std::exception& e) {
+                result = std::unexpected(e.what());
+            }
+            results[i] = {jobs[i], std::move(result), std::chrono::steady_clock::now() - start};
+        }
+    };
+
+    workers = batch_worker_count(workers, jobs.size());
+    auto threads = std::vector<std::jthread> {};
+    for (auto i = 1u; i < workers; ++i) {
+        threads.emplace_back([&work] {
+            gleam::Profiler::Get().SetThreadName("Builder");
+            work();
+        });
+    }
+    work();
+    threads.clear();
+
+    return results;
+}
+
+auto print_summary(
+    const std::vector<BatchResult>& results,
+    std::chrono::duration<double> wall_time,
+    std::ostream& stream
+) -> void {
+    auto failed = std::size_t {0};
+    auto busy_time = std::chrono::duration<double> {};
+    for (const auto& entry : results) {
+        busy_time += entry.elapsed;
+        if (entry.result) continue;
+        stream << "Failed " << entry.job.input.string() << ": " << entry.result.error() << '\n';
+        ++failed;
+    }
+
+    auto slowest = std::vector<const BatchResult*> {};
+    for (const auto& entry : results) slowest.push_back(&entry);
+    const auto count = std::min(slowest.size(), slowest_count);
+    std::ranges::partial_sort(slowest, slowest.begin() + count, std::ranges::greater {}, [](const auto* entry) {
+        return entry->elapsed;
+    });
+
+    if (count > 0) stream << "Slowest assets:\n";
+    for (const auto* entry : std::span {slowest}.first(count)) {
+        stream << std::format("  {:>10.1f} ms  {}\n", entry->elapsed.count() * 1000.0, entry->job.input.string());
+    }
+
+    stream << std::format(
+        "Converted {} of {} assets in {:.2f} s ({:.2f} s of conversion time), {} failed\n",
+        results.size() - failed,
+        results.size(),
+        wall_time.count(),
+        busy_time.count(),
+        failed
+    );
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <chrono>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+struct BatchJob {
+    fs::path input;
+    fs::path output;
+};
+
+struct BatchResult {
+    BatchJob job;
+    std::expected<void, std::string> result;
+    std::chrono::duration<double> elapsed;
+};
+
+using BatchConverter = std::function<std::expected<void, std::string>(const BatchJob&)>;
+
+using BatchFilter = std::function<bool(const fs::path&)>;
+
+// Matches a path against a pattern. `*` and `?` stop at path separators,
+// `**` doesn't, and `**/` also matches no directories at all.
+auto glob_match(std::string_view pattern, std::string_view text) -> bool;
+
+// Expands an input into jobs for the files `accept` returns true for.
+// Directories are searched recursively, and patterns may use `*` and `?`
+// within a path segment and `**` across segments. Outputs mirror the input
+// tree under `output_dir`, or sit next to their inputs when it's empty.
+auto collect_jobs(
+    const std::string& input,
+    const fs::path& output_dir,
+    const BatchFilter& accept
+) -> std::expected<std::vector<BatchJob>, std::string>;
+
+// Reads a manifest with one job per line, an input optionally followed by an
+// output. Paths may be quoted and are relative to the manifest. Lines
+// starting with '#' are comments.
+auto read_manifest(const fs::path& manifest_path) -> std::expected<std::vector<BatchJob>, std::string>;
+
+// Drops jobs that repeat an earlier one, like files matched by overlapping
+// patterns, so no output is written twice. Order is otherwise kept.
+auto remove_duplicate_jobs(std::vector<BatchJob>& jobs) -> void;
+
+// Number of threads a batch runs on: one per core when `requested` is 0, and
+// never more than there are jobs.
+auto batch_worker_count(unsigned requested, std::size_t job_count) -> unsigned;
+
+// Converts the jobs on batch_worker_count(workers) threads. Results are in
+// job order.
+auto run_batch(
+    const std::vector<BatchJob>& jobs,
+    unsigned workers,
+    const BatchConverter& convert
+) -> std::vector<BatchResult>;
+
+auto print_summary(
+    const std::vector<BatchResult>& results,
+    std::chrono::duration<double> wall_time,
+    std::ostream& stream
+) -> void;
\ No newline at end of file
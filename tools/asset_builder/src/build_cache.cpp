@@ -0,0 +1,279 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "build_cache.hpp"
+
+#include "types.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <unordered_set>
+
+#include "utilities/profiler.hpp"
+
+namespace {
+
+constexpr auto cache_header = std::string_view {"gleam-asset-cache 1"};
+
+constexpr auto chunk_size = std::size_t {1} << 20;
+
+// Stands in for the content hash of files that don't exist.
+constexpr auto missing_file = uint64_t {0x9e3779b97f4a7c15ull};
+
+auto hash_word(uint64_t hash, uint64_t word) -> uint64_t {
+    word *= 0x87c37b91114253d5ull;
+    word = std::rotl(word, 31);
+    word *= 0x4cf5ad432745937full;
+    hash ^= word;
+    return std::rotl(hash, 27) * 5 + 0x52dce729;
+}
+
+auto finalize(uint64_t hash) -> uint64_t {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    return hash ^ (hash >> 33);
+}
+
+auto cache_path(const fs::path& path) {
+    return fs::absolute(path).lexically_normal().string();
+}
+
+auto read_paths(std::istream& stream, std::vector<std::string>& paths) -> bool {
+    auto count = std::size_t {0};
+    if (!(stream >> count)) return false;
+    paths.resize(count);
+    for (auto& path : paths) {
+        if (!(stream >> std::quoted(path))) return false;
+    }
+    return true;
+}
+
+auto write_paths(std::ostream& stream, const std::vector<std::string>& paths) {
+    stream << ' ' << paths.size();
+    for (const auto& path : paths) stream << ' ' << std::quoted(path);
+}
+
+} // unnamed namespace
+
+auto BuildCache::Get() -> BuildCache& {
+    static auto instance = BuildCache {};
+    return instance;
+}
+
+auto BuildCache::Open(const fs::path& path, bool rebuild) -> void {
+    const auto lock = std::scoped_lock(mutex_);
+    path_ = path;
+    enabled_ = true;
+    files_.clear();
+    entries_.clear();
+    if (!rebuild) Load();
+}
+
+auto BuildCache::Load() -> void {
+    GLEAM_PROFILE_FUNCTION();
+    auto file = std::ifstream {path_};
+    auto line = std::string {};
+    if (!std::getline(file, line) || line != cache_header) return;
+
+    while (std::getline(file, line)) {
+        auto stream = std::istringstream {line};
+        auto kind = std::string {};
+        auto path = std::string {};
+        stream >> kind >> std::quoted(path);
+
+        if (kind == "file") {
+            auto state = FileState {};
+            if (stream >> state.size >> state.time >> state.hash) files_[path] = state;
+        } else if (kind == "output") {
+            auto entry = Entry {};
+            stream >> std::quoted(entry.input) >> std::quoted(entry.options) >> entry.key >> entry.size;
+            if (read_paths(stream, entry.sources) && read_paths(stream, entry.outputs)) {
+                entries_[path] = std::move(entry);
+            }
+        }
+    }
+}
+
+auto BuildCache::Save() -> std::expected<void, std::string> {
+    GLEAM_PROFILE_FUNCTION();
+    const auto lock = std::scoped_lock(mutex_);
+    if (!enabled_) return {};
+
+    auto temp_path = path_;
+    temp_path += ".tmp";
+    {
+        auto file = std::ofstream {temp_path};
+        file << cache_header << '\n';
+
+        // Entries whose output was deleted are dropped, along with the
+        // hashes of files nothing depends on anymore.
+        auto referenced = std::unordered_set<std::string> {};
+        auto error = std::error_code {};
+        for (const auto& [output, entry] : entries_) {
+            if (!fs::exists(output, error)) continue;
+            referenced.insert(entry.input);
+            referenced.insert(entry.sources.begin(), entry.sources.end());
+
+            file << "output " << std::quoted(output) << ' ' << std::quoted(entry.input) << ' '
+                 << std::quoted(entry.options) << ' ' << entry.key << ' ' << entry.size;
+            write_paths(file, entry.sources);
+            write_paths(file, entry.outputs);
+            file << '\n';
+        }
+
+        for (const auto& [path, state] : files_) {
+            if (!referenced.contains(path)) continue;
+            file << "file " << std::quoted(path) << ' ' << state.size << ' ' << state.time << ' ' << state.hash << '\n';
+        }
+
+        if (!file) {
+            return std::unexpected("Failed to write build cache: " + temp_path.string());
+        }
+    }
+
+    // Replacing the cache in one step keeps an interrupted build from
+    // leaving a truncated file behind.
+    auto error = std::error_code {};
+    fs::rename(temp_path, path_, error);
+    if (error) {
+        return std::unexpected("Failed to write build cache: " + path_.string());
+    }
+    return {};
+}
+
+auto BuildCache::Build(
+    const fs::path& input,
+    const fs::path& output,
+    const std::string& options,
+    const CachedConverter& convert
+) -> std::expected<void, std::string> {
+    const auto output_path = cache_path(output);
+    const auto input_path = cache_path(input);
+    if (enabled_ && IsCurrent(output_path, &input_path, &options)) {
+        const auto lock = std::scoped_lock(mutex_);
+        ++skipped_;
+        return {};
+    }
+
+    // The input is hashed before it's converted, so changes made while the
+    // conversion runs trigger another build. Sources are only known after.
+    const auto input_key = enabled_ ? InputKey(input_path, options) : 0;
+    auto dependencies = BuildDependencies {};
+    auto result = convert(dependencies);
+    if (!enabled_) return result;
+
+    auto entry = Entry {};
+    entry.input = input_path;
+    entry.options = options;
+    auto error = std::error_code {};
+    entry.size = fs::file_size(output, error);
+    if (!result || error) {
+        const auto lock = std::scoped_lock(mutex_);
+        entries_.erase(output_path);
+        return result;
+    }
+
+    for (const auto& source : dependencies.sources) entry.sources.push_back(cache_path(source));
+    for (const auto& path : dependencies.outputs) entry.outputs.push_back(cache_path(path));
+    entry.key = Key(input_key, entry.sources);
+
+    const auto lock = std::scoped_lock(mutex_);
+    entries_[output_path] = std::move(entry);
+    return result;
+}
+
+auto BuildCache::SkippedCount() -> std::size_t {
+    const auto lock = std::scoped_lock(mutex_);
+    return skipped_;
+}
+
+auto BuildCache::HashFile(const std::string& path) -> uint64_t {
+    auto error = std::error_code {};
+    const auto size = fs::file_size(path, error);
+    if (error) return missing_file;
+    const auto time = static_cast<int64_t>(fs::last_write_time(path, error).time_since_epoch().count());
+    if (error) return missing_file;
+
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        const auto it = files_.find(path);
+        if (it != files_.end() && it->second.size == size && it->second.time == time) {
+            return it->second.hash;
+        }
+    }
+
+    GLEAM_PROFILE_ZONE("hash_file");
+    auto file = std::ifstream {path, std::ios::binary};
+    if (!file) return missing_file;
+
+    // The size seeds the hash, so zero padding the last word can't collide
+    // with a file that ends in zeros.
+    auto hash = static_cast<uint64_t>(size);
+    auto buffer = std::vector<char>(chunk_size);
+    while (file) {
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        const auto count = static_cast<std::size_t>(file.gcount());
+        const auto padded = (count + 7) & ~std::size_t {7};
+        std::memset(buffer.data() + count, 0, padded - count);
+        for (auto i = std::size_t {0}; i < padded; i += 8) {
+            auto word = uint64_t {0};
+            std::memcpy(&word, buffer.data() + i, sizeof(word));
+            hash = hash_word(hash, word);
+        }
+    }
+    hash = finalize(hash);
+
+    const auto lock = std::scoped_lock(mutex_);
+    files_[path] = {size, time, hash};
+    return hash;
+}
+
+auto BuildCache::InputKey(const std::string& input, const std::string& options) -> uint64_t {
+    const auto key = archive_hash(options);
+    return hash_word(hash_word(key, archive_hash(input)), HashFile(input));
+}
+
+auto BuildCache::Key(uint64_t input_key, const std::vector<std::string>& sources) -> uint64_t {
+    auto key = input_key;
+    for (const auto& path : sources) {
+        key = hash_word(hash_word(key, archive_hash(path)), HashFile(path));
+    }
+    return finalize(key);
+}
+
+auto BuildCache::IsCurrent(
+    const std::string& output,
+    const std::string* input,
+    const std::string* options
+) -> bool {
+    auto entry = std::optional<Entry> {};
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        if (const auto it = entries_.find(output); it != entries_.end()) entry = it->second;
+    }
+
+    if (!entry) return false;
+    if (input && (entry->input != *input || entry->options != *options)) return false;
+
+    auto error = std::error_code {};
+    if (fs::file_size(output, error) != entry->size || error) return false;
+    if (Key(InputKey(entry->input, entry->options), entry->sources) != entry->key) return false;
+
+    // Other outputs a conversion wrote, like the textures a mesh references,
+    // must be up to date as well. Their own outputs aren't followed.
+    return !input || std::ranges::all_of(entry->outputs, [this](const auto& path) {
+        return IsCurrent(path, nullptr, nullptr);
+    });
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// Files a conversion read besides its input, and outputs it wrote besides its
+// own. Sources that don't exist are recorded too, so creating them triggers
+// a rebuild.
+struct BuildDependencies {
+    std::vector<fs::path> sources;
+    std::vector<fs::path> outputs;
+};
+
+using CachedConverter = std::function<std::expected<void, std::string>(BuildDependencies&)>;
+
+// Remembers what each output was built from. An output is up to date while
+// it exists and the content of its input and sources, the converter version
+// and the options all hash to the key recorded when it was built. Content
+// hashes are reused while a file's size and modification time are unchanged.
+class BuildCache {
+public:
+    BuildCache(const BuildCache&) = delete;
+    BuildCache(BuildCache&&) = delete;
+    BuildCache& operator=(const BuildCache&) = delete;
+    BuildCache& operator=(BuildCache&&) = delete;
+
+    static auto Get() -> BuildCache&;
+
+    // Until the cache is opened, every build runs. A missing or outdated
+    // cache file starts an empty cache, and `rebuild` discards the entries
+    // so every output is converted and recorded again.
+    auto Open(const fs::path& path, bool rebuild) -> void;
+
+    auto Save() -> std::expected<void, std::string>;
+
+    // Runs `convert` unless the output is up to date, then records the
+    // dependencies it reports. Options identify the converter and its
+    // settings, and should change whenever its output would.
+    auto Build(
+        const fs::path& input,
+        const fs::path& output,
+        const std::string& options,
+        const CachedConverter& convert
+    ) -> std::expected<void, std::string>;
+
+    // Number of builds skipped because their output was up to date.
+    [[nodiscard]] auto SkippedCount() -> std::size_t;
+
+private:
+    struct FileState {
+        uint64_t size {0};
+        int64_t time {0};
+        uint64_t hash {0};
+    };
+
+    struct Entry {
+        std::string input;
+        std::string options;
+        uint64_t key {0};
+        uint64_t size {0};
+        std::vector<std::string> sources;
+        std::vector<std::string> outputs;
+    };
+
+    std::mutex mutex_;
+
+    fs::path path_;
+
+    bool enabled_ {false};
+
+    // Content hashes by path, recorded with the size and time they were taken at.
+    std::unordered_map<std::string, FileState> files_;
+
+    // Build entries by output path.
+    std::unordered_map<std::string, Entry> entries_;
+
+    std::size_t skipped_ {0};
+
+    BuildCache() = default;
+
+    auto HashFile(const std::string& path) -> uint64_t;
+
+    // Hashes the input and options, the part of the key known before a build.
+    auto InputKey(const std::string& input, const std::string& options) -> uint64_t;
+
+    auto Key(uint64_t input_key, const std::vector<std::string>& sources) -> uint64_t;
+
+    // Checks an output against its entry, and against the input and options
+    // it's about to be built from when they're given.
+    auto IsCurrent(const std::string& output, const std::string* input, const std::string* options) -> bool;
+
+    auto Load() -> void;
+};
\ No newline at end of file
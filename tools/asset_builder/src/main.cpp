@@ -7,19 +7,30 @@
 
 #include "cxxopts.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <filesystem>
+#include <thread>
+#include <vector>
 
+#include "archive_packer.hpp"
+#include "batch_builder.hpp"
+#include "build_cache.hpp"
 #include "mesh_converter.hpp"
 #include "texture_converter.hpp"
 
+#include "utilities/profiler.hpp"
+
 namespace fs = std::filesystem;
 
 enum class AssetType {
     Invalid,
     Texture,
-    Mesh
+    Mesh,
+    Archive
 };
 
 auto get_asset_type(const fs::path& path) -> AssetType {
@@ -39,7 +50,144 @@ auto get_asset_type(const fs::path& path) -> AssetType {
 }
 
 auto asset_type_to_str(AssetType type) {
-    return type == AssetType::Texture ? "texture" : "mesh";
+    switch (type) {
+        case AssetType::Texture: return "texture";
+        case AssetType::Archive: return "archive";
+        default: return "mesh";
+    }
+}
+
+auto parse_texture_options(const cxxopts::ParseResult& options) -> std::optional<TextureOptions> {
+    auto texture = TextureOptions {};
+    const auto format = options["format"].as<std::string>();
+    if (format == "rgba8") texture.format = TextureFormat::RGBA8;
+    else if (format == "bc1") texture.format = TextureFormat::BC1;
+    else if (format == "bc3") texture.format = TextureFormat::BC3;
+    else if (format == "bc7") texture.format = TextureFormat::BC7;
+    else return std::nullopt;
+
+    const auto quality = options["quality"].as<std::string>();
+    if (quality == "fast") texture.quality = gleam::BlockQuality::Fast;
+    else if (quality == "high") texture.quality = gleam::BlockQuality::High;
+    else return std::nullopt;
+
+    return texture;
+}
+
+// The cache sits with the outputs it describes, so builds started from
+// different directories share it. Outputs without an output path sit next to
+// their inputs, under the directory an input names or the part of a pattern
+// before its first wildcard.
+auto default_cache_path(
+    const fs::path& output,
+    bool batch,
+    const std::string& input,
+    const std::string& manifest
+) -> fs::path {
+    constexpr auto cache_name = ".asset_cache";
+    if (!output.empty()) return (batch ? output : output.parent_path()) / cache_name;
+    if (!manifest.empty()) return fs::path {manifest}.parent_path() / cache_name;
+
+    auto directory = fs::path {};
+    for (const auto& segment : fs::path {input}) {
+        if (segment.string().find_first_of("*?") != std::string::npos) return directory / cache_name;
+        directory /= segment;
+    }
+    return (fs::is_directory(directory) ? directory : directory.parent_path()) / cache_name;
+}
+
+auto convert_cached_mesh(
+    const fs::path& input,
+    const fs::path& output,
+    const TextureOptions& texture_options,
+    unsigned parse_workers = 0
+) {
+    return BuildCache::Get().Build(
+        input,
+        output,
+        mesh_build_options(texture_options),
+        [&](BuildDependencies& dependencies) {
+            return convert_mesh(input, output, texture_options, &dependencies, parse_workers);
+        }
+    );
+}
+
+auto convert_asset(
+    const BatchJob& job,
+    const TextureOptions& texture_options,
+    unsigned parse_workers
+) -> std::expected<void, std::string> {
+    auto output = job.output;
+    if (output.has_parent_path()) {
+        auto error = std::error_code {};
+        fs::create_directories(output.parent_path(), error);
+    }
+
+    switch (get_asset_type(job.input)) {
+        case AssetType::Texture:
+            output.replace_extension(".tex");
+            return convert_texture_shared(job.input, output, texture_options);
+        case AssetType::Mesh:
+            output.replace_extension(".msh");
+            return convert_cached_mesh(job.input, output, texture_options, parse_workers);
+        default:
+            return std::unexpected("unsupported asset type");
+    }
+}
+
+auto build_batch(
+    const std::vector<std::string>& inputs,
+    const std::string& manifest,
+    const fs::path& output_dir,
+    unsigned workers,
+    const TextureOptions& texture_options
+) -> int {
+    const auto accept = [](const fs::path& path) {
+        return get_asset_type(path) != AssetType::Invalid;
+    };
+
+    auto jobs = std::vector<BatchJob> {};
+    for (const auto& input : inputs) {
+        auto collected = collect_jobs(input, output_dir, accept);
+        if (!collected) {
+            std::cerr << "Error: " << collected.error() << '\n';
+            return 1;
+        }
+        jobs.insert(jobs.end(), collected->begin(), collected->end());
+    }
+
+    if (!manifest.empty()) {
+        auto listed = read_manifest(manifest);
+        if (!listed) {
+            std::cerr << "Error: " << listed.error() << '\n';
+            return 1;
+        }
+        jobs.insert(jobs.end(), listed->begin(), listed->end());
+    }
+
+    remove_duplicate_jobs(jobs);
+    if (jobs.empty()) {
+        std::cerr << "Error: no convertible assets found\n";
+        return 1;
+    }
+
+    workers = batch_worker_count(workers, jobs.size());
+    std::cout << "Converting " << jobs.size() << " assets on " << workers << " threads\n";
+
+    // Jobs already run concurrently, so each mesh is parsed on its share of
+    // the cores instead of all of them.
+    const auto parse_workers = std::max(std::thread::hardware_concurrency() / workers, 1u);
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto results = run_batch(jobs, workers, [&texture_options, parse_workers](const BatchJob& job) {
+        return convert_asset(job, texture_options, parse_workers);
+    });
+    print_summary(results, std::chrono::steady_clock::now() - start, std::cout);
+    if (const auto skipped = BuildCache::Get().SkippedCount(); skipped > 0) {
+        std::cout << skipped << " outputs were already up to date\n";
+    }
+
+    return std::ranges::all_of(results, [](const auto& entry) { return entry.result.has_value(); }) ? 0 : 1;
 }
 
 auto main(int argc, char** argv) -> int {
@@ -49,8 +197,16 @@ auto main(int argc, char** argv) -> int {
     };
 
     opts.add_options()
-        ("i,input", "Input file (e.g. .png, .obj)", cxxopts::value<std::string>())
-        ("o,output", "Output file path", cxxopts::value<std::string>()->default_value(""))
+        ("i,input", "Input files, directories or patterns (e.g. .png, .obj, 'assets/**/*.png'), or a directory with --pack", cxxopts::value<std::vector<std::string>>())
+        ("m,manifest", "File listing an input and an optional output per line", cxxopts::value<std::string>()->default_value(""))
+        ("j,jobs", "Number of assets converted concurrently, 0 for one per core", cxxopts::value<unsigned>()->default_value("0"))
+        ("p,pack", "Pack the .msh and .tex files of a directory into a .pak archive")
+        ("o,output", "Output file path, or output directory when converting several assets", cxxopts::value<std::string>()->default_value(""))
+        ("f,format", "Texture format: rgba8, bc1, bc3 or bc7", cxxopts::value<std::string>()->default_value("rgba8"))
+        ("q,quality", "Texture compression quality: fast or high", cxxopts::value<std::string>()->default_value("high"))
+        ("c,cache", "Build cache file, used to skip outputs that are up to date (.asset_cache in the output directory by default)", cxxopts::value<std::string>()->default_value(""))
+        ("force", "Convert every asset, even if its output is up to date")
+        ("t,trace", "Write a Chrome trace of the conversion", cxxopts::value<std::string>()->default_value(""))
         ("h,help", "Show help");
 
     auto options = opts.parse(argc, argv);
@@ -60,39 +216,105 @@ auto main(int argc, char** argv) -> int {
         return 0;
     }
 
-    if (!options.count("input")) {
+    const auto manifest = options["manifest"].as<std::string>();
+    if (!options.count("input") && manifest.empty()) {
         std::cerr << "Error: input file required (-i)\n";
         std::cout << opts.help() << "\n";
         return 1;
     }
 
-    auto input = fs::path(options["input"].as<std::string>());
+    const auto inputs = options.count("input")
+        ? options["input"].as<std::vector<std::string>>()
+        : std::vector<std::string> {};
+
+    const auto trace = options["trace"].as<std::string>();
+#ifndef GLEAM_PROFILING
+    if (!trace.empty()) {
+        std::cerr << "Error: tracing requires a build with -DENABLE_PROFILER=ON\n";
+        return 1;
+    }
+#endif
+    gleam::Profiler::Get().SetEnabled(!trace.empty());
+
+    const auto texture_options = parse_texture_options(options);
+    if (!texture_options) {
+        std::cerr << "Error: invalid texture format or quality\n";
+        return 1;
+    }
+
+    // Several inputs, directories and patterns convert every asset they
+    // match on a pool of worker threads.
+    const auto pack = options.count("pack") > 0;
+    const auto batch = !manifest.empty() || inputs.size() > 1 || (
+        !pack && (fs::is_directory(inputs.front()) || inputs.front().find_first_of("*?") != std::string::npos)
+    );
+
+    // The cache is saved even if some assets fail, so the ones that
+    // converted don't have to be rebuilt.
+    const auto output_option = fs::path {options["output"].as<std::string>()};
+    auto cache = fs::path {options["cache"].as<std::string>()};
+    if (cache.empty()) {
+        cache = default_cache_path(output_option, batch, inputs.empty() ? "" : inputs.front(), manifest);
+    }
+    if (!pack) BuildCache::Get().Open(cache, options.count("force") > 0);
+    const auto save_cache = [] {
+        if (auto saved = BuildCache::Get().Save(); !saved) {
+            std::cerr << "Error: " << saved.error() << '\n';
+        }
+    };
+
+    if (batch) {
+        const auto status = build_batch(
+            inputs,
+            manifest,
+            output_option,
+            options["jobs"].as<unsigned>(),
+            texture_options.value()
+        );
+        save_cache();
+        if (!trace.empty() && !gleam::Profiler::Get().ExportChromeTrace(trace)) {
+            std::cerr << "Error: failed to write trace file: " << trace << "\n";
+        }
+        return status;
+    }
+
+    auto input = fs::path(inputs.front());
     if (!fs::exists(input)) {
         std::cerr << "Error: input file does not exist: " << input.string() << "\n";
         return 1;
     }
 
-    auto output = fs::path(options["output"].as<std::string>());
+    auto output = output_option;
     if (output.empty()) {
         output = input;
     }
 
-    auto asset_type = get_asset_type(input);
+    auto asset_type = pack ? AssetType::Archive : get_asset_type(input);
     auto result = std::expected<void, std::string>{};
     switch (asset_type) {
         case AssetType::Texture:
             output.replace_extension(".tex");
-            result = convert_texture(input, output);
+            result = convert_texture_shared(input, output, texture_options.value());
             break;
         case AssetType::Mesh:
             output.replace_extension(".msh");
-            result = convert_mesh(input, output);
+            result = convert_cached_mesh(input, output, texture_options.value());
+            break;
+        case AssetType::Archive:
+            if (!output.has_filename()) output = output.parent_path();
+            output.replace_extension(".pak");
+            result = pack_archive(input, output);
             break;
         default:
             std::cerr << "Error: unsupported asset type for file: " << input.string() << "\n";
             return 1;
     }
 
+    save_cache();
+    if (!trace.empty() && !gleam::Profiler::Get().ExportChromeTrace(trace)) {
+        std::cerr << "Error: failed to write trace file: " << trace << "\n";
+    }
+
     if (!result) {
         std::cerr << "Error: " << result.error() << '\n';
         return 1;
@@ -5,20 +5,24 @@
 ===========================================================================
 */
 
-#define TINYOBJLOADER_IMPLEMENTATION
-
 #include "mesh_converter.hpp"
+#include "obj_parser.hpp"
 #include "texture_converter.hpp"
 #include "types.hpp"
 
 #include <cmath>
 #include <filesystem>
+#include <format>
+#include <fstream>
 #include <iostream>
+#include <map>
+#include <span>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
 
-#include "tiny_obj_loader.hpp"
+#include "utilities/mesh_codec.hpp"
+#include "utilities/profiler.hpp"
 
 namespace fs = std::filesystem;
 
@@ -42,6 +46,34 @@ using VertexMap = std::unordered_map<VertexKey, unsigned, VertexKeyHash>;
 
 namespace {
 
+constexpr auto mesh_converter_version = 1;
+
+// Loads material libraries like tinyobj's reader, and records each one it
+// looks for as a dependency of the mesh.
+class DependencyMaterialReader : public tinyobj::MaterialReader {
+public:
+    DependencyMaterialReader(const fs::path& directory, BuildDependencies* dependencies)
+      : reader_(directory.empty() ? std::string {} : directory.string() + '/'),
+        directory_(directory),
+        dependencies_(dependencies) {}
+
+    bool operator()(
+        const std::string& name,
+        std::vector<tinyobj::material_t>* materials,
+        std::map<std::string, int>* material_map,
+        std::string* warning,
+        std::string* error
+    ) override {
+        if (dependencies_) dependencies_->sources.push_back(directory_ / name);
+        return reader_(name, materials, material_map, warning, error);
+    }
+
+private:
+    tinyobj::MaterialFileReader reader_;
+    fs::path directory_;
+    BuildDependencies* dependencies_;
+};
+
 struct __vec3_t {
     float x;
     float y;
@@ -94,6 +126,7 @@ auto generate_normals(
     std::vector<unsigned>& index_data,
     unsigned int stride
 ) {
+    GLEAM_PROFILE_FUNCTION();
     for (auto i = 0; i < index_data.size(); i += 3) {
         const auto i0 = index_data[i + 0];
         const auto i1 = index_data[i + 1];
@@ -132,7 +165,9 @@ auto generate_normals(
 
 auto convert_texture(
     const std::string& texture,
-    const fs::path& mesh_input_path
+    const fs::path& mesh_input_path,
+    const TextureOptions& options,
+    BuildDependencies* dependencies
 ) -> std::string {
     auto tex_path = fs::path {texture};
     auto tex_input = tex_path;
@@ -142,17 +177,23 @@ auto convert_texture(
         tex_input = dir.append(texture);
         if (!fs::exists(tex_input)) {
             std::cout << "Failed to load texture " << tex_input << '\n';
+            if (dependencies) dependencies->sources.push_back(tex_input);
             return "";
         }
     }
 
     auto tex_output = tex_input;
     tex_output.replace_extension(".tex");
-    if (auto result = ::convert_texture(tex_input, tex_output); !result) {
+    if (auto result = convert_texture_shared(tex_input, tex_output, options); !result) {
         std::cout << result.error();
+        if (dependencies) dependencies->sources.push_back(tex_input);
         return "";
     }
 
+    // The texture's own cache entry tracks its source, the mesh only needs
+    // it to stay up to date.
+    if (dependencies) dependencies->outputs.push_back(tex_output);
+
     std::cout << "Generated texture " << tex_output.string() << '\n';
     return tex_path.replace_extension(".tex").string();
 }
@@ -160,15 +201,18 @@ auto convert_texture(
 auto parse_materials(
     const std::vector<tinyobj::material_t> &materials,
     const fs::path& mesh_input_path,
+    const TextureOptions& texture_options,
+    BuildDependencies* dependencies,
     std::ofstream& out_stream
 ) {
+    GLEAM_PROFILE_FUNCTION();
     for (const auto& material : materials) {
         auto mat_entry = MaterialEntryHeader {};
 
         if (!material.diffuse_texname.empty()) {
             copy_fixed_size_str(
                 mat_entry.texture,
-                convert_texture(material.diffuse_texname, mesh_input_path)
+                convert_texture(material.diffuse_texname, mesh_input_path, texture_options, dependencies)
             );
         }
 
@@ -186,12 +230,45 @@ auto parse_materials(
     }
 }
 
+auto write_streams(
+    const std::vector<float>& vertex_data,
+    const std::vector<unsigned>& index_data,
+    uint32_t vertex_stride,
+    std::ofstream& out_stream
+) {
+    GLEAM_PROFILE_ZONE("encode_streams");
+    const auto vertex_bytes = std::as_bytes(std::span {vertex_data});
+    const auto index_bytes = std::as_bytes(std::span {index_data});
+    const auto vertex_stream = gleam::encode_mesh_stream(vertex_bytes, vertex_stride);
+    const auto index_stream = gleam::encode_mesh_stream(index_bytes, 1);
+
+    auto stream_header = MeshStreamHeader {};
+    stream_header.codec = MeshCodec::DeltaPlaneLZ;
+    stream_header.vertex_stream_size = static_cast<uint64_t>(vertex_stream.size());
+    stream_header.index_stream_size = static_cast<uint64_t>(index_stream.size());
+
+    // Data that doesn't compress is stored as is, so it can be mapped in place.
+    if (vertex_stream.size() + index_stream.size() >= vertex_bytes.size() + index_bytes.size()) {
+        stream_header.codec = MeshCodec::Uncompressed;
+        stream_header.vertex_stream_size = static_cast<uint64_t>(vertex_bytes.size());
+        stream_header.index_stream_size = static_cast<uint64_t>(index_bytes.size());
+    }
+
+    const auto compressed = stream_header.codec == MeshCodec::DeltaPlaneLZ;
+    const auto vertices = compressed ? std::span {vertex_stream} : vertex_bytes;
+    const auto indices = compressed ? std::span {index_stream} : index_bytes;
+    out_stream.write(reinterpret_cast<const char*>(&stream_header), sizeof(stream_header));
+    out_stream.write(reinterpret_cast<const char*>(vertices.data()), vertices.size());
+    out_stream.write(reinterpret_cast<const char*>(indices.data()), indices.size());
+}
+
 auto parse_shapes(
     const std::vector<tinyobj::shape_t> &shapes,
     const tinyobj::attrib_t &attrib,
     std::ofstream& out_stream
 ) {
     for (const auto& shape : shapes) {
+        GLEAM_PROFILE_ZONE("parse_shape");
         auto& mesh = shape.mesh;
         auto seen_vertices = VertexMap {};
         auto vertex_data = std::vector<float> {};
@@ -258,37 +335,41 @@ auto parse_shapes(
         }
 
         out_stream.write(reinterpret_cast<const char*>(&msh_entry), sizeof(msh_entry));
-        out_stream.write(reinterpret_cast<const char*>(vertex_data.data()), vertex_data.size() * sizeof(float));
-        out_stream.write(reinterpret_cast<const char*>(index_data.data()), index_data.size() * sizeof(unsigned));
+        write_streams(vertex_data, index_data, msh_entry.vertex_stride, out_stream);
     }
 }
 
 } // unnamed namespace
 
+auto mesh_build_options(const TextureOptions& texture_options) -> std::string {
+    return std::format("mesh {} {}", mesh_converter_version, texture_build_options(texture_options));
+}
+
 auto convert_mesh(
     const fs::path& input_path,
-    const fs::path& output_path
+    const fs::path& output_path,
+    const TextureOptions& texture_options,
+    BuildDependencies* dependencies,
+    unsigned workers
 ) -> std::expected<void, std::string> {
-    auto reader_config = tinyobj::ObjReaderConfig {};
-    auto reader = tinyobj::ObjReader {};
-
-    if (!reader.ParseFromFile(input_path.string(), reader_config)) {
-        return reader.Error().empty() ?
-            std::unexpected("Error: Failed to load mesh " + input_path.string() + '\n') :
-            std::unexpected("Error " + reader.Error());
+    GLEAM_PROFILE_FUNCTION();
+    auto material_reader = DependencyMaterialReader {input_path.parent_path(), dependencies};
+    const auto parsed = parse_obj(input_path, material_reader, workers);
+    if (!parsed) {
+        return std::unexpected("Error " + parsed.error());
     }
 
-    if (!reader.Warning().empty()) {
-        std::cout << "Warning: " << reader.Warning() << '\n';
+    if (!parsed->warning.empty()) {
+        std::cout << "Warning: " << parsed->warning << '\n';
     }
 
-    auto& attrib = reader.GetAttrib();
-    auto& shapes = reader.GetShapes();
-    auto& materials = reader.GetMaterials();
+    auto& attrib = parsed->attrib;
+    auto& shapes = parsed->shapes;
+    auto& materials = parsed->materials;
 
     auto header = MeshHeader {};
     std::memcpy(header.magic, "MES0", 4);
-    header.version = 1;
+    header.version = 2;
     header.header_size = sizeof(MeshHeader);
     header.material_count = static_cast<uint32_t>(materials.size());
     header.mesh_count = static_cast<uint32_t>(shapes.size());
@@ -300,7 +381,7 @@ auto convert_mesh(
 
     out_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
 
-    parse_materials(materials, input_path, out_stream);
+    parse_materials(materials, input_path, texture_options, dependencies, out_stream);
     parse_shapes(shapes, attrib, out_stream);
 
     return {};
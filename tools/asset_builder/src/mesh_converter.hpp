@@ -7,12 +7,26 @@
 
 #pragma once
 
+#include "build_cache.hpp"
+#include "texture_converter.hpp"
+
 #include <expected>
 #include <filesystem>
+#include <string>
 
 namespace fs = std::filesystem;
 
+// Identifies the mesh converter and its settings in the build cache.
+// Bump the version whenever the converter's output changes.
+auto mesh_build_options(const TextureOptions& texture_options) -> std::string;
+
+// Reports the material libraries the mesh read and the textures it
+// converted to `dependencies`, when given. The OBJ file is parsed on
+// `workers` threads, one per core when 0.
 auto convert_mesh(
     const fs::path& input_path,
-    const fs::path& output_path
+    const fs::path& output_path,
+    const TextureOptions& texture_options = {},
+    BuildDependencies* dependencies = nullptr,
+    unsigned workers = 0
 ) -> std::expected<void, std::string>;
\ No newline at end of file
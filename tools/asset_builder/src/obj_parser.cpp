@@ -0,0 +1,723 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#define TINYOBJLOADER_IMPLEMENTATION
+
+#include "obj_parser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <map>
+#include <set>
+#include <string_view>
+#include <thread>
+
+#include "utilities/mapped_file.hpp"
+#include "utilities/profiler.hpp"
+
+namespace {
+
+// More chunks than workers keeps threads busy when some chunks are denser
+// than others.
+constexpr auto chunks_per_worker = std::size_t {4};
+
+// Doubles this many units in the last place from a float rounding boundary
+// are parsed again by tinyobj, whose result may round the other way.
+constexpr auto rounding_margin = int64_t {1} << 12;
+
+constexpr auto no_index = std::numeric_limits<std::size_t>::max();
+
+enum class Directive {
+    UseMaterial,
+    MaterialLibrary,
+    Group,
+    Object,
+    Primitive
+};
+
+// A line that changes how the faces after it are grouped into shapes.
+struct Event {
+    Directive type;
+    std::size_t face;
+    std::size_t index;
+    std::size_t vertex;
+    std::size_t line;
+    std::string text;
+    std::size_t count {0};
+};
+
+enum Attribute : uint8_t {
+    Position,
+    Normal,
+    Texcoord
+};
+
+// A relative index, resolved against the attributes of its own chunk until
+// the chunks before it have been counted. Relative indices of lines and
+// points are only validated.
+struct RelativeIndex {
+    std::size_t index;
+    int value;
+    Attribute attribute;
+    char primitive;
+    std::size_t line;
+};
+
+struct Chunk {
+    std::vector<float> positions;
+    std::vector<float> normals;
+    std::vector<float> texcoords;
+    std::vector<tinyobj::index_t> indices;
+    std::vector<uint32_t> face_sizes;
+    std::vector<Event> events;
+    std::vector<RelativeIndex> relative;
+    std::size_t lines {0};
+    std::size_t error_line {0};
+    char error_primitive {0};
+    int greatest[3] {-1, -1, -1};
+    bool zero_index {false};
+    bool polygons {false};
+
+    [[nodiscard]] auto Count(Attribute attribute) const {
+        switch (attribute) {
+            case Position: return static_cast<int>(positions.size() / 3);
+            case Normal: return static_cast<int>(normals.size() / 3);
+            default: return static_cast<int>(texcoords.size() / 2);
+        }
+    }
+};
+
+auto is_space(char c) { return c == ' ' || c == '\t'; }
+
+auto is_digit(char c) { return c >= '0' && c <= '9'; }
+
+auto skip_space(const char* p, const char* end) {
+    while (p < end && is_space(*p)) ++p;
+    return p;
+}
+
+auto token_end(const char* p, const char* end) {
+    while (p < end && !is_space(*p)) ++p;
+    return p;
+}
+
+auto index_end(const char* p, const char* end) {
+    while (p < end && *p != '/' && !is_space(*p)) ++p;
+    return p;
+}
+
+// Lines end at "\n", "\r" or "\r\n", like they do for tinyobj. A NUL ends
+// the contents of a line, like it does for the C strings tinyobj parses.
+auto next_line(const char* p, const char* end, const char*& content_end) {
+    while (p < end && *p != '\n' && *p != '\r' && *p != '\0') ++p;
+    content_end = p;
+    while (p < end && *p != '\n' && *p != '\r') ++p;
+    if (p < end && *p++ == '\r' && p < end && *p == '\n') ++p;
+    return p;
+}
+
+auto near_float_rounding(double value) {
+    const auto magnitude = std::abs(value);
+    if (magnitude < std::numeric_limits<float>::min() || magnitude > std::numeric_limits<float>::max()) {
+        return value != 0.0;
+    }
+
+    // The 29 low bits of a double's mantissa are the ones a float drops, and
+    // the value is halfway between two floats when only the highest is set.
+    const auto dropped = std::bit_cast<uint64_t>(value) & ((uint64_t {1} << 29) - 1);
+    const auto distance = static_cast<int64_t>(dropped) - (int64_t {1} << 28);
+    return distance > -rounding_margin && distance < rounding_margin;
+}
+
+// Parses a number with std::from_chars. tinyobj accepts a few more forms
+// and rounds some numbers differently, so those few are parsed by tinyobj
+// to produce identical vertices.
+auto parse_real(const char*& p, const char* end) {
+    p = skip_space(p, end);
+    const auto last = token_end(p, end);
+    const auto signed_number = p < last && (*p == '+' || *p == '-');
+    const auto* digits = p + signed_number;
+
+    auto value = 0.0;
+    auto parsed = false;
+    if (digits < last && (is_digit(*digits) || *digits == '.')) {
+        const auto [ptr, ec] = std::from_chars(*p == '+' ? digits : p, last, value);
+        parsed = ec == std::errc {} && ptr == last && !near_float_rounding(value);
+    }
+    if (!parsed && !tinyobj::tryParseDouble(p, last, &value)) {
+        value = 0.0;
+    }
+
+    p = last;
+    return static_cast<float>(value);
+}
+
+// Parses an index like atoi, which tinyobj uses.
+auto parse_int(const char* p, const char* end) {
+    while (p < end && (is_space(*p) || *p == '\v' || *p == '\f')) ++p;
+    auto negative = false;
+    if (p < end && (*p == '+' || *p == '-')) negative = *p++ == '-';
+    auto value = 0u;
+    for (; p < end && is_digit(*p); ++p) value = value * 10 + static_cast<unsigned>(*p - '0');
+    return static_cast<int>(negative ? 0u - value : value);
+}
+
+class ChunkParser {
+public:
+    explicit ChunkParser(Chunk& chunk) : chunk_(chunk) {}
+
+    auto Parse(const char* p, const char* end) -> void {
+        GLEAM_PROFILE_ZONE("parse_chunk");
+        while (p < end) {
+            const char* line_end = nullptr;
+            const auto* next = next_line(p, end, line_end);
+            ++chunk_.lines;
+            if (!ParseLine(skip_space(p, line_end), line_end)) {
+                chunk_.error_line = chunk_.lines;
+                return;
+            }
+            p = next;
+        }
+    }
+
+private:
+    Chunk& chunk_;
+
+    auto ParseLine(const char* p, const char* end) -> bool {
+        if (p == end || *p == '#') return true;
+
+        const auto c0 = *p;
+        const auto c1 = p + 1 < end ? p[1] : '\0';
+        const auto c2 = p + 2 < end ? p[2] : '\0';
+        const auto line = std::string_view {p, end};
+
+        if (c0 == 'v' && is_space(c1)) {
+            p += 2;
+            for (auto i = 0; i < 3; ++i) chunk_.positions.push_back(parse_real(p, end));
+            return true;
+        }
+        if (c0 == 'v' && c1 == 'n' && is_space(c2)) {
+            p += 3;
+            for (auto i = 0; i < 3; ++i) chunk_.normals.push_back(parse_real(p, end));
+            return true;
+        }
+        if (c0 == 'v' && c1 == 't' && is_space(c2)) {
+            p += 3;
+            for (auto i = 0; i < 2; ++i) chunk_.texcoords.push_back(parse_real(p, end));
+            return true;
+        }
+        if (c0 == 'f' && is_space(c1)) {
+            return ParseFace(p + 2, end);
+        }
+        if ((c0 == 'l' || c0 == 'p') && is_space(c1)) {
+            return ParsePrimitive(c0, p + 2, end);
+        }
+        if (line.starts_with("usemtl")) {
+            p = skip_space(p + 6, end);
+            AddEvent(Directive::UseMaterial, std::string {p, token_end(p, end)});
+            return true;
+        }
+        if (line.starts_with("mtllib") && line.size() > 6 && is_space(line[6])) {
+            AddEvent(Directive::MaterialLibrary, std::string {line.substr(7)});
+            return true;
+        }
+        if (c0 == 'g' && is_space(c1)) {
+            ParseGroup(p, end);
+            return true;
+        }
+        if (c0 == 'o' && is_space(c1)) {
+            AddEvent(Directive::Object, std::string {line.substr(2)});
+            return true;
+        }
+
+        // Smoothing groups, tags and skin weights don't affect the mesh.
+        return true;
+    }
+
+    auto ParseFace(const char* p, const char* end) -> bool {
+        p = skip_space(p, end);
+        const auto first = chunk_.indices.size();
+        while (p < end && *p != '#') {
+            auto vertex = tinyobj::index_t {-1, -1, -1};
+            if (!ParseTriple(p, end, chunk_.indices.size(), 'f', vertex)) return false;
+            chunk_.greatest[Position] = std::max(chunk_.greatest[Position], vertex.vertex_index);
+            chunk_.greatest[Normal] = std::max(chunk_.greatest[Normal], vertex.normal_index);
+            chunk_.greatest[Texcoord] = std::max(chunk_.greatest[Texcoord], vertex.texcoord_index);
+            chunk_.indices.push_back(vertex);
+            p = skip_space(p, end);
+        }
+
+        const auto size = static_cast<uint32_t>(chunk_.indices.size() - first);
+        chunk_.face_sizes.push_back(size);
+        chunk_.polygons |= size != 3;
+        return true;
+    }
+
+    // Lines and points aren't converted, but they're validated and still
+    // decide which shapes are emitted.
+    auto ParsePrimitive(char primitive, const char* p, const char* end) -> bool {
+        auto count = std::size_t {0};
+        while (p < end && *p != '#') {
+            auto vertex = tinyobj::index_t {-1, -1, -1};
+            if (!ParseTriple(p, end, no_index, primitive, vertex)) return false;
+            ++count;
+            p = skip_space(p, end);
+        }
+        AddEvent(Directive::Primitive, {}, count);
+        return true;
+    }
+
+    auto ParseGroup(const char* p, const char* end) -> void {
+        // The first name is the 'g' itself, tinyobj joins the rest.
+        auto names = std::vector<std::string_view> {};
+        while (p < end && *p != '#') {
+            p = skip_space(p, end);
+            const auto* last = token_end(p, end);
+            names.emplace_back(p, last);
+            p = skip_space(last, end);
+        }
+
+        auto name = std::string {};
+        for (auto i = std::size_t {1}; i < names.size(); ++i) {
+            if (i > 1) name += ' ';
+            name += names[i];
+        }
+        AddEvent(Directive::Group, std::move(name), names.size());
+    }
+
+    auto ParseTriple(
+        const char*& p,
+        const char* end,
+        std::size_t index,
+        char primitive,
+        tinyobj::index_t& vertex
+    ) -> bool {
+        const auto resolve = [&](Attribute attribute, bool allow_zero, int& out) {
+            const auto value = parse_int(p, end);
+            p = index_end(p, end);
+            if (value > 0) {
+                out = value - 1;
+                return true;
+            }
+            if (value == 0) {
+                chunk_.zero_index = true;
+                out = -1;
+                return allow_zero;
+            }
+            out = chunk_.Count(attribute) + value;
+            chunk_.relative.push_back({index, out, attribute, primitive, chunk_.lines});
+            return true;
+        };
+
+        if (!resolve(Position, false, vertex.vertex_index)) return Fail(primitive);
+        if (p == end || *p != '/') return true;
+        ++p;
+
+        if (p < end && *p == '/') {
+            ++p;
+            return resolve(Normal, true, vertex.normal_index) || Fail(primitive);
+        }
+
+        if (!resolve(Texcoord, true, vertex.texcoord_index)) return Fail(primitive);
+        if (p == end || *p != '/') return true;
+        ++p;
+        return resolve(Normal, true, vertex.normal_index) || Fail(primitive);
+    }
+
+    auto Fail(char primitive) -> bool {
+        chunk_.error_primitive = primitive;
+        return false;
+    }
+
+    auto AddEvent(Directive type, std::string text, std::size_t count = 0) -> void {
+        chunk_.events.push_back({
+            type,
+            chunk_.face_sizes.size(),
+            chunk_.indices.size(),
+            chunk_.positions.size() / 3,
+            chunk_.lines,
+            std::move(text),
+            count
+        });
+    }
+};
+
+auto parse_error(char primitive, std::size_t line) {
+    if (primitive == 'f') {
+        return std::format(
+            "Failed to parse `f' line (e.g. a zero value for vertex index "
+            "or invalid relative vertex index). Line {}).\n",
+            line
+        );
+    }
+    return std::format("Failed to parse `{}' line (e.g. a zero value for vertex index. Line {}).\n", primitive, line);
+}
+
+// Replays the chunks in file order and groups their faces into shapes the
+// way tinyobj::LoadObj does. Triangles and quads are emitted directly,
+// larger polygons go through tinyobj's triangulation.
+class ShapeAssembler {
+public:
+    ShapeAssembler(ObjData& data, tinyobj::MaterialReader& material_reader)
+      : data_(data), material_reader_(material_reader) {}
+
+    auto AddFaces(const Chunk& chunk, std::size_t first_face, std::size_t last_face, std::size_t first_index) {
+        if (first_face < last_face) faces_.push_back({&chunk, first_face, last_face, first_index});
+    }
+
+    auto Apply(const Event& event, std::size_t vertex_limit, std::size_t line) -> void {
+        switch (event.type) {
+            case Directive::UseMaterial: UseMaterial(event.text, vertex_limit); break;
+            case Directive::MaterialLibrary: LoadMaterials(event.text, line); break;
+            case Directive::Group:
+                ExportGroup(vertex_limit);
+                if (!shape_.mesh.indices.empty()) data_.shapes.push_back(std::move(shape_));
+                ResetShape();
+                if (event.count < 2) data_.warning += std::format("Empty group name. line: {}\n", line);
+                name_ = event.text;
+                break;
+            case Directive::Object:
+                ExportGroup(vertex_limit);
+                if (!shape_.mesh.indices.empty() || shape_primitives_) data_.shapes.push_back(std::move(shape_));
+                ResetShape();
+                name_ = event.text;
+                break;
+            case Directive::Primitive:
+                ++primitives_;
+                primitive_vertices_ += event.count;
+                break;
+        }
+    }
+
+    auto Finish(std::size_t vertex_limit) -> void {
+        if (ExportGroup(vertex_limit) || !shape_.mesh.indices.empty()) {
+            data_.shapes.push_back(std::move(shape_));
+        }
+        if (degenerate_) data_.warning += "Degenerated face found\n.";
+        if (invalid_) data_.warning += "Face with invalid vertex index found.\n";
+    }
+
+private:
+    struct FaceRange {
+        const Chunk* chunk;
+        std::size_t first_face;
+        std::size_t last_face;
+        std::size_t first_index;
+    };
+
+    ObjData& data_;
+
+    tinyobj::MaterialReader& material_reader_;
+
+    std::map<std::string, int> material_map_;
+
+    std::set<std::string> material_files_;
+
+    int material_ {-1};
+
+    std::string name_;
+
+    tinyobj::shape_t shape_;
+
+    // Faces, lines and points since the shape or material last changed.
+    std::vector<FaceRange> faces_;
+
+    std::size_t primitives_ {0};
+
+    std::size_t primitive_vertices_ {0};
+
+    bool shape_primitives_ {false};
+
+    bool degenerate_ {false};
+
+    bool invalid_ {false};
+
+    auto ResetShape() -> void {
+        shape_ = {};
+        shape_primitives_ = false;
+        faces_.clear();
+        primitives_ = 0;
+        primitive_vertices_ = 0;
+    }
+
+    auto UseMaterial(const std::string& name, std::size_t vertex_limit) -> void {
+        auto material = -1;
+        if (const auto it = material_map_.find(name); it != material_map_.end()) {
+            material = it->second;
+        } else {
+            data_.warning += "material [ '" + name + "' ] not found in .mtl\n";
+        }
+
+        // Like tinyobj, lines and points stay in the group.
+        if (material != material_) {
+            ExportGroup(vertex_limit);
+            faces_.clear();
+            material_ = material;
+        }
+    }
+
+    auto LoadMaterials(const std::string& libraries, std::size_t line) -> void {
+        auto filenames = std::vector<std::string> {};
+        tinyobj::SplitString(libraries, ' ', '\\', filenames);
+        if (filenames.empty()) {
+            data_.warning += std::format("Looks like empty filename for mtllib. Use default material (line {}.)\n", line);
+            return;
+        }
+
+        auto found = false;
+        for (const auto& filename : filenames) {
+            if (material_files_.contains(filename)) {
+                found = true;
+                continue;
+            }
+
+            auto warning = std::string {};
+            auto error = std::string {};
+            const auto loaded = material_reader_(filename, &data_.materials, &material_map_, &warning, &error);
+            data_.warning += warning + error;
+            if (loaded) {
+                found = true;
+                material_files_.insert(filename);
+                break;
+            }
+        }
+
+        if (!found) data_.warning += "Failed to load material file(s). Use default material.\n";
+    }
+
+    auto ExportGroup(std::size_t vertex_limit) -> bool {
+        if (faces_.empty() && primitives_ == 0) return false;
+
+        shape_.name = name_;
+        for (const auto& range : faces_) {
+            const auto& chunk = *range.chunk;
+            if (!chunk.polygons) {
+                const auto first = chunk.indices.begin() + static_cast<std::ptrdiff_t>(range.first_index);
+                const auto count = (range.last_face - range.first_face) * 3;
+                shape_.mesh.indices.insert(shape_.mesh.indices.end(), first, first + static_cast<std::ptrdiff_t>(count));
+                shape_.mesh.material_ids.insert(shape_.mesh.material_ids.end(), count / 3, material_);
+                continue;
+            }
+
+            auto index = range.first_index;
+            for (auto face = range.first_face; face < range.last_face; ++face) {
+                const auto size = chunk.face_sizes[face];
+                AddFace(&chunk.indices[index], size, vertex_limit);
+                index += size;
+            }
+        }
+
+        if (primitive_vertices_ > 0) shape_primitives_ = true;
+        return true;
+    }
+
+    auto AddTriangle(const tinyobj::index_t& a, const tinyobj::index_t& b, const tinyobj::index_t& c) -> void {
+        shape_.mesh.indices.insert(shape_.mesh.indices.end(), {a, b, c});
+        shape_.mesh.material_ids.push_back(material_);
+    }
+
+    auto AddFace(const tinyobj::index_t* face, uint32_t size, std::size_t vertex_limit) -> void {
+        if (size < 3) {
+            degenerate_ = true;
+            return;
+        }
+
+        if (size == 3) {
+            AddTriangle(face[0], face[1], face[2]);
+            return;
+        }
+
+        const auto& v = data_.attrib.vertices;
+        if (size == 4) {
+            // Vertices defined after the shape was exported are out of range.
+            for (auto i = 0; i < 4; ++i) {
+                if (static_cast<std::size_t>(face[i].vertex_index) >= vertex_limit) {
+                    invalid_ = true;
+                    return;
+                }
+            }
+
+            // Splits along the shorter diagonal, with the same arithmetic as
+            // tinyobj so ties break the same way.
+            const auto vi0 = static_cast<std::size_t>(face[0].vertex_index);
+            const auto vi1 = static_cast<std::size_t>(face[1].vertex_index);
+            const auto vi2 = static_cast<std::size_t>(face[2].vertex_index);
+            const auto vi3 = static_cast<std::size_t>(face[3].vertex_index);
+            const tinyobj::real_t e02x = v[vi2 * 3 + 0] - v[vi0 * 3 + 0];
+            const tinyobj::real_t e02y = v[vi2 * 3 + 1] - v[vi0 * 3 + 1];
+            const tinyobj::real_t e02z = v[vi2 * 3 + 2] - v[vi0 * 3 + 2];
+            const tinyobj::real_t e13x = v[vi3 * 3 + 0] - v[vi1 * 3 + 0];
+            const tinyobj::real_t e13y = v[vi3 * 3 + 1] - v[vi1 * 3 + 1];
+            const tinyobj::real_t e13z = v[vi3 * 3 + 2] - v[vi1 * 3 + 2];
+            const tinyobj::real_t sqr02 = e02x * e02x + e02y * e02y + e02z * e02z;
+            const tinyobj::real_t sqr13 = e13x * e13x + e13y * e13y + e13z * e13z;
+
+            if (sqr02 < sqr13) {
+                AddTriangle(face[0], face[1], face[2]);
+                AddTriangle(face[0], face[2], face[3]);
+            } else {
+                AddTriangle(face[0], face[1], face[3]);
+                AddTriangle(face[1], face[2], face[3]);
+            }
+            return;
+        }
+
+        auto group = tinyobj::PrimGroup {};
+        auto& polygon = group.faceGroup.emplace_back();
+        for (auto i = 0u; i < size; ++i) {
+            polygon.vertex_indices.emplace_back(face[i].vertex_index, face[i].texcoord_index, face[i].normal_index);
+        }
+
+        auto triangulated = tinyobj::shape_t {};
+        tinyobj::exportGroupsToShape(&triangulated, group, {}, material_, name_, true, v, nullptr);
+        const auto& indices = triangulated.mesh.indices;
+        shape_.mesh.indices.insert(shape_.mesh.indices.end(), indices.begin(), indices.end());
+        shape_.mesh.material_ids.insert(shape_.mesh.material_ids.end(), indices.size() / 3, material_);
+    }
+};
+
+} // unnamed namespace
+
+auto parse_obj(
+    const fs::path& path,
+    tinyobj::MaterialReader& material_reader,
+    unsigned workers,
+    std::size_t min_chunk_size
+) -> std::expected<ObjData, std::string> {
+    GLEAM_PROFILE_FUNCTION();
+    const auto file = gleam::MappedFile::Open(path);
+    if (!file) {
+        return std::unexpected("Cannot open file [" + path.string() + "]\n");
+    }
+
+    const auto bytes = (*file)->Bytes();
+    const auto* begin = reinterpret_cast<const char*>(bytes.data());
+    const auto* end = begin + bytes.size();
+
+    if (workers == 0) workers = std::max(std::thread::hardware_concurrency(), 1u);
+    const auto chunk_count = std::clamp(
+        bytes.size() / std::max(min_chunk_size, std::size_t {1}),
+        std::size_t {1},
+        workers * chunks_per_worker
+    );
+
+    // Chunks start at the beginning of a line.
+    auto bounds = std::vector<const char*> {begin};
+    for (auto i = std::size_t {1}; i < chunk_count; ++i) {
+        const auto* target = std::max(begin + bytes.size() * i / chunk_count, bounds.back());
+        const auto* newline = static_cast<const char*>(std::memchr(target, '\n', end - target));
+        bounds.push_back(newline ? newline + 1 : end);
+    }
+    bounds.push_back(end);
+
+    auto chunks = std::vector<Chunk>(chunk_count);
+    {
+        auto next = std::atomic<std::size_t> {0};
+        const auto work = [&] {
+            for (auto i = next++; i < chunk_count; i = next++) {
+                ChunkParser {chunks[i]}.Parse(bounds[i], bounds[i + 1]);
+            }
+        };
+
+        auto threads = std::vector<std::jthread> {};
+        for (auto i = 1u; i < std::min<std::size_t>(workers, chunk_count); ++i) {
+            threads.emplace_back([&work] {
+                gleam::Profiler::Get().SetThreadName("OBJ Parser");
+                work();
+            });
+        }
+        work();
+    }
+
+    GLEAM_PROFILE_ZONE("merge_chunks");
+    auto data = ObjData {};
+    auto& attrib = data.attrib;
+
+    // Relative indices are resolved against the attributes of the chunks
+    // before them. The first error in the file is the one reported.
+    auto offsets = std::vector<std::array<int, 3>>(chunk_count);
+    auto counts = std::array<int, 3> {0, 0, 0};
+    auto line_offset = std::size_t {0};
+    auto greatest = std::array<int, 3> {-1, -1, -1};
+    auto zero_index = false;
+    for (auto i = std::size_t {0}; i < chunk_count; ++i) {
+        auto& chunk = chunks[i];
+        offsets[i] = counts;
+        for (const auto& relative : chunk.relative) {
+            if (chunk.error_line != 0 && relative.line > chunk.error_line) break;
+            const auto value = relative.value + counts[relative.attribute];
+            if (value < 0) return std::unexpected(parse_error(relative.primitive, line_offset + relative.line));
+            if (relative.index == no_index) continue;
+
+            auto& vertex = chunk.indices[relative.index];
+            switch (relative.attribute) {
+                case Position: vertex.vertex_index = value; break;
+                case Normal: vertex.normal_index = value; break;
+                default: vertex.texcoord_index = value; break;
+            }
+        }
+
+        if (chunk.zero_index) zero_index = true;
+        if (chunk.error_line != 0) {
+            return std::unexpected(parse_error(chunk.error_primitive, line_offset + chunk.error_line));
+        }
+
+        for (auto attribute : {Position, Normal, Texcoord}) {
+            counts[attribute] += chunk.Count(attribute);
+            greatest[attribute] = std::max(greatest[attribute], chunk.greatest[attribute]);
+        }
+        line_offset += chunk.lines;
+    }
+
+    attrib.vertices.reserve(static_cast<std::size_t>(counts[Position]) * 3);
+    attrib.normals.reserve(static_cast<std::size_t>(counts[Normal]) * 3);
+    attrib.texcoords.reserve(static_cast<std::size_t>(counts[Texcoord]) * 2);
+    for (const auto& chunk : chunks) {
+        attrib.vertices.insert(attrib.vertices.end(), chunk.positions.begin(), chunk.positions.end());
+        attrib.normals.insert(attrib.normals.end(), chunk.normals.begin(), chunk.normals.end());
+        attrib.texcoords.insert(attrib.texcoords.end(), chunk.texcoords.begin(), chunk.texcoords.end());
+    }
+
+    if (zero_index) {
+        data.warning += "A zero value index found (will have a value of -1 for normal and tex indices).\n";
+    }
+
+    auto assembler = ShapeAssembler {data, material_reader};
+    line_offset = 0;
+    for (auto i = std::size_t {0}; i < chunk_count; ++i) {
+        const auto& chunk = chunks[i];
+        auto face = std::size_t {0};
+        auto index = std::size_t {0};
+        for (const auto& event : chunk.events) {
+            assembler.AddFaces(chunk, face, event.face, index);
+            face = event.face;
+            index = event.index;
+            const auto vertex_limit = static_cast<std::size_t>(offsets[i][Position]) + event.vertex;
+            assembler.Apply(event, vertex_limit, line_offset + event.line);
+        }
+        assembler.AddFaces(chunk, face, chunk.face_sizes.size(), index);
+        line_offset += chunk.lines;
+    }
+    assembler.Finish(static_cast<std::size_t>(counts[Position]));
+
+    constexpr std::string_view names[] = {"Vertex", "Vertex normal", "Vertex texcoord"};
+    for (auto attribute : {Position, Normal, Texcoord}) {
+        if (greatest[attribute] >= counts[attribute]) {
+            data.warning += std::format("{} indices out of bounds (line {}.)\n\n", names[attribute], line_offset);
+        }
+    }
+
+    return data;
+}
\ No newline at end of file
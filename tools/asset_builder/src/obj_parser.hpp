@@ -0,0 +1,43 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "tiny_obj_loader.hpp"
+
+namespace fs = std::filesystem;
+
+struct ObjData {
+    // Only positions, normals and texture coordinates are filled in.
+    tinyobj::attrib_t attrib;
+
+    // Only names, triangle indices and material ids are filled in.
+    std::vector<tinyobj::shape_t> shapes;
+
+    std::vector<tinyobj::material_t> materials;
+
+    std::string warning;
+};
+
+// Parses an OBJ file into the same shapes, triangles and attributes as
+// tinyobj::LoadObj with triangulation enabled. The file is split into
+// line-aligned chunks of at least `min_chunk_size` bytes that are parsed on
+// `workers` threads, one per core when 0, and then merged in file order.
+// Material libraries are loaded through `material_reader` as they're
+// referenced.
+auto parse_obj(
+    const fs::path& path,
+    tinyobj::MaterialReader& material_reader,
+    unsigned workers = 0,
+    std::size_t min_chunk_size = std::size_t {1} << 20
+) -> std::expected<ObjData, std::string>;
\ No newline at end of file
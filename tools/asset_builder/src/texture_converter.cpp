@@ -8,25 +8,191 @@
 #define STB_IMAGE_IMPLEMENTATION
 
 #include "texture_converter.hpp"
+#include "build_cache.hpp"
 #include "types.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <format>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "stb_image.hpp"
 
+#include "utilities/profiler.hpp"
+
+namespace {
+
+constexpr auto texture_converter_version = 2;
+
+// Mip levels are filtered on linear, premultiplied colors. Averaging sRGB
+// values darkens the image, and averaging straight alpha bleeds the color of
+// transparent texels into the edges of opaque ones.
+struct LinearImage {
+    uint32_t width;
+    uint32_t height;
+    std::vector<float> pixels;
+};
+
+auto srgb_to_linear(float value) {
+    return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+auto linear_to_srgb(float value) {
+    return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+auto to_linear(const stbi_uc* data, uint32_t width, uint32_t height) {
+    auto table = std::array<float, 256> {};
+    for (auto i = 0; i < 256; ++i) table[i] = srgb_to_linear(static_cast<float>(i) / 255.0f);
+
+    auto output = LinearImage {width, height, std::vector<float>(static_cast<std::size_t>(width) * height * 4)};
+    for (auto i = std::size_t {0}; i < output.pixels.size(); i += 4) {
+        const auto alpha = static_cast<float>(data[i + 3]) / 255.0f;
+        output.pixels[i + 0] = table[data[i + 0]] * alpha;
+        output.pixels[i + 1] = table[data[i + 1]] * alpha;
+        output.pixels[i + 2] = table[data[i + 2]] * alpha;
+        output.pixels[i + 3] = alpha;
+    }
+    return output;
+}
+
+auto to_bytes(const LinearImage& image, std::vector<uint8_t>& output) {
+    const auto quantize = [](float value) {
+        return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    };
+
+    for (auto i = std::size_t {0}; i < image.pixels.size(); i += 4) {
+        const auto alpha = image.pixels[i + 3];
+        const auto scale = alpha > 0.0f ? 1.0f / alpha : 0.0f;
+        output.push_back(quantize(linear_to_srgb(image.pixels[i + 0] * scale)));
+        output.push_back(quantize(linear_to_srgb(image.pixels[i + 1] * scale)));
+        output.push_back(quantize(linear_to_srgb(image.pixels[i + 2] * scale)));
+        output.push_back(quantize(alpha));
+    }
+}
+
+// Source texels and weights a texel of the next level is filtered from along
+// one axis. Even sizes average pairs. Odd sizes spread three texels over each
+// output texel, so the one left over isn't dropped and the level stays
+// centered, while level sizes keep halving down like the loader expects.
+struct FilterTaps {
+    std::array<uint32_t, 3> index {};
+    std::array<float, 3> weight {};
+};
+
+auto filter_taps(uint32_t source_size, uint32_t x) -> FilterTaps {
+    if (source_size == 1) return {{0, 0, 0}, {1.0f, 0.0f, 0.0f}};
+    if (source_size % 2 == 0) return {{x * 2, x * 2 + 1, x * 2 + 1}, {0.5f, 0.5f, 0.0f}};
+
+    const auto n = static_cast<float>(source_size);
+    const auto m = static_cast<float>(source_size / 2);
+    const auto i = static_cast<float>(x);
+    return {{x * 2, x * 2 + 1, x * 2 + 2}, {(m - i) / n, m / n, (i + 1.0f) / n}};
+}
+
+auto downsample(const LinearImage& source) {
+    const auto width = std::max(source.width / 2, 1u);
+    const auto height = std::max(source.height / 2, 1u);
+    auto output = LinearImage {width, height, std::vector<float>(static_cast<std::size_t>(width) * height * 4)};
+
+    auto columns = std::vector<FilterTaps>(width);
+    for (auto x = 0u; x < width; ++x) columns[x] = filter_taps(source.width, x);
+
+    for (auto y = 0u; y < height; ++y) {
+        const auto row = filter_taps(source.height, y);
+        for (auto x = 0u; x < width; ++x) {
+            const auto& column = columns[x];
+            auto dst = &output.pixels[(static_cast<std::size_t>(y) * width + x) * 4];
+            for (auto ty = 0; ty < 3; ++ty) {
+                if (row.weight[ty] == 0.0f) continue;
+                const auto src_row = static_cast<std::size_t>(row.index[ty]) * source.width;
+                for (auto tx = 0; tx < 3; ++tx) {
+                    const auto weight = row.weight[ty] * column.weight[tx];
+                    if (weight == 0.0f) continue;
+                    const auto src = &source.pixels[(src_row + column.index[tx]) * 4];
+                    for (auto i = 0; i < 4; ++i) dst[i] += src[i] * weight;
+                }
+            }
+        }
+    }
+    return output;
+}
+
+auto generate_mip_chain(const stbi_uc* data, uint32_t width, uint32_t height, uint32_t& mip_levels) {
+    GLEAM_PROFILE_ZONE("generate_mip_chain");
+    const auto base_size = static_cast<std::size_t>(width) * height * 4;
+    auto output = std::vector<uint8_t>(data, data + base_size);
+    output.reserve(base_size + base_size / 3 + 4);
+
+    // The base level is stored as decoded, every other level is filtered
+    // from the previous one at full precision.
+    mip_levels = 1;
+    auto level = to_linear(data, width, height);
+    while (level.width > 1 || level.height > 1) {
+        level = downsample(level);
+        to_bytes(level, output);
+        ++mip_levels;
+    }
+    return output;
+}
+
+auto block_format(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::BC1: return gleam::BlockFormat::BC1;
+        case TextureFormat::BC3: return gleam::BlockFormat::BC3;
+        default: return gleam::BlockFormat::BC7;
+    }
+}
+
+// Levels are filtered uncompressed and compressed one by one, so every level
+// is encoded from full-precision texels.
+auto compress_mip_chain(
+    const std::vector<uint8_t>& levels,
+    const TextureHeader& header,
+    gleam::BlockQuality quality
+) {
+    GLEAM_PROFILE_ZONE("compress_mip_chain");
+    const auto format = block_format(static_cast<TextureFormat>(header.format));
+    auto output = std::vector<uint8_t> {};
+    auto offset = std::size_t {0};
+    for (auto level = 0u; level < header.mip_levels; ++level) {
+        const auto width = std::max(header.width >> level, 1u);
+        const auto height = std::max(header.height >> level, 1u);
+        const auto size = static_cast<std::size_t>(width) * height * 4;
+        const auto blocks = gleam::encode_blocks({levels.data() + offset, size}, width, height, format, quality);
+        output.insert(output.end(), blocks.begin(), blocks.end());
+        offset += size;
+    }
+    return output;
+}
+
+} // unnamed namespace
+
 auto convert_texture(
     const fs::path& input_path,
-    const fs::path& output_path
+    const fs::path& output_path,
+    const TextureOptions& options
 ) -> std::expected<void, std::string> {
+    GLEAM_PROFILE_FUNCTION();
     auto width = 0;
     auto height = 0;
     auto channels = 0;
 
-    stbi_set_flip_vertically_on_load(true);
-    auto data = stbi_load(input_path.string().c_str(), &width, &height, &channels, 4);
+    stbi_set_flip_vertically_on_load_thread(true);
+    auto data = static_cast<stbi_uc*>(nullptr);
+    {
+        GLEAM_PROFILE_ZONE("decode_image");
+        data = stbi_load(input_path.string().c_str(), &width, &height, &channels, 4);
+    }
     if (!data) {
         return std::unexpected("Failed to load image: " + input_path.string());
     }
@@ -37,19 +203,65 @@ auto convert_texture(
     header.header_size = sizeof(TextureHeader);
     header.width = static_cast<uint32_t>(width);
     header.height = static_cast<uint32_t>(height);
-    header.format = static_cast<uint32_t>(TextureFormat::RGBA8);
-    header.mip_levels = 1;
-    header.pixel_data_size = static_cast<uint64_t>(width) * height * 4;
+    header.format = static_cast<uint32_t>(options.format);
+
+    auto pixels = generate_mip_chain(data, header.width, header.height, header.mip_levels);
+    if (options.format != TextureFormat::RGBA8) {
+        pixels = compress_mip_chain(pixels, header, options.quality);
+    }
+    header.pixel_data_size = static_cast<uint64_t>(pixels.size());
+    stbi_image_free(data);
 
     auto out_stream = std::ofstream {output_path, std::ios::binary};
     if (!out_stream) {
-        stbi_image_free(data);
         return std::unexpected("Failed to open output file: " + output_path.string());
     }
 
     out_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
-    out_stream.write(reinterpret_cast<const char*>(data), header.pixel_data_size);
-    stbi_image_free(data);
+    out_stream.write(reinterpret_cast<const char*>(pixels.data()), header.pixel_data_size);
 
     return {};
+}
+
+auto texture_build_options(const TextureOptions& options) -> std::string {
+    return std::format(
+        "texture {} format={} quality={}",
+        texture_converter_version,
+        static_cast<int>(options.format),
+        static_cast<int>(options.quality)
+    );
+}
+
+auto convert_texture_shared(
+    const fs::path& input_path,
+    const fs::path& output_path,
+    const TextureOptions& options
+) -> std::expected<void, std::string> {
+    using Result = std::expected<void, std::string>;
+    static auto mutex = std::mutex {};
+    static auto conversions = std::unordered_map<std::string, std::shared_future<Result>> {};
+
+    auto promise = std::promise<Result> {};
+    auto future = std::shared_future<Result> {};
+    auto owner = false;
+    {
+        const auto lock = std::scoped_lock(mutex);
+        const auto key = fs::absolute(output_path).lexically_normal().string();
+        auto [it, inserted] = conversions.try_emplace(key);
+        if (inserted) {
+            it->second = promise.get_future().share();
+            owner = true;
+        }
+        future = it->second;
+    }
+
+    if (owner) {
+        promise.set_value(BuildCache::Get().Build(
+            input_path,
+            output_path,
+            texture_build_options(options),
+            [&](BuildDependencies&) { return convert_texture(input_path, output_path, options); }
+        ));
+    }
+    return future.get();
 }
\ No newline at end of file
@@ -7,12 +7,37 @@
 
 #pragma once
 
+#include "types.hpp"
+
+#include "utilities/texture_codec.hpp"
+
 #include <expected>
 #include <filesystem>
+#include <string>
 
 namespace fs = std::filesystem;
 
+struct TextureOptions {
+    TextureFormat format {TextureFormat::RGBA8};
+    gleam::BlockQuality quality {gleam::BlockQuality::High};
+};
+
+// Identifies the texture converter and its settings in the build cache.
+// Bump the version whenever the converter's output changes.
+auto texture_build_options(const TextureOptions& options) -> std::string;
+
 auto convert_texture(
     const fs::path& input_path,
-    const fs::path& output_path
+    const fs::path& output_path,
+    const TextureOptions& options = {}
+) -> std::expected<void, std::string>;
+
+// Converts each output at most once per process. Callers asking for an
+// output that's already being converted wait for it and share its result,
+// so meshes converted in parallel can reference the same textures. Outputs
+// the build cache finds up to date aren't converted at all.
+auto convert_texture_shared(
+    const fs::path& input_path,
+    const fs::path& output_path,
+    const TextureOptions& options = {}
 ) -> std::expected<void, std::string>;
\ No newline at end of file
@@ -0,0 +1,107 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "bench_report.hpp"
+
+#include <algorithm>
+#include <format>
+#include <functional>
+#include <numeric>
+
+namespace {
+
+auto percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    const auto index = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+auto summarize(const BenchReport& report, const std::function<double(const FrameSample&)>& value) {
+    auto values = std::vector<double> {};
+    values.reserve(report.samples.size());
+    for (const auto& sample : report.samples) values.emplace_back(value(sample));
+    std::ranges::sort(values);
+
+    const auto mean = values.empty() ? 0.0 :
+        std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+
+    return std::format(
+        R"({{"mean": {:.4f}, "median": {:.4f}, "p95": {:.4f}, "min": {:.4f}, "max": {:.4f}}})",
+        mean,
+        percentile(values, 0.5),
+        percentile(values, 0.95),
+        values.empty() ? 0.0 : values.front(),
+        values.empty() ? 0.0 : values.back()
+    );
+}
+
+}
+
+auto report_to_json(const BenchReport& report) -> std::string {
+    const auto& scene = report.scene;
+    auto stage = [&](auto member) {
+        return summarize(report, [member](const auto& s) { return s.statistics.*member; });
+    };
+    auto counter = [&](auto member) {
+        return summarize(report, [member](const auto& s) {
+            return static_cast<double>(s.statistics.*member);
+        });
+    };
+
+    using gleam::RenderStatistics;
+    auto json = std::string {};
+    json += "{\n";
+    json += std::format(
+        "  \"scene\": {{\"nodes\": {}, \"depth\": {}, \"lights\": {}, \"materials\": {}, "
+        "\"mix\": {{\"flat\": {}, \"phong\": {}, \"shader\": {}}}, \"seed\": {}}},\n",
+        scene.nodes, scene.depth, scene.lights, scene.materials,
+        scene.mix.flat, scene.mix.phong, scene.mix.shader, scene.seed
+    );
+    json += std::format(
+        "  \"viewport\": {{\"width\": {}, \"height\": {}}},\n",
+        report.width, report.height
+    );
+    json += std::format("  \"warmup_frames\": {},\n", report.warmup_frames);
+    json += std::format("  \"frames\": {},\n", report.samples.size());
+    json += std::format("  \"frame_ms\": {},\n", summarize(report, [](const auto& s) { return s.frame_ms; }));
+    json += "  \"stages_ms\": {\n";
+    json += std::format("    \"transform_update\": {},\n", stage(&RenderStatistics::transform_update_ms));
+    json += std::format("    \"render_lists\": {},\n", stage(&RenderStatistics::render_lists_ms));
+    json += std::format("    \"culling\": {},\n", stage(&RenderStatistics::culling_ms));
+    json += std::format("    \"upload\": {},\n", stage(&RenderStatistics::upload_ms));
+    json += std::format("    \"uniform_setup\": {},\n", stage(&RenderStatistics::uniform_setup_ms));
+    json += std::format("    \"submission\": {}\n", stage(&RenderStatistics::submission_ms));
+    json += "  },\n";
+    json += "  \"gpu_ms\": {\n";
+    json += std::format("    \"clear\": {},\n", stage(&RenderStatistics::gpu_clear_ms));
+    json += std::format("    \"opaque\": {},\n", stage(&RenderStatistics::gpu_opaque_ms));
+    json += std::format("    \"transparent\": {},\n", stage(&RenderStatistics::gpu_transparent_ms));
+    json += std::format("    \"frame\": {}\n", stage(&RenderStatistics::gpu_frame_ms));
+    json += "  },\n";
+    json += std::format("  \"draw_calls\": {},\n", counter(&RenderStatistics::draw_calls));
+    json += std::format("  \"triangles\": {},\n", counter(&RenderStatistics::triangles));
+    json += "  \"counters\": {\n";
+    json += std::format("    \"program_switches\": {},\n", counter(&RenderStatistics::program_switches));
+    json += std::format("    \"vao_binds\": {},\n", counter(&RenderStatistics::vao_binds));
+    json += std::format("    \"texture_binds\": {},\n", counter(&RenderStatistics::texture_binds));
+    json += std::format("    \"uniform_uploads\": {},\n", counter(&RenderStatistics::uniform_uploads));
+    json += std::format("    \"ubo_bytes_uploaded\": {},\n", counter(&RenderStatistics::ubo_bytes_uploaded));
+    json += std::format("    \"uploads_deferred\": {},\n", counter(&RenderStatistics::uploads_deferred));
+    json += std::format("    \"culled_frustum\": {},\n", counter(&RenderStatistics::culled_frustum));
+    json += std::format("    \"culled_invalid_geometry\": {},\n", counter(&RenderStatistics::culled_invalid_geometry));
+    json += std::format("    \"culled_invalid_program\": {},\n", counter(&RenderStatistics::culled_invalid_program));
+    json += std::format("    \"culled_not_resident\": {}\n", counter(&RenderStatistics::culled_not_resident));
+    json += "  },\n";
+    json += "  \"memory_bytes\": {\n";
+    json += std::format("    \"buffers\": {},\n", counter(&RenderStatistics::buffer_memory_bytes));
+    json += std::format("    \"textures\": {},\n", counter(&RenderStatistics::texture_memory_bytes));
+    json += std::format("    \"geometry_cpu\": {},\n", counter(&RenderStatistics::geometry_cpu_memory_bytes));
+    json += std::format("    \"texture_cpu\": {}\n", counter(&RenderStatistics::texture_cpu_memory_bytes));
+    json += "  }\n";
+    json += "}\n";
+    return json;
+}
\ No newline at end of file
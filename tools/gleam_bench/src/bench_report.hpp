@@ -0,0 +1,36 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "bench_scene.hpp"
+
+#include <gleam/core/render_statistics.hpp>
+
+#include <string>
+#include <vector>
+
+struct FrameSample {
+    double frame_ms {0.0};
+    gleam::RenderStatistics statistics {};
+};
+
+struct BenchReport {
+    SceneParameters scene {};
+    int width {0};
+    int height {0};
+    unsigned warmup_frames {0};
+    std::vector<FrameSample> samples;
+};
+
+/**
+ * @brief Serializes the report as JSON.
+ *
+ * Every per-frame series is summarized by its mean, median, 95th percentile,
+ * minimum and maximum.
+ */
+auto report_to_json(const BenchReport& report) -> std::string;
\ No newline at end of file
@@ -0,0 +1,163 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "bench_scene.hpp"
+
+#include <gleam/cameras/perspective_camera.hpp>
+#include <gleam/geometries/box_geometry.hpp>
+#include <gleam/geometries/sphere_geometry.hpp>
+#include <gleam/lights/ambient_light.hpp>
+#include <gleam/lights/point_light.hpp>
+#include <gleam/materials/flat_material.hpp>
+#include <gleam/materials/phong_material.hpp>
+#include <gleam/materials/shader_material.hpp>
+#include <gleam/math/utilities.hpp>
+#include <gleam/nodes/mesh.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <random>
+#include <ranges>
+#include <string_view>
+
+using namespace gleam;
+
+namespace {
+
+constexpr auto kVertexShader = R"(#version 410 core
+    #pragma inject_attributes
+
+    #include "snippets/vert_global_params.glsl"
+
+    void main() {
+        #include "snippets/vert_main_varyings.glsl"
+
+        gl_Position = u_Projection * v_Position;
+    })";
+
+constexpr auto kFragmentShader = R"(#version 410 core
+    #pragma inject_attributes
+
+    #include "snippets/frag_global_params.glsl"
+
+    uniform vec3 u_Tint;
+
+    void main() {
+        v_FragColor = vec4(u_Tint * (0.5 + 0.5 * v_Normal), u_Opacity);
+    })";
+
+auto create_materials(const SceneParameters& params, std::mt19937& rng) {
+    auto materials = std::vector<std::shared_ptr<Material>> {};
+    const auto& mix = params.mix;
+    const auto total = mix.flat + mix.phong + mix.shader;
+    auto dist = std::uniform_real_distribution<float> {0.0f, 1.0f};
+
+    for (auto i = 0u; i < std::max(params.materials, 1u); ++i) {
+        const auto color = Color {dist(rng), dist(rng), dist(rng)};
+        // Materials are assigned to types in proportion to their weights.
+        const auto slot = (i * total) / std::max(params.materials, 1u);
+        if (slot < mix.flat) {
+            materials.emplace_back(FlatMaterial::Create(color));
+        } else if (slot < mix.flat + mix.phong) {
+            materials.emplace_back(PhongMaterial::Create(color));
+        } else {
+            materials.emplace_back(ShaderMaterial::Create(kVertexShader, kFragmentShader, {
+                {"u_Tint", Vector3 {color.r, color.g, color.b}}
+            }));
+        }
+    }
+
+    return materials;
+}
+
+}
+
+auto parse_material_mix(const std::string& str, MaterialMix& mix) -> bool {
+    mix = {0, 0, 0};
+    for (const auto part : std::views::split(std::string_view {str}, ',')) {
+        const auto entry = std::string_view {part.begin(), part.end()};
+        const auto eq = entry.find('=');
+        if (eq == std::string_view::npos) return false;
+
+        const auto name = entry.substr(0, eq);
+        const auto value = entry.substr(eq + 1);
+        auto weight = 0u;
+        const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), weight);
+        if (ec != std::errc {} || ptr != value.data() + value.size()) return false;
+
+        if (name == "flat") mix.flat = weight;
+        else if (name == "phong") mix.phong = weight;
+        else if (name == "shader") mix.shader = weight;
+        else return false;
+    }
+    return mix.flat + mix.phong + mix.shader > 0;
+}
+
+auto build_scene(const SceneParameters& params) -> BenchScene {
+    auto rng = std::mt19937 {params.seed};
+    auto output = BenchScene {};
+    output.scene = Scene::Create();
+
+    const auto materials = create_materials(params, rng);
+    const auto geometries = std::array<std::shared_ptr<Geometry>, 2> {
+        BoxGeometry::Create(),
+        SphereGeometry::Create({.radius = 0.5f, .width_segments = 16, .height_segments = 8})
+    };
+
+    // Chains are scattered in a cube that grows with the scene, so the
+    // density, and the fraction of meshes outside the frustum, stays similar.
+    const auto depth = std::max(params.depth, 1u);
+    const auto chains = (params.nodes + depth - 1) / depth;
+    const auto extent = 4.0f * std::cbrt(static_cast<float>(std::max(chains, 1u)));
+    auto position = std::uniform_real_distribution<float> {-extent, extent};
+
+    auto parent = std::shared_ptr<Node> {};
+    for (auto i = 0u; i < params.nodes; ++i) {
+        auto mesh = Mesh::Create(geometries[i % geometries.size()], materials[i % materials.size()]);
+        if (i % depth == 0) {
+            mesh->transform.Translate({position(rng), position(rng), position(rng)});
+            output.scene->Add(mesh);
+            output.roots.emplace_back(mesh.get());
+        } else {
+            mesh->transform.Translate({1.5f, 0.0f, 0.0f});
+            mesh->transform.Scale({0.9f, 0.9f, 0.9f});
+            parent->Add(mesh);
+        }
+        parent = mesh;
+    }
+
+    if (params.lights > 0) {
+        output.scene->Add(AmbientLight::Create({.color = 0xFFFFFF, .intensity = 0.2f}));
+    }
+    for (auto i = 1u; i < params.lights; ++i) {
+        auto light = PointLight::Create({
+            .color = 0xFFFFFF,
+            .intensity = 1.0f,
+            .attenuation = {.base = 1.0f, .linear = 0.0f, .quadratic = 0.0f}
+        });
+        light->transform.Translate({position(rng), position(rng), position(rng)});
+        output.scene->Add(light);
+    }
+
+    output.camera = PerspectiveCamera::Create({
+        .fov = math::DegToRad(60.0f),
+        .aspect = params.aspect,
+        .near = 0.1f,
+        .far = extent * 4.0f
+    });
+    output.camera->transform.Translate({0.0f, 0.0f, extent * 1.5f});
+
+    return output;
+}
+
+auto animate_scene(BenchScene& bench_scene, float delta) -> void {
+    for (auto root : bench_scene.roots) {
+        root->transform.Rotate(Vector3::Up(), delta);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <gleam/cameras/camera.hpp>
+#include <gleam/nodes/node.hpp>
+#include <gleam/nodes/scene.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+struct MaterialMix {
+    unsigned flat {1};
+    unsigned phong {1};
+    unsigned shader {0};
+};
+
+struct SceneParameters {
+    unsigned nodes {1000};
+    unsigned depth {1};
+    unsigned lights {1};
+    unsigned materials {16};
+    MaterialMix mix {};
+    unsigned seed {1};
+    float aspect {16.0f / 9.0f};
+};
+
+struct BenchScene {
+    std::shared_ptr<gleam::Scene> scene;
+    std::shared_ptr<gleam::Camera> camera;
+    std::vector<gleam::Node*> roots;
+};
+
+/**
+ * @brief Parses a material mix such as "flat=2,phong=1,shader=1".
+ *
+ * @return false if the string contains an unknown material or a bad weight.
+ */
+auto parse_material_mix(const std::string& str, MaterialMix& mix) -> bool;
+
+/**
+ * @brief Builds a scene from the given parameters.
+ *
+ * Meshes are arranged in chains of `depth` nodes, so every mesh but the
+ * first of a chain is the child of the one before it. Chains are scattered
+ * around the camera so part of the scene is culled.
+ */
+auto build_scene(const SceneParameters& params) -> BenchScene;
+
+/**
+ * @brief Rotates the root of every chain, which touches every transform.
+ */
+auto animate_scene(BenchScene& bench_scene, float delta) -> void;
\ No newline at end of file
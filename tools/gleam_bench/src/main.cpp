@@ -0,0 +1,161 @@
+/*
+===========================================================================
+  GLEAM ENGINE https://gleamengine.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "cxxopts.hpp"
+
+#include "bench_report.hpp"
+#include "bench_scene.hpp"
+
+#include <gleam/core/renderer.hpp>
+#include <gleam/core/window.hpp>
+
+#include "utilities/profiler.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+auto main(int argc, char** argv) -> int {
+    auto opts = cxxopts::Options {
+        "gleam_bench",
+        "Renders procedurally generated scenes headlessly and reports per-stage frame timings as JSON."
+    };
+
+    opts.add_options()
+        ("n,nodes", "Number of meshes", cxxopts::value<unsigned>()->default_value("1000"))
+        ("d,depth", "Length of the parent-child chains", cxxopts::value<unsigned>()->default_value("1"))
+        ("l,lights", "Number of lights, the first one is ambient", cxxopts::value<unsigned>()->default_value("2"))
+        ("m,materials", "Number of unique materials", cxxopts::value<unsigned>()->default_value("16"))
+        ("mix", "Material type weights", cxxopts::value<std::string>()->default_value("flat=1,phong=1,shader=0"))
+        ("f,frames", "Number of measured frames", cxxopts::value<unsigned>()->default_value("300"))
+        ("w,warmup", "Number of frames rendered before measuring", cxxopts::value<unsigned>()->default_value("30"))
+        ("width", "Viewport width", cxxopts::value<int>()->default_value("1280"))
+        ("height", "Viewport height", cxxopts::value<int>()->default_value("720"))
+        ("s,seed", "Random seed", cxxopts::value<unsigned>()->default_value("1"))
+        ("o,output", "Output file, '-' writes to stdout", cxxopts::value<std::string>()->default_value("gleam_bench.json"))
+        ("t,trace", "Chrome trace file for the measured frames", cxxopts::value<std::string>()->default_value(""))
+        ("h,help", "Show help");
+
+    auto options = opts.parse(argc, argv);
+
+    if (options.count("help")) {
+        std::cout << opts.help() << "\n";
+        return 0;
+    }
+
+    auto report = BenchReport {};
+    report.width = options["width"].as<int>();
+    report.height = options["height"].as<int>();
+    report.warmup_frames = options["warmup"].as<unsigned>();
+    report.scene = SceneParameters {
+        .nodes = options["nodes"].as<unsigned>(),
+        .depth = options["depth"].as<unsigned>(),
+        .lights = options["lights"].as<unsigned>(),
+        .materials = options["materials"].as<unsigned>(),
+        .seed = options["seed"].as<unsigned>(),
+        .aspect = static_cast<float>(report.width) / static_cast<float>(report.height)
+    };
+
+    const auto frames = options["frames"].as<unsigned>();
+    if (frames == 0) {
+        std::cerr << "Error: at least one frame must be measured (-f)\n";
+        return 1;
+    }
+
+    if (!parse_material_mix(options["mix"].as<std::string>(), report.scene.mix)) {
+        std::cerr << "Error: invalid material mix, expected e.g. flat=2,phong=1,shader=1\n";
+        return 1;
+    }
+
+    const auto trace = options["trace"].as<std::string>();
+#ifndef GLEAM_PROFILING
+    if (!trace.empty()) {
+        std::cerr << "Error: tracing requires a build with -DENABLE_PROFILER=ON\n";
+        return 1;
+    }
+#endif
+
+    auto window = gleam::Window {{
+        .width = report.width,
+        .height = report.height,
+        .antialiasing = 0,
+        .vsync = false,
+        .headless = true
+    }};
+
+    if (window.HasErrors()) {
+        std::cerr << "Error: failed to create a headless OpenGL context\n";
+        return 1;
+    }
+
+    auto renderer = gleam::Renderer {{
+        .width = report.width,
+        .height = report.height,
+        .offscreen = true
+    }};
+
+    auto bench_scene = build_scene(report.scene);
+    auto scene = bench_scene.scene.get();
+    auto camera = bench_scene.camera.get();
+
+    // Frames are simulated at a fixed rate so runs are reproducible.
+    constexpr auto delta = 1.0f / 60.0f;
+    report.samples.reserve(frames);
+
+    auto frame = 0u;
+    window.Start([&] {
+        if (frame == report.warmup_frames && !trace.empty()) {
+            gleam::Profiler::Get().SetEnabled(true);
+        }
+
+        GLEAM_PROFILE_FRAME();
+        const auto start = std::chrono::steady_clock::now();
+        {
+            GLEAM_PROFILE_ZONE("AnimateScene");
+            animate_scene(bench_scene, delta);
+        }
+        scene->ProcessUpdates(delta);
+        renderer.Render(scene, camera);
+        const auto end = std::chrono::steady_clock::now();
+
+        if (frame++ >= report.warmup_frames) {
+            report.samples.emplace_back(FrameSample {
+                .frame_ms = std::chrono::duration<double, std::milli>(end - start).count(),
+                .statistics = renderer.Statistics()
+            });
+        }
+
+        if (report.samples.size() == frames) window.Break();
+    });
+
+    if (!trace.empty()) {
+        gleam::Profiler::Get().SetEnabled(false);
+        if (!gleam::Profiler::Get().ExportChromeTrace(trace)) {
+            std::cerr << "Error: failed to write trace file: " << trace << "\n";
+            return 1;
+        }
+    }
+
+    const auto json = report_to_json(report);
+    const auto output = options["output"].as<std::string>();
+    if (output == "-") {
+        std::cout << json;
+        return 0;
+    }
+
+    auto file = std::ofstream {output};
+    if (!file) {
+        std::cerr << "Error: failed to open output file: " << output << "\n";
+        return 1;
+    }
+    file << json;
+
+    std::cout << "Wrote " << frames << " frames to " << output << "\n";
+
+    return 0;
+}
\ No newline at end of file